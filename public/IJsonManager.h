@@ -13,12 +13,26 @@ using SourcePawn::IPluginContext;
 class JsonValue;
 class JsonArrIter;
 class JsonObjIter;
+class JsonStreamParser;
+class JsonLinesReader;
+class JsonLinesWriter;
+class JsonCursor;
 
 #define SMINTERFACE_JSONMANAGER_NAME "IJsonManager"
-#define SMINTERFACE_JSONMANAGER_VERSION 3
+#define SMINTERFACE_JSONMANAGER_VERSION 19
 #define JSON_ERROR_BUFFER_SIZE 256
 #define JSON_INT64_BUFFER_SIZE 32
 
+/**
+ * @brief Extension read flags
+ *
+ * Combined with YYJSON_READ_FLAG values and stripped before the flags are passed to yyjson.
+ */
+#define JSON_READ_MMAP      (1u << 24)  // Memory-map files and parse them in-situ (file parsing only)
+#define JSON_READ_CACHE     (1u << 25)  // Share one immutable document per unchanged file (file parsing only, game thread only)
+#define JSON_READ_POOL      (1u << 26)  // Parse into one pre-sized block, small documents reuse a per-thread scratch block (string parsing only)
+#define JSON_READ_EXT_MASK  (0xFFu << 24)
+
 /**
  * @brief JSON sorting order
  */
@@ -29,6 +43,40 @@ enum JSON_SORT_ORDER
 	JSON_SORT_RANDOM = 2    // Random order
 };
 
+/**
+ * @brief Binary encodings a JSON value can be converted to and from
+ */
+enum JSON_BINARY_FORMAT
+{
+	JSON_BINARY_MSGPACK = 0,    // MessagePack
+	JSON_BINARY_CBOR = 1        // CBOR (RFC 8949)
+};
+
+/**
+ * @brief Limit that stopped a resource-capped parse
+ */
+enum JSON_PARSE_LIMIT
+{
+	JSON_LIMIT_NONE = 0,            // No limit was exceeded
+	JSON_LIMIT_INPUT_BYTES = 1,     // JSON text is too large
+	JSON_LIMIT_DEPTH = 2,           // Arrays and objects are nested too deeply
+	JSON_LIMIT_VALUES = 3,          // Too many values
+	JSON_LIMIT_MEMORY = 4           // Reader needs too much memory
+};
+
+/**
+ * @brief Resource limits for parsing untrusted input, 0 leaves a resource unlimited
+ */
+struct JsonParseLimits
+{
+	size_t maxInputBytes{ 0 };  // Size of the JSON text, after decompression for gzip files
+	size_t maxDepth{ 0 };       // Nesting depth of arrays and objects, a root array or object is depth 1
+	size_t maxValues{ 0 };      // Number of values, object keys included
+	size_t maxMemory{ 0 };      // Bytes allocated while reading, file data included
+
+	bool IsUnlimited() const { return !maxInputBytes && !maxDepth && !maxValues && !maxMemory; }
+};
+
 /**
  * @brief Parameter provider interface for Pack operation
  *
@@ -45,6 +93,25 @@ public:
 	virtual bool GetNextBool(bool* out_value) = 0;
 };
 
+/**
+ * @brief Receiver for chunked serialization output
+ *
+ * Used by WriteChunked to hand over the output piece by piece instead of as one string.
+ */
+class IJsonChunkSink
+{
+public:
+	virtual ~IJsonChunkSink() = default;
+
+	/**
+	 * Receive the next piece of output
+	 * @param data Chunk data, null-terminated
+	 * @param len Chunk length, not including the null terminator
+	 * @return false to abort the write
+	 */
+	virtual bool WriteChunk(const char* data, size_t len) = 0;
+};
+
 /**
  * @brief JSON Manager Interface
  *
@@ -83,6 +150,8 @@ public:
 	 * @param error Error buffer (optional)
 	 * @param error_size Error buffer size
 	 * @return JSON value pointer or nullptr on error
+	 * @note With JSON_READ_CACHE, files are shared through the file cache, mutable results are copied from it.
+	 *       Such calls must be made from the game thread
 	 */
 	virtual JsonValue* ParseJSON(const char* json_str, bool is_file, bool is_mutable = false,
 		uint32_t read_flg = 0, char* error = nullptr, size_t error_size = 0) = 0;
@@ -233,6 +302,7 @@ public:
 	 *       You MUST use the same flags when calling both GetSerializedSize()
 	 *       and WriteToString(). Using different flags will return
 	 *       different sizes and may cause buffer overflow.
+	 * @note The size is counted without building the output, so it is cheaper than a write
 	 *
 	 * @example
 	 *   // Correct usage:
@@ -1940,6 +2010,702 @@ public:
 	 */
 	virtual bool ParseInt64Variant(const char* value, std::variant<int64_t, uint64_t>* out_value,
 		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Create a read-only snapshot of a document
+	 * @param handle JSON value whose document should be captured
+	 * @return New immutable JSON value for the document root, or nullptr on error
+	 * @note The document is copied, later changes to the source, including in-place Set* calls on
+	 *       an immutable document, do not reach the snapshot
+	 */
+	virtual JsonValue* CreateSnapshot(JsonValue* handle) = 0;
+
+	/**
+	 * Write JSON to file through a temporary file and an atomic rename
+	 * @param handle JSON value
+	 * @param path File path
+	 * @param write_flg Write flags (YYJSON_WRITE_FLAG values, default: 0)
+	 * @param sync true to flush the data to disk before the target file is replaced
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return true on success
+	 * @note The target file is either left untouched or fully replaced, never partially written
+	 * @note Safe to call from a worker thread as long as the document is not modified concurrently
+	 */
+	virtual bool WriteToFileAtomic(JsonValue* handle, const char* path, uint32_t write_flg = 0,
+		bool sync = true, char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Create a parser for JSON data that arrives in chunks
+	 * @param read_flg Read flags (YYJSON_READ_FLAG values, default: 0)
+	 * @param expected_size Total input size in bytes if known (e.g. file size or Content-Length), 0 if unknown
+	 * @return New stream parser or nullptr on error
+	 * @note Caller must release the parser using ReleaseStreamParser() once finished
+	 * @note Objects and arrays are parsed as the data arrives. Top-level scalars and documents read with
+	 *       non-standard flags (JSON5, comments, BOM, ...) are buffered and parsed by StreamParserFinish()
+	 * @note With a known size the input is parsed in a single buffer; without it the buffer grows as needed
+	 *       and an extra copy of the input is kept until the document is complete
+	 */
+	virtual JsonStreamParser* StreamParserCreate(uint32_t read_flg = 0, size_t expected_size = 0) = 0;
+
+	/**
+	 * Feed the next chunk of data to a stream parser
+	 * @param parser Stream parser
+	 * @param data Chunk data, null-terminator is not required
+	 * @param len Chunk length in bytes
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return true on success, false if the data is invalid or exceeds expected_size
+	 * @note After an error the parser rejects further data until StreamParserFinish() resets it
+	 * @note Only whitespace may follow a complete document, unless YYJSON_READ_STOP_WHEN_DONE is set
+	 */
+	virtual bool StreamParserFeed(JsonStreamParser* parser, const char* data, size_t len,
+		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Check whether a stream parser has received a complete document
+	 * @param parser Stream parser
+	 * @return true if the document is complete
+	 * @note Always false for input that is buffered until StreamParserFinish()
+	 */
+	virtual bool StreamParserIsComplete(JsonStreamParser* parser) = 0;
+
+	/**
+	 * Finish parsing and return the document
+	 * @param parser Stream parser
+	 * @param is_mutable true to create mutable document
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return JSON value pointer or nullptr if the input is incomplete or invalid
+	 * @note The parser is reset afterwards and can be reused for the next document
+	 */
+	virtual JsonValue* StreamParserFinish(JsonStreamParser* parser, bool is_mutable = false,
+		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Release a stream parser
+	 * @param parser Parser to release
+	 */
+	virtual void ReleaseStreamParser(JsonStreamParser* parser) = 0;
+
+	/**
+	 * Get the HandleType_t for stream parser handles
+	 * @return The HandleType_t for stream parser handles
+	 */
+	virtual HandleType_t GetStreamParserHandleType() = 0;
+
+	/**
+	 * Read JsonStreamParser from a SourceMod handle
+	 * @param pContext Plugin context
+	 * @param handle Handle to read from
+	 * @return JsonStreamParser pointer, or nullptr on error
+	 */
+	virtual JsonStreamParser* GetStreamParserFromHandle(IPluginContext* pContext, Handle_t handle) = 0;
+
+	/**
+	 * Open a JSON Lines (newline-delimited JSON) file
+	 * @param path File path
+	 * @param read_flg Read flags (YYJSON_READ_FLAG values, default: 0)
+	 * @param buffer_size Read chunk size in bytes, grows only for lines longer than this
+	 * @param pooled true to parse immutable documents into a block that is reused once the previous document is released
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return New reader or nullptr on error
+	 * @note Caller must release the reader using ReleaseLinesReader() once finished
+	 * @note Memory use is bounded by the buffer size and the longest line, not by the file size
+	 */
+	virtual JsonLinesReader* LinesReaderOpen(const char* path, uint32_t read_flg = 0, size_t buffer_size = 65536,
+		bool pooled = false, char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Parse the next non-empty line
+	 * @param reader Lines reader
+	 * @param is_mutable true to create mutable document
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return JSON value pointer, or nullptr at the end of the file or if the line is invalid
+	 * @note An invalid line is skipped, so reading can continue with the next call
+	 * @note Use LinesReaderIsEOF() to tell the end of the file from an invalid line
+	 */
+	virtual JsonValue* LinesReaderNext(JsonLinesReader* reader, bool is_mutable = false,
+		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Skip lines without parsing them
+	 * @param reader Lines reader
+	 * @param count Number of lines to skip
+	 * @return Number of lines skipped, less than count if the end of the file was reached
+	 */
+	virtual size_t LinesReaderSkip(JsonLinesReader* reader, size_t count) = 0;
+
+	/**
+	 * Move to a line number
+	 * @param reader Lines reader
+	 * @param line Line number (0-based)
+	 * @return true on success, false if the file has fewer lines
+	 */
+	virtual bool LinesReaderSeekLine(JsonLinesReader* reader, size_t line) = 0;
+
+	/**
+	 * Resume reading at a byte offset previously returned by LinesReaderGetOffset()
+	 * @param reader Lines reader
+	 * @param offset Byte offset of a line start
+	 * @param line Line number of that line, used for line numbers reported afterwards
+	 * @return true on success
+	 */
+	virtual bool LinesReaderSeekOffset(JsonLinesReader* reader, uint64_t offset, size_t line) = 0;
+
+	/**
+	 * Get the number of the next line to be read
+	 * @param reader Lines reader
+	 * @return Line number (0-based)
+	 */
+	virtual size_t LinesReaderGetLine(JsonLinesReader* reader) = 0;
+
+	/**
+	 * Get the byte offset of the next line to be read
+	 * @param reader Lines reader
+	 * @return Byte offset from the start of the file
+	 */
+	virtual uint64_t LinesReaderGetOffset(JsonLinesReader* reader) = 0;
+
+	/**
+	 * Check whether the end of the file has been reached
+	 * @param reader Lines reader
+	 * @return true if there are no more lines
+	 */
+	virtual bool LinesReaderIsEOF(JsonLinesReader* reader) = 0;
+
+	/**
+	 * Release a lines reader
+	 * @param reader Reader to release
+	 */
+	virtual void ReleaseLinesReader(JsonLinesReader* reader) = 0;
+
+	/**
+	 * Get the HandleType_t for lines reader handles
+	 * @return The HandleType_t for lines reader handles
+	 */
+	virtual HandleType_t GetLinesReaderHandleType() = 0;
+
+	/**
+	 * Read JsonLinesReader from a SourceMod handle
+	 * @param pContext Plugin context
+	 * @param handle Handle to read from
+	 * @return JsonLinesReader pointer, or nullptr on error
+	 */
+	virtual JsonLinesReader* GetLinesReaderFromHandle(IPluginContext* pContext, Handle_t handle) = 0;
+
+	/**
+	 * Open a JSON Lines file for buffered appending
+	 * @param path File path
+	 * @param write_flg Write flags (YYJSON_WRITE_FLAG values, pretty printing is ignored)
+	 * @param rotate_size Rotate the file before it grows beyond this many bytes, 0 to disable
+	 * @param rotate_interval Rotate the file once it is older than this many seconds, 0 to disable
+	 * @param flush_interval_ms Maximum time in milliseconds records stay in memory before they are written
+	 * @param buffer_limit Maximum number of pending bytes, further records are dropped until the next write
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return New writer or nullptr on error
+	 * @note Caller must release the writer using ReleaseLinesWriter(), which writes the remaining records
+	 * @note Records are written by a writer-owned thread. Rotated files are renamed to name.YYYYMMDD-HHMMSS.ext
+	 */
+	virtual JsonLinesWriter* LinesWriterOpen(const char* path, uint32_t write_flg = 0, size_t rotate_size = 0,
+		uint32_t rotate_interval = 0, uint32_t flush_interval_ms = 1000, size_t buffer_limit = 4 * 1024 * 1024,
+		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Serialize a value and queue it as one line
+	 * @param writer Lines writer
+	 * @param handle JSON value
+	 * @return true if queued, false on serialization error or if the buffer is full
+	 * @note Must be called from the game thread
+	 */
+	virtual bool LinesWriterAppend(JsonLinesWriter* writer, JsonValue* handle) = 0;
+
+	/**
+	 * Write all queued records
+	 * @param writer Lines writer
+	 * @param wait true to block until they are on disk
+	 */
+	virtual void LinesWriterFlush(JsonLinesWriter* writer, bool wait = false) = 0;
+
+	/**
+	 * Get the number of dropped records
+	 * @param writer Lines writer
+	 * @return Records dropped because the buffer was full or the write failed
+	 */
+	virtual uint64_t LinesWriterGetDropped(JsonLinesWriter* writer) = 0;
+
+	/**
+	 * Get the number of written records
+	 * @param writer Lines writer
+	 * @return Records written to disk
+	 */
+	virtual uint64_t LinesWriterGetWritten(JsonLinesWriter* writer) = 0;
+
+	/**
+	 * Release a lines writer, writing the remaining records first
+	 * @param writer Writer to release
+	 */
+	virtual void ReleaseLinesWriter(JsonLinesWriter* writer) = 0;
+
+	/**
+	 * Get the HandleType_t for lines writer handles
+	 * @return The HandleType_t for lines writer handles
+	 */
+	virtual HandleType_t GetLinesWriterHandleType() = 0;
+
+	/**
+	 * Read JsonLinesWriter from a SourceMod handle
+	 * @param pContext Plugin context
+	 * @param handle Handle to read from
+	 * @return JsonLinesWriter pointer, or nullptr on error
+	 */
+	virtual JsonLinesWriter* GetLinesWriterFromHandle(IPluginContext* pContext, Handle_t handle) = 0;
+
+	/**
+	 * Get file cache statistics
+	 * @param hits Receives the number of loads served from the cache (optional)
+	 * @param misses Receives the number of loads that had to read the file (optional)
+	 * @param entries Receives the number of cached files (optional)
+	 * @note Files are cached by loads with JSON_READ_CACHE, keyed by resolved path, size and modification time
+	 */
+	virtual void GetFileCacheStats(uint64_t* hits, uint64_t* misses, size_t* entries) = 0;
+
+	/**
+	 * Drop all cached file documents and reset the statistics
+	 * @note Documents still referenced by handles stay alive until those are released
+	 */
+	virtual void ClearFileCache() = 0;
+
+	/**
+	 * Write JSON into a caller buffer without the temporary space requirement of WriteToString()
+	 * @param handle JSON value
+	 * @param buffer Output buffer
+	 * @param buffer_size Buffer size
+	 * @param write_flg Write flags (YYJSON_WRITE_FLAG values, default: 0)
+	 * @param out_size Receives the size written, or the size needed when the buffer is too small (including null terminator) optional
+	 * @return true on success, false if serialization failed or the buffer is too small
+	 *
+	 * @note The value is written straight into the buffer when it has room for the temporary space,
+	 *       otherwise it is written to a reused scratch buffer and copied. No allocation is made once
+	 *       the scratch buffer has grown to the document size
+	 * @note Only call this from the main thread
+	 */
+	virtual bool WriteToBuffer(JsonValue* handle, char* buffer, size_t buffer_size,
+		uint32_t write_flg = 0, size_t* out_size = nullptr) = 0;
+
+	/**
+	 * Set the memory limit of the serialization cache
+	 * @param bytes Maximum number of bytes of cached output, 0 disables the cache and drops all entries
+	 *
+	 * @note While enabled, WriteToBuffer(), GetSerializedSize() and WriteToFile() keep their output per
+	 *       document, value and write flags, and reuse it until the document is modified.
+	 *       Least recently used entries are dropped to stay under the limit
+	 * @note Disabled by default. Only call this from the main thread
+	 */
+	virtual void SetWriteCacheLimit(size_t bytes) = 0;
+
+	/**
+	 * Get serialization cache statistics
+	 * @param hits Receives the number of writes served from the cache (optional)
+	 * @param misses Receives the number of writes that had to serialize (optional)
+	 * @param entries Receives the number of cached outputs (optional)
+	 * @param bytes Receives the number of cached bytes (optional)
+	 */
+	virtual void GetWriteCacheStats(uint64_t* hits, uint64_t* misses, size_t* entries, size_t* bytes) = 0;
+
+	/**
+	 * Drop all cached serialized output and reset the statistics, the memory limit is kept
+	 */
+	virtual void ClearWriteCache() = 0;
+
+	/**
+	 * Serialize a value in fixed-size chunks
+	 * @param handle JSON value, containers are written with all their children
+	 * @param sink Receives the chunks in order, all but the last are exactly chunk_size bytes
+	 * @param write_flg Write flags (YYJSON_WRITE_FLAG values)
+	 * @param chunk_size Chunk size in bytes (raised to 64)
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return true on success, false if serialization failed or the sink aborted
+	 *
+	 * @note The output is identical to WriteToString(), but only one chunk is kept in memory,
+	 *       so peak memory stays bounded by the chunk size rather than the document size
+	 * @note Chunks already handed to the sink are not taken back when a later value fails to serialize
+	 * @note The document is kept alive while the sink runs, so the sink may release the handle,
+	 *       but it must not modify the value being written
+	 */
+	virtual bool WriteChunked(JsonValue* handle, IJsonChunkSink* sink, uint32_t write_flg, size_t chunk_size,
+		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Write JSON to file in fixed-size chunks
+	 * @param handle JSON value, unlike WriteToFile() only this value and its children are written
+	 * @param path File path
+	 * @param write_flg Write flags (YYJSON_WRITE_FLAG values)
+	 * @param chunk_size Chunk size in bytes (raised to 64)
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return true on success
+	 */
+	virtual bool WriteToFileChunked(JsonValue* handle, const char* path, uint32_t write_flg, size_t chunk_size,
+		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Encode a value as MessagePack or CBOR
+	 * @param handle JSON value, containers are encoded with all their children
+	 * @param format Binary format
+	 * @param buffer Output buffer
+	 * @param buffer_size Buffer size
+	 * @param out_size Receives the size written, or the size needed when the buffer is too small (optional)
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return true on success, false if encoding failed or the buffer is too small
+	 *
+	 * @note Numbers keep their integer or real type, reals are stored as 32-bit floats when that is lossless.
+	 *       Raw values are encoded as strings
+	 */
+	virtual bool WriteBinary(JsonValue* handle, JSON_BINARY_FORMAT format, char* buffer, size_t buffer_size,
+		size_t* out_size = nullptr, char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Encode a value as MessagePack or CBOR to file
+	 * @param handle JSON value, unlike WriteToFile() only this value and its children are written
+	 * @param format Binary format
+	 * @param path File path, written gzip compressed when it ends in ".gz"
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return true on success
+	 */
+	virtual bool WriteBinaryToFile(JsonValue* handle, JSON_BINARY_FORMAT format, const char* path,
+		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Decode MessagePack or CBOR data into a document
+	 * @param data Encoded data
+	 * @param size Data size in bytes
+	 * @param format Binary format
+	 * @param is_mutable true to create a mutable document
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return JSON value or nullptr on error
+	 *
+	 * @note The data must hold exactly one value. Map keys must be strings, byte strings are read as
+	 *       strings and CBOR tags are ignored. MessagePack extension types are rejected
+	 */
+	virtual JsonValue* ParseBinary(const void* data, size_t size, JSON_BINARY_FORMAT format, bool is_mutable,
+		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Decode a MessagePack or CBOR file into a document
+	 * @param path File path, gzip compressed files are detected by their header
+	 * @param format Binary format
+	 * @param is_mutable true to create a mutable document
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return JSON value or nullptr on error
+	 */
+	virtual JsonValue* ParseBinaryFile(const char* path, JSON_BINARY_FORMAT format, bool is_mutable,
+		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Save a value as a snapshot file for LoadSnapshot()
+	 * @param handle JSON value, only this value and its children are saved
+	 * @param path File path, replaced atomically so a loaded snapshot of the same file stays intact
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return true on success
+	 *
+	 * @note Snapshots store the in-memory value layout. They can only be loaded by a build using the
+	 *       same yyjson version on a machine with the same byte order
+	 */
+	virtual bool SaveSnapshot(JsonValue* handle, const char* path, char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Load a snapshot file as an immutable document
+	 * @param path File path
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return JSON value or nullptr on error
+	 *
+	 * @note The file is memory mapped and used in place without parsing, the mapping is released with the document
+	 */
+	virtual JsonValue* LoadSnapshot(const char* path, char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Check whether a string is valid JSON without creating a document
+	 * @param str JSON string, null-terminated
+	 * @param read_flg Read flags (YYJSON_READ_FLAG values), YYJSON_READ_INSITU is ignored
+	 * @param out_type Receives the YYJSON_TYPE value of the root, YYJSON_TYPE_NONE if invalid
+	 * @param out_read_size Receives the number of bytes read, 0 if invalid
+	 * @param out_error_pos Receives the byte position of the error, 0 if valid
+	 * @return true if the string is valid JSON
+	 * @note Small strings are parsed into a reused per-thread block, so checking them does not allocate
+	 */
+	virtual bool ValidateJSON(const char* str, uint32_t read_flg, uint8_t* out_type, size_t* out_read_size,
+		size_t* out_error_pos) = 0;
+
+	/**
+	 * Read the value at a JSON Pointer from JSON text or a file, without parsing the whole text
+	 * @param source JSON string, or file path if is_file is true
+	 * @param is_file True to read source as a file path
+	 * @param pointer JSON Pointer path (e.g., "/version"), an empty path returns the root value
+	 * @param read_flg Read flags (YYJSON_READ_FLAG values, default: 0)
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return New immutable JSON value holding only the target, or nullptr on error
+	 * @note Values before the target are skipped by matching quotes and brackets and are not validated
+	 * @note Files are memory mapped, so only the part up to the end of the target is read. Gzip
+	 *       compressed files are decompressed as a whole first.
+	 */
+	virtual JsonValue* PeekPointer(const char* source, bool is_file, const char* pointer, uint32_t read_flg = 0,
+		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Parse JSON string or file with resource limits, for untrusted input
+	 * @param json_str JSON string or file path
+	 * @param is_file True if json_str is a file path
+	 * @param is_mutable True to create a mutable document
+	 * @param read_flg Read flags (YYJSON_READ_FLAG values)
+	 * @param limits Limits to enforce
+	 * @param out_exceeded Receives the limit that stopped the parse, JSON_LIMIT_NONE otherwise (optional)
+	 * @param error Error buffer (optional)
+	 * @param error_size Error buffer size
+	 * @return JSON value or nullptr on error
+	 * @note The input size is checked before the text is read, and the reader stops at the allocation
+	 *       that would exceed the memory limit. Depth and value count are checked right after the
+	 *       read, before a document is created from it.
+	 */
+	virtual JsonValue* ParseJSONLimited(const char* json_str, bool is_file, bool is_mutable, uint32_t read_flg,
+		const JsonParseLimits& limits, JSON_PARSE_LIMIT* out_exceeded = nullptr,
+		char* error = nullptr, size_t error_size = 0) = 0;
+
+	/**
+	 * Set the object size from which key lookups go through a hash index
+	 * @param min_keys Objects with at least this many keys get an index of their keys once 16 lookups
+	 *                 have scanned them, 0 disables indexing
+	 * @note Indexes of mutable objects are rebuilt after keys are added or removed other than through
+	 *       the Object* setters. Default is 64. Only call this from the main thread
+	 */
+	virtual void SetKeyIndexThreshold(size_t min_keys) = 0;
+
+	/**
+	 * Get key index statistics
+	 * @param indexes Receives the number of key indexes across all documents (optional)
+	 * @param bytes Receives the number of bytes they use (optional)
+	 */
+	virtual void GetKeyIndexStats(size_t* indexes, size_t* bytes) = 0;
+
+	/**
+	 * Create a cursor positioned on a value
+	 * @param handle JSON value, the cursor shares its document
+	 * @return New cursor or nullptr on error
+	 * @note Caller must release the cursor using ReleaseCursor()
+	 */
+	virtual JsonCursor* CursorCreate(JsonValue* handle) = 0;
+
+	/**
+	 * Move the cursor to a value of the current object
+	 * @param cursor Cursor
+	 * @param key Key name
+	 * @return true on success, false if the current value is not an object or has no such key
+	 * @note The cursor stays in place on failure
+	 */
+	virtual bool CursorEnter(JsonCursor* cursor, const char* key) = 0;
+
+	/**
+	 * Move the cursor to an element of the current array
+	 * @param cursor Cursor
+	 * @param index Element index
+	 * @return true on success, false if the current value is not an array or the index is out of range
+	 * @note The cursor stays in place on failure
+	 */
+	virtual bool CursorEnterIndex(JsonCursor* cursor, size_t index) = 0;
+
+	/**
+	 * Move the cursor to a value below the current one
+	 * @param cursor Cursor
+	 * @param path JSON Pointer relative to the current value
+	 * @return true on success, false if the path does not resolve
+	 * @note The cursor stays in place on failure
+	 */
+	virtual bool CursorPointer(JsonCursor* cursor, const char* path) = 0;
+
+	/**
+	 * Move the cursor back to where it was before its last successful move
+	 * @param cursor Cursor
+	 * @return true on success, false if the cursor is on the value it was created on
+	 */
+	virtual bool CursorParent(JsonCursor* cursor) = 0;
+
+	/**
+	 * Move the cursor back to the value it was created on
+	 * @param cursor Cursor
+	 */
+	virtual void CursorReset(JsonCursor* cursor) = 0;
+
+	/**
+	 * Get the number of moves Parent() can undo
+	 * @param cursor Cursor
+	 * @return Depth below the value the cursor was created on
+	 */
+	virtual size_t CursorGetDepth(JsonCursor* cursor) = 0;
+
+	/**
+	 * Get the value under the cursor for use with the other JSON functions
+	 * @param cursor Cursor
+	 * @return Current value, owned by the cursor and valid until it moves or is released
+	 * @note Do not release the returned value, use CursorGetValue() for a value of its own
+	 */
+	virtual JsonValue* CursorGetCurrent(JsonCursor* cursor) = 0;
+
+	/**
+	 * Get a new value referencing the value under the cursor
+	 * @param cursor Cursor
+	 * @return JSON value or nullptr on error
+	 * @note Caller must release the value
+	 */
+	virtual JsonValue* CursorGetValue(JsonCursor* cursor) = 0;
+
+	/**
+	 * Release a cursor
+	 * @param cursor Cursor to release
+	 */
+	virtual void ReleaseCursor(JsonCursor* cursor) = 0;
+
+	/**
+	 * Get the HandleType_t for cursor handles
+	 * @return The HandleType_t for cursor handles
+	 */
+	virtual HandleType_t GetCursorHandleType() = 0;
+
+	/**
+	 * Read JsonCursor from a SourceMod handle
+	 * @param pContext Plugin context
+	 * @param handle Handle to read from
+	 * @return JsonCursor pointer, or nullptr on error
+	 */
+	virtual JsonCursor* GetCursorFromHandle(IPluginContext* pContext, Handle_t handle) = 0;
+
+	/**
+	 * Check a node of an immutable value
+	 *
+	 * Nodes number the values below an immutable value by their offset from it, 0 being the value
+	 * itself. They stay valid for as long as the value, and reading them creates no JsonValue.
+	 *
+	 * @param handle JSON value
+	 * @param node Node to check
+	 * @return true if the value is immutable and the node is one of its values
+	 */
+	virtual bool IsValidNode(JsonValue* handle, int node) = 0;
+
+	/**
+	 * Get the node of a value of an object node
+	 * @param handle JSON value the node belongs to
+	 * @param node Object node
+	 * @param key Key name
+	 * @return Node of the value, or -1 if the node is invalid, not an object or has no such key
+	 */
+	virtual int NodeChild(JsonValue* handle, int node, const char* key) = 0;
+
+	/**
+	 * Get the node of an element of an array node
+	 * @param handle JSON value the node belongs to
+	 * @param node Array node
+	 * @param index Element index
+	 * @return Node of the element, or -1 if the node is invalid, not an array or the index is out of range
+	 */
+	virtual int NodeAt(JsonValue* handle, int node, size_t index) = 0;
+
+	/**
+	 * Get the node a JSON Pointer resolves to
+	 * @param handle JSON value the node belongs to
+	 * @param node Node the path starts from
+	 * @param path JSON Pointer relative to the node
+	 * @return Node of the value, or -1 if the node is invalid or the path does not resolve
+	 */
+	virtual int NodeFind(JsonValue* handle, int node, const char* path) = 0;
+
+	/**
+	 * Get the type of a node
+	 * @param handle JSON value the node belongs to
+	 * @param node Node
+	 * @return YYJSON_TYPE value, YYJSON_TYPE_NONE if the node is invalid
+	 */
+	virtual uint8_t NodeGetType(JsonValue* handle, int node) = 0;
+
+	/**
+	 * Get the number of elements or keys of a node
+	 * @param handle JSON value the node belongs to
+	 * @param node Array or object node
+	 * @return Size of the node, 0 for other values and invalid nodes
+	 */
+	virtual size_t NodeGetSize(JsonValue* handle, int node) = 0;
+
+	/**
+	 * Get the value of a boolean node
+	 * @param handle JSON value the node belongs to
+	 * @param node Node
+	 * @param out_value Pointer to store the value
+	 * @return true on success, false if the node is invalid or not a boolean
+	 */
+	virtual bool NodeGetBool(JsonValue* handle, int node, bool* out_value) = 0;
+
+	/**
+	 * Get the value of a number node
+	 * @param handle JSON value the node belongs to
+	 * @param node Node
+	 * @param out_value Pointer to store the value
+	 * @return true on success, false if the node is invalid or not a number
+	 */
+	virtual bool NodeGetDouble(JsonValue* handle, int node, double* out_value) = 0;
+
+	/**
+	 * Get the value of an integer node
+	 * @param handle JSON value the node belongs to
+	 * @param node Node
+	 * @param out_value Pointer to store the value
+	 * @return true on success, false if the node is invalid or not an integer
+	 */
+	virtual bool NodeGetInt(JsonValue* handle, int node, int* out_value) = 0;
+
+	/**
+	 * Get the value of an integer node as a 64-bit integer
+	 * @param handle JSON value the node belongs to
+	 * @param node Node
+	 * @param out_value Pointer to store the value (int64_t or uint64_t)
+	 * @return true on success, false if the node is invalid or not an integer
+	 */
+	virtual bool NodeGetInt64(JsonValue* handle, int node, std::variant<int64_t, uint64_t>* out_value) = 0;
+
+	/**
+	 * Get the value of a string node
+	 * @param handle JSON value the node belongs to
+	 * @param node Node
+	 * @param out_str Pointer to store the string, owned by the document
+	 * @param out_len Pointer to store the string length (optional)
+	 * @return true on success, false if the node is invalid or not a string
+	 */
+	virtual bool NodeGetString(JsonValue* handle, int node, const char** out_str, size_t* out_len) = 0;
+
+	/**
+	 * Check if a node is null
+	 * @param handle JSON value the node belongs to
+	 * @param node Node
+	 * @return true if the node is null, false otherwise or if the node is invalid
+	 */
+	virtual bool NodeIsNull(JsonValue* handle, int node) = 0;
+
+	/**
+	 * Get a value for a node, to use it with the other JSON functions
+	 * @param handle JSON value the node belongs to
+	 * @param node Node
+	 * @return JSON value or nullptr if the node is invalid
+	 * @note Caller must release the value
+	 */
+	virtual JsonValue* NodeGetValue(JsonValue* handle, int node) = 0;
 };
 
 #endif // _INCLUDE_IJSONMANAGER_H_
\ No newline at end of file
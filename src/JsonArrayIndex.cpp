@@ -0,0 +1,76 @@
+#include "JsonArrayIndex.h"
+
+JsonArrayIndex::JsonArrayIndex(yyjson_val* arr)
+{
+	m_offsets.reserve(unsafe_yyjson_get_len(arr));
+
+	yyjson_arr_iter iter = yyjson_arr_iter_with(arr);
+	yyjson_val* val;
+	while ((val = yyjson_arr_iter_next(&iter))) {
+		m_offsets.push_back(static_cast<uint32_t>(val - arr));
+	}
+}
+
+JsonArrayIndex::JsonArrayIndex(yyjson_mut_val* arr, uint64_t layout)
+	: m_layout(layout)
+{
+	m_vals.reserve(unsafe_yyjson_get_len(arr));
+
+	yyjson_mut_arr_iter iter = yyjson_mut_arr_iter_with(arr);
+	yyjson_mut_val* val;
+	while ((val = yyjson_mut_arr_iter_next(&iter))) {
+		m_vals.push_back(val);
+	}
+}
+
+yyjson_mut_val* JsonArrayIndex::Replace(yyjson_mut_val* arr, size_t index, yyjson_mut_val* val)
+{
+	yyjson_mut_val* old = m_vals[index];
+	if (m_vals.size() == 1) {
+		val->next = val;
+	} else {
+		Prev(arr, index)->next = val;
+		val->next = old->next;
+	}
+	if (old == arr->uni.ptr) {
+		arr->uni.ptr = val;
+	}
+
+	m_vals[index] = val;
+	return old;
+}
+
+void JsonArrayIndex::Insert(yyjson_mut_val* arr, size_t index, yyjson_mut_val* val)
+{
+	size_t len = m_vals.size();
+	if (len == 0) {
+		val->next = val;
+		arr->uni.ptr = val;
+	} else {
+		yyjson_mut_val* prev = Prev(arr, index);
+		val->next = prev->next;
+		prev->next = val;
+		if (index == len) {
+			arr->uni.ptr = val;
+		}
+	}
+	unsafe_yyjson_set_len(arr, len + 1);
+
+	m_vals.insert(m_vals.begin() + index, val);
+}
+
+yyjson_mut_val* JsonArrayIndex::Remove(yyjson_mut_val* arr, size_t index)
+{
+	yyjson_mut_val* old = m_vals[index];
+	if (m_vals.size() > 1) {
+		yyjson_mut_val* prev = Prev(arr, index);
+		prev->next = old->next;
+		if (old == arr->uni.ptr) {
+			arr->uni.ptr = prev;
+		}
+	}
+	unsafe_yyjson_set_len(arr, m_vals.size() - 1);
+
+	m_vals.erase(m_vals.begin() + index);
+	return old;
+}
@@ -0,0 +1,98 @@
+#ifndef _INCLUDE_JSONARRAYINDEX_H_
+#define _INCLUDE_JSONARRAYINDEX_H_
+
+#include <yyjson.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Table of the elements of one array by position
+ *
+ * A mutable array is a circular list, and an immutable array with containers in it stores every
+ * element after all values of the one before, so neither reaches an element without passing the
+ * previous ones. The table holds every element of a mutable array, or the offset of every element
+ * of an immutable array from the array itself.
+ *
+ * The table of a mutable array is valid for the document layout it was built at. Replace(), Insert()
+ * and Remove() relink the array through the table and keep it valid, any other change to the
+ * elements of an array has to change the layout of the document.
+ */
+class JsonArrayIndex
+{
+public:
+	explicit JsonArrayIndex(yyjson_val* arr);
+	JsonArrayIndex(yyjson_mut_val* arr, uint64_t layout);
+
+	JsonArrayIndex(const JsonArrayIndex&) = delete;
+	JsonArrayIndex& operator=(const JsonArrayIndex&) = delete;
+
+	/**
+	 * @return true if the elements of an immutable array can be stored as offsets
+	 */
+	static bool CanIndex(yyjson_val* arr)
+	{
+		return static_cast<size_t>(unsafe_yyjson_get_next(arr) - arr) <= UINT32_MAX;
+	}
+
+	/**
+	 * @return Element of the immutable array the index was built for
+	 */
+	yyjson_val* Get(yyjson_val* arr, size_t index) const { return arr + m_offsets[index]; }
+
+	/**
+	 * @return Element of the mutable array the index was built for
+	 */
+	yyjson_mut_val* GetMut(size_t index) const { return m_vals[index]; }
+
+	/**
+	 * @return true if no element was linked in or out since the index was built
+	 */
+	bool IsCurrent(uint64_t layout) const { return m_layout == layout; }
+
+	/**
+	 * Replace an element of a mutable array
+	 * @return Element that was replaced
+	 */
+	yyjson_mut_val* Replace(yyjson_mut_val* arr, size_t index, yyjson_mut_val* val);
+
+	/**
+	 * Insert an element into a mutable array, index may be the array size to append
+	 */
+	void Insert(yyjson_mut_val* arr, size_t index, yyjson_mut_val* val);
+
+	/**
+	 * Remove an element from a mutable array
+	 * @return Element that was removed
+	 */
+	yyjson_mut_val* Remove(yyjson_mut_val* arr, size_t index);
+
+private:
+	// Element before index, the last one for the first element
+	yyjson_mut_val* Prev(yyjson_mut_val* arr, size_t index) const
+	{
+		return index ? m_vals[index - 1] : static_cast<yyjson_mut_val*>(arr->uni.ptr);
+	}
+
+	std::vector<yyjson_mut_val*> m_vals;
+	std::vector<uint32_t> m_offsets;
+	uint64_t m_layout{ 0 };
+};
+
+/**
+ * @brief Element table of one array, built once enough accesses have walked the array
+ */
+struct JsonArrayIndexEntry
+{
+	std::unique_ptr<JsonArrayIndex> index;
+	uint32_t walks{ 0 };
+};
+
+/**
+ * @brief Indexes of the arrays of one document, by array value
+ */
+using JsonArrayIndexMap = std::unordered_map<const void*, JsonArrayIndexEntry>;
+
+#endif // _INCLUDE_JSONARRAYINDEX_H_
@@ -0,0 +1,185 @@
+#include "JsonAsync.h"
+#include <algorithm>
+
+JsonAsyncWorker g_JsonAsync;
+
+JsonAsyncWorker::~JsonAsyncWorker()
+{
+	Shutdown();
+}
+
+size_t JsonAsyncWorker::GetPoolSize()
+{
+	unsigned int cores = std::thread::hardware_concurrency();
+	return cores ? std::min<size_t>(cores, 16) : 2;
+}
+
+bool JsonAsyncWorker::Submit(std::unique_ptr<JsonAsyncTask> task)
+{
+	if (!task) {
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_shutdown) {
+		return false;
+	}
+
+	// Ordered work needs a single thread, the pool only grows once unordered work shows up
+	size_t wanted = task->m_ordered ? 1 : GetPoolSize();
+	while (m_threads.size() < wanted) {
+		m_threads.emplace_back(&JsonAsyncWorker::ThreadMain, this);
+	}
+
+	bool ordered = task->m_ordered;
+	m_pending.push_back(std::move(task));
+
+	if (ordered) {
+		m_cond.notify_one();
+	} else {
+		m_cond.notify_all();
+	}
+	return true;
+}
+
+std::deque<std::unique_ptr<JsonAsyncTask>>::iterator JsonAsyncWorker::FindRunnable()
+{
+	for (auto it = m_pending.begin(); it != m_pending.end(); ++it) {
+		if (!(*it)->m_ordered || !m_orderedRunning) {
+			return it;
+		}
+	}
+	return m_pending.end();
+}
+
+void JsonAsyncWorker::ThreadMain()
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	while (true) {
+		auto it = m_pending.end();
+		m_cond.wait(lock, [this, &it] {
+			if (m_shutdown) {
+				return true;
+			}
+			it = FindRunnable();
+			return it != m_pending.end();
+		});
+
+		if (m_shutdown) {
+			break;
+		}
+
+		std::unique_ptr<JsonAsyncTask> task = std::move(*it);
+		m_pending.erase(it);
+
+		bool ordered = task->m_ordered;
+		if (ordered) {
+			m_orderedRunning = true;
+		}
+		m_running.push_back(task.get());
+
+		lock.unlock();
+		task->Run();
+		lock.lock();
+
+		m_running.erase(std::find(m_running.begin(), m_running.end(), task.get()));
+		m_completed.push_back(std::move(task));
+		m_hasCompleted.store(true, std::memory_order_release);
+
+		// The next ordered task may be waiting for this one
+		if (ordered) {
+			m_orderedRunning = false;
+			m_cond.notify_all();
+		}
+	}
+}
+
+void JsonAsyncWorker::RunFrame()
+{
+	if (!m_hasCompleted.load(std::memory_order_acquire)) {
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_delivering.swap(m_completed);
+		m_hasCompleted.store(false, std::memory_order_relaxed);
+	}
+
+	// Callbacks may unload plugins, so the context is re-checked under the lock for every task
+	while (true) {
+		std::unique_ptr<JsonAsyncTask> task;
+		IPluginContext* pContext;
+		{
+			std::lock_guard<std::mutex> lock(m_lock);
+			if (m_delivering.empty()) {
+				break;
+			}
+			task = std::move(m_delivering.front());
+			m_delivering.pop_front();
+			pContext = task->m_pContext;
+		}
+
+		if (pContext) {
+			task->Complete(pContext);
+		}
+	}
+}
+
+void JsonAsyncWorker::Shutdown()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_shutdown = true;
+		m_cond.notify_all();
+	}
+
+	for (auto& thread : m_threads) {
+		if (thread.joinable()) {
+			thread.join();
+		}
+	}
+	m_threads.clear();
+
+	m_pending.clear();
+	m_completed.clear();
+	m_delivering.clear();
+	m_running.clear();
+	m_orderedRunning = false;
+	m_hasCompleted.store(false, std::memory_order_relaxed);
+}
+
+void JsonAsyncWorker::OnPluginUnloaded(IPlugin* plugin)
+{
+	IPluginContext* pContext = plugin->GetBaseContext();
+
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	for (auto it = m_pending.begin(); it != m_pending.end();) {
+		if ((*it)->m_pContext == pContext) {
+			it = m_pending.erase(it);
+		} else {
+			++it;
+		}
+	}
+
+	for (JsonAsyncTask* task : m_running) {
+		if (task->m_pContext == pContext) {
+			task->m_pContext = nullptr;
+		}
+	}
+
+	for (auto& task : m_completed) {
+		if (task->m_pContext == pContext) {
+			task->m_pContext = nullptr;
+		}
+	}
+
+	for (auto& task : m_delivering) {
+		if (task->m_pContext == pContext) {
+			task->m_pContext = nullptr;
+		}
+	}
+}
@@ -0,0 +1,98 @@
+#ifndef _INCLUDE_JSONASYNC_H_
+#define _INCLUDE_JSONASYNC_H_
+
+#include "smsdk_ext.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Unit of work executed by JsonAsyncWorker
+ *
+ * Run() is called on the worker thread and must not touch SourceMod or plugin state.
+ * Complete() is called on the game thread once Run() has finished, and is skipped
+ * when the owning plugin has been unloaded in the meantime.
+ */
+class JsonAsyncTask
+{
+public:
+	virtual ~JsonAsyncTask() = default;
+
+	virtual void Run() = 0;
+	virtual void Complete(IPluginContext* pContext) = 0;
+
+	// Owning plugin, cleared by the worker when the plugin unloads
+	IPluginContext* m_pContext{ nullptr };
+
+	// Ordered tasks run one at a time in submission order, unordered tasks may run concurrently
+	bool m_ordered{ true };
+};
+
+/**
+ * @brief Background worker pool for JSON tasks
+ *
+ * Ordered tasks are executed one at a time in submission order, so writes to the same file
+ * cannot overtake each other. Unordered tasks are spread over up to one thread per core.
+ * Threads are started on first use. Finished tasks are queued and delivered from the game frame hook.
+ */
+class JsonAsyncWorker : public IPluginsListener
+{
+public:
+	JsonAsyncWorker() = default;
+	~JsonAsyncWorker();
+
+	JsonAsyncWorker(const JsonAsyncWorker&) = delete;
+	JsonAsyncWorker& operator=(const JsonAsyncWorker&) = delete;
+
+	/**
+	 * Queue a task, starting worker threads on first use
+	 * @param task Task to run, ownership is taken
+	 * @return true if the task was queued
+	 */
+	bool Submit(std::unique_ptr<JsonAsyncTask> task);
+
+	/**
+	 * Deliver finished tasks, must be called from the game thread
+	 */
+	void RunFrame();
+
+	/**
+	 * Stop the worker threads and drop all queued tasks without completing them
+	 */
+	void Shutdown();
+
+	// IPluginsListener
+	void OnPluginUnloaded(IPlugin* plugin) override;
+
+	/**
+	 * @return Maximum number of worker threads
+	 */
+	static size_t GetPoolSize();
+
+private:
+	void ThreadMain();
+
+	// Returns the first pending task that may start now, or m_pending.end()
+	std::deque<std::unique_ptr<JsonAsyncTask>>::iterator FindRunnable();
+
+	std::mutex m_lock;
+	std::condition_variable m_cond;
+	std::vector<std::thread> m_threads;
+
+	std::deque<std::unique_ptr<JsonAsyncTask>> m_pending;
+	std::deque<std::unique_ptr<JsonAsyncTask>> m_completed;
+	std::deque<std::unique_ptr<JsonAsyncTask>> m_delivering;
+	std::vector<JsonAsyncTask*> m_running;
+	bool m_orderedRunning{ false };
+
+	std::atomic<bool> m_hasCompleted{ false };
+	bool m_shutdown{ false };
+};
+
+extern JsonAsyncWorker g_JsonAsync;
+
+#endif // _INCLUDE_JSONASYNC_H_
@@ -0,0 +1,865 @@
+#include "JsonBinary.h"
+#include "JsonFile.h"
+#include "JsonTreeWalk.h"
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+// CBOR major types
+const uint8_t CBOR_UINT = 0;
+const uint8_t CBOR_NEGINT = 1;
+const uint8_t CBOR_BYTES = 2;
+const uint8_t CBOR_TEXT = 3;
+const uint8_t CBOR_ARRAY = 4;
+const uint8_t CBOR_MAP = 5;
+const uint8_t CBOR_TAG = 6;
+const uint8_t CBOR_SIMPLE = 7;
+
+// Reals that survive a round trip through float are stored in half the space
+bool FitsFloat(double value)
+{
+	return value >= -FLT_MAX && value <= FLT_MAX && static_cast<double>(static_cast<float>(value)) == value;
+}
+
+uint32_t FloatBits(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+uint64_t DoubleBits(double value)
+{
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+double FloatFromBits(uint32_t bits)
+{
+	float value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+double DoubleFromBits(uint64_t bits)
+{
+	double value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+double HalfToDouble(uint16_t half)
+{
+	// As in RFC 8949 appendix D
+	int exp = (half >> 10) & 0x1f;
+	int mant = half & 0x3ff;
+	double value;
+	if (exp == 0) {
+		value = std::ldexp(mant, -24);
+	} else if (exp != 31) {
+		value = std::ldexp(mant + 1024, exp - 25);
+	} else {
+		value = mant == 0 ? INFINITY : NAN;
+	}
+	return (half & 0x8000) ? -value : value;
+}
+
+// Same header size as yyjson_mut_val_imut_copy, the values follow it in the same block
+const size_t DOC_HEADER_SIZE = (sizeof(yyjson_doc) + sizeof(yyjson_val) - 1) / sizeof(yyjson_val) * sizeof(yyjson_val);
+
+/**
+ * Single-pass decoder writing values straight into the layout of an immutable document
+ */
+class BinaryDecoder
+{
+public:
+	BinaryDecoder(const char* data, size_t size)
+		: m_begin(reinterpret_cast<const uint8_t*>(data)), m_cur(m_begin), m_end(m_begin + size), m_size(size) {}
+
+	~BinaryDecoder()
+	{
+		free(m_block);
+		free(m_pool);
+	}
+
+	BinaryDecoder(const BinaryDecoder&) = delete;
+	BinaryDecoder& operator=(const BinaryDecoder&) = delete;
+
+	template <bool Cbor>
+	yyjson_doc* Decode(const char** error, size_t* error_pos);
+
+private:
+	enum Item { ITEM_VALUE, ITEM_CONTAINER, ITEM_BREAK, ITEM_ERROR };
+
+	struct Frame
+	{
+		size_t start;      // Index of the container value
+		size_t remaining;  // Entries left in a definite-length container, keys and values counted separately
+		size_t entries;    // Entries read so far
+		bool is_map;
+		bool indefinite;
+	};
+
+	template <bool Cbor>
+	bool Run();
+	Item ReadMsgPack(yyjson_val* val);
+	Item ReadCbor(yyjson_val* val);
+	bool ReadCborArg(uint8_t info, uint64_t* out);
+	Item ReadCborChunks(uint8_t major, yyjson_val* val);
+	void CloseContainer();
+	bool ResizeValues(size_t capacity);
+
+	yyjson_val* Values() const
+	{
+		return reinterpret_cast<yyjson_val*>(m_block + DOC_HEADER_SIZE);
+	}
+
+	bool Need(uint64_t len)
+	{
+		if (len > static_cast<uint64_t>(m_end - m_cur)) {
+			Fail("unexpected end of data");
+			return false;
+		}
+		return true;
+	}
+
+	uint64_t TakeBigEndian(size_t size)
+	{
+		uint64_t value = 0;
+		for (size_t i = 0; i < size; i++) {
+			value = (value << 8) | m_cur[i];
+		}
+		m_cur += size;
+		return value;
+	}
+
+	Item Fail(const char* error)
+	{
+		m_error = error;
+		m_errorPos = static_cast<size_t>(m_cur - m_begin);
+		return ITEM_ERROR;
+	}
+
+	Item SetUint(yyjson_val* val, uint64_t value)
+	{
+		val->tag = YYJSON_TYPE_NUM | YYJSON_SUBTYPE_UINT;
+		val->uni.u64 = value;
+		return ITEM_VALUE;
+	}
+
+	Item SetInt(yyjson_val* val, int64_t value)
+	{
+		// Non-negative integers are unsigned, as the text reader produces them
+		if (value >= 0) {
+			return SetUint(val, static_cast<uint64_t>(value));
+		}
+		val->tag = YYJSON_TYPE_NUM | YYJSON_SUBTYPE_SINT;
+		val->uni.i64 = value;
+		return ITEM_VALUE;
+	}
+
+	Item SetReal(yyjson_val* val, double value)
+	{
+		val->tag = YYJSON_TYPE_NUM | YYJSON_SUBTYPE_REAL;
+		val->uni.f64 = value;
+		return ITEM_VALUE;
+	}
+
+	Item ReadSigned(yyjson_val* val, size_t size)
+	{
+		if (!Need(size)) {
+			return ITEM_ERROR;
+		}
+		// Sign-extend from the top bit of the stored size
+		uint64_t sign = uint64_t(1) << (size * 8 - 1);
+		return SetInt(val, static_cast<int64_t>((TakeBigEndian(size) ^ sign) - sign));
+	}
+
+	Item ReadString(yyjson_val* val, uint64_t len)
+	{
+		if (!Need(len)) {
+			return ITEM_ERROR;
+		}
+		char* str = m_pool + m_poolUsed;
+		memcpy(str, m_cur, static_cast<size_t>(len));
+		str[len] = '\0';
+		m_cur += len;
+		m_poolUsed += static_cast<size_t>(len) + 1;
+
+		val->tag = (len << YYJSON_TAG_BIT) | YYJSON_TYPE_STR;
+		val->uni.str = str;
+		return ITEM_VALUE;
+	}
+
+	Item SetContainer(yyjson_val* val, bool is_map, uint64_t count, bool indefinite)
+	{
+		// Every entry takes at least one byte, which rejects bogus counts before anything is allocated
+		uint64_t left = static_cast<uint64_t>(m_end - m_cur);
+		if (count > left || (is_map && count * 2 > left)) {
+			return Fail("unexpected end of data");
+		}
+		val->tag = is_map ? YYJSON_TYPE_OBJ : YYJSON_TYPE_ARR;
+		m_count = static_cast<size_t>(count);
+		m_indefinite = indefinite;
+		return ITEM_CONTAINER;
+	}
+
+	const uint8_t* m_begin;
+	const uint8_t* m_cur;
+	const uint8_t* m_end;
+	size_t m_size;
+
+	// Document header followed by the values
+	char* m_block{ nullptr };
+	size_t m_valCount{ 0 };
+	size_t m_valCapacity{ 0 };
+
+	char* m_pool{ nullptr };
+	size_t m_poolUsed{ 0 };
+
+	std::vector<Frame> m_stack;
+
+	// Entries of the last container header read
+	size_t m_count{ 0 };
+	bool m_indefinite{ false };
+
+	const char* m_error{ "" };
+	size_t m_errorPos{ 0 };
+};
+
+BinaryDecoder::Item BinaryDecoder::ReadMsgPack(yyjson_val* val)
+{
+	if (m_cur == m_end) {
+		return Fail("unexpected end of data");
+	}
+
+	uint8_t b = *m_cur++;
+
+	if (b <= 0x7f) {
+		return SetUint(val, b);
+	}
+	if (b >= 0xe0) {
+		return SetInt(val, static_cast<int8_t>(b));
+	}
+	if (b <= 0x8f) {
+		return SetContainer(val, true, b & 0x0f, false);
+	}
+	if (b <= 0x9f) {
+		return SetContainer(val, false, b & 0x0f, false);
+	}
+	if (b <= 0xbf) {
+		return ReadString(val, b & 0x1f);
+	}
+
+	// Size of the argument following the lead byte
+	size_t size;
+
+	switch (b) {
+	case 0xc0:
+		val->tag = YYJSON_TYPE_NULL;
+		return ITEM_VALUE;
+	case 0xc2:
+	case 0xc3:
+		val->tag = YYJSON_TYPE_BOOL | (b == 0xc3 ? YYJSON_SUBTYPE_TRUE : YYJSON_SUBTYPE_FALSE);
+		return ITEM_VALUE;
+	case 0xc4:
+	case 0xc5:
+	case 0xc6:
+	case 0xd9:
+	case 0xda:
+	case 0xdb:
+		// Binary data has no JSON equivalent and is read as a string
+		size = size_t(1) << (b >= 0xd9 ? b - 0xd9 : b - 0xc4);
+		if (!Need(size)) {
+			return ITEM_ERROR;
+		}
+		return ReadString(val, TakeBigEndian(size));
+	case 0xca:
+		if (!Need(4)) {
+			return ITEM_ERROR;
+		}
+		return SetReal(val, FloatFromBits(static_cast<uint32_t>(TakeBigEndian(4))));
+	case 0xcb:
+		if (!Need(8)) {
+			return ITEM_ERROR;
+		}
+		return SetReal(val, DoubleFromBits(TakeBigEndian(8)));
+	case 0xcc:
+	case 0xcd:
+	case 0xce:
+	case 0xcf:
+		size = size_t(1) << (b - 0xcc);
+		if (!Need(size)) {
+			return ITEM_ERROR;
+		}
+		return SetUint(val, TakeBigEndian(size));
+	case 0xd0:
+	case 0xd1:
+	case 0xd2:
+	case 0xd3:
+		return ReadSigned(val, size_t(1) << (b - 0xd0));
+	case 0xdc:
+	case 0xdd:
+	case 0xde:
+	case 0xdf:
+		size = (b & 1) ? 4 : 2;
+		if (!Need(size)) {
+			return ITEM_ERROR;
+		}
+		return SetContainer(val, b >= 0xde, TakeBigEndian(size), false);
+	case 0xc1:
+		m_cur--;
+		return Fail("invalid byte 0xc1");
+	default:
+		m_cur--;
+		return Fail("extension types are not supported");
+	}
+}
+
+bool BinaryDecoder::ReadCborArg(uint8_t info, uint64_t* out)
+{
+	if (info < 24) {
+		*out = info;
+		return true;
+	}
+	if (info <= 27) {
+		size_t size = size_t(1) << (info - 24);
+		if (!Need(size)) {
+			return false;
+		}
+		*out = TakeBigEndian(size);
+		return true;
+	}
+	m_cur--;
+	Fail("invalid additional information");
+	return false;
+}
+
+BinaryDecoder::Item BinaryDecoder::ReadCborChunks(uint8_t major, yyjson_val* val)
+{
+	// Chunks are joined in the pool, they take less room there than their headers took in the input
+	char* str = m_pool + m_poolUsed;
+	size_t len = 0;
+
+	for (;;) {
+		if (m_cur == m_end) {
+			return Fail("unexpected end of data");
+		}
+
+		uint8_t lead = *m_cur++;
+		if (lead == 0xff) {
+			break;
+		}
+
+		// Chunks are definite-length strings of the same type
+		uint64_t size;
+		if ((lead >> 5) != major || (lead & 0x1f) == 31) {
+			m_cur--;
+			return Fail("invalid string chunk");
+		}
+		if (!ReadCborArg(lead & 0x1f, &size) || !Need(size)) {
+			return ITEM_ERROR;
+		}
+		memcpy(str + len, m_cur, static_cast<size_t>(size));
+		m_cur += size;
+		len += static_cast<size_t>(size);
+	}
+
+	str[len] = '\0';
+	m_poolUsed += len + 1;
+
+	val->tag = (static_cast<uint64_t>(len) << YYJSON_TAG_BIT) | YYJSON_TYPE_STR;
+	val->uni.str = str;
+	return ITEM_VALUE;
+}
+
+BinaryDecoder::Item BinaryDecoder::ReadCbor(yyjson_val* val)
+{
+	for (;;) {
+		if (m_cur == m_end) {
+			return Fail("unexpected end of data");
+		}
+
+		uint8_t lead = *m_cur++;
+		uint8_t major = lead >> 5;
+		uint8_t info = lead & 0x1f;
+
+		if (major == CBOR_SIMPLE) {
+			switch (info) {
+			case 20:
+			case 21:
+				val->tag = YYJSON_TYPE_BOOL | (info == 21 ? YYJSON_SUBTYPE_TRUE : YYJSON_SUBTYPE_FALSE);
+				return ITEM_VALUE;
+			case 22:
+			case 23:
+				// undefined has no JSON equivalent either
+				val->tag = YYJSON_TYPE_NULL;
+				return ITEM_VALUE;
+			case 25:
+				if (!Need(2)) {
+					return ITEM_ERROR;
+				}
+				return SetReal(val, HalfToDouble(static_cast<uint16_t>(TakeBigEndian(2))));
+			case 26:
+				if (!Need(4)) {
+					return ITEM_ERROR;
+				}
+				return SetReal(val, FloatFromBits(static_cast<uint32_t>(TakeBigEndian(4))));
+			case 27:
+				if (!Need(8)) {
+					return ITEM_ERROR;
+				}
+				return SetReal(val, DoubleFromBits(TakeBigEndian(8)));
+			case 31:
+				return ITEM_BREAK;
+			default:
+				m_cur--;
+				return Fail("unsupported simple value");
+			}
+		}
+
+		if (info == 31) {
+			switch (major) {
+			case CBOR_BYTES:
+			case CBOR_TEXT:
+				return ReadCborChunks(major, val);
+			case CBOR_ARRAY:
+			case CBOR_MAP:
+				return SetContainer(val, major == CBOR_MAP, 0, true);
+			default:
+				m_cur--;
+				return Fail("invalid indefinite length");
+			}
+		}
+
+		uint64_t arg;
+		if (!ReadCborArg(info, &arg)) {
+			return ITEM_ERROR;
+		}
+
+		switch (major) {
+		case CBOR_UINT:
+			return SetUint(val, arg);
+		case CBOR_NEGINT:
+			// -1 - arg, which only fits a double below INT64_MIN
+			if (arg <= static_cast<uint64_t>(INT64_MAX)) {
+				return SetInt(val, -1 - static_cast<int64_t>(arg));
+			}
+			return SetReal(val, -1.0 - static_cast<double>(arg));
+		case CBOR_BYTES:
+		case CBOR_TEXT:
+			return ReadString(val, arg);
+		case CBOR_ARRAY:
+		case CBOR_MAP:
+			return SetContainer(val, major == CBOR_MAP, arg, false);
+		case CBOR_TAG:
+		default:
+			// Tags only add meaning to the item that follows, which is read as is
+			break;
+		}
+	}
+}
+
+void BinaryDecoder::CloseContainer()
+{
+	const Frame& frame = m_stack.back();
+	yyjson_val* ctn = Values() + frame.start;
+	uint64_t len = frame.is_map ? frame.entries / 2 : frame.entries;
+	ctn->tag = (len << YYJSON_TAG_BIT) | (frame.is_map ? YYJSON_TYPE_OBJ : YYJSON_TYPE_ARR);
+	ctn->uni.ofs = (m_valCount - frame.start) * sizeof(yyjson_val);
+	m_stack.pop_back();
+}
+
+bool BinaryDecoder::ResizeValues(size_t capacity)
+{
+	// Containers store relative offsets and strings live in the pool, so the values can move
+	char* block = static_cast<char*>(realloc(m_block, DOC_HEADER_SIZE + capacity * sizeof(yyjson_val)));
+	if (!block) {
+		return false;
+	}
+	m_block = block;
+	m_valCapacity = capacity;
+	return true;
+}
+
+template <bool Cbor>
+bool BinaryDecoder::Run()
+{
+	for (;;) {
+		if (m_valCount == m_valCapacity) {
+			// Every value takes at least one byte, so this never grows past the input size
+			size_t capacity = m_valCapacity + m_valCapacity / 2 + 16;
+			if (!ResizeValues(capacity < m_size + 1 ? capacity : m_size + 1)) {
+				Fail("memory allocation failed");
+				return false;
+			}
+		}
+
+		yyjson_val* val = Values() + m_valCount;
+		Item item = Cbor ? ReadCbor(val) : ReadMsgPack(val);
+
+		if (item == ITEM_ERROR) {
+			return false;
+		}
+
+		if (item == ITEM_BREAK) {
+			// Only indefinite-length containers end with a break, objects only between pairs
+			if (m_stack.empty() || !m_stack.back().indefinite || (m_stack.back().is_map && (m_stack.back().entries & 1))) {
+				Fail("unexpected break");
+				return false;
+			}
+			CloseContainer();
+		} else {
+			if (!m_stack.empty() && m_stack.back().is_map && !(m_stack.back().entries & 1) && !unsafe_yyjson_is_str(val)) {
+				Fail("object key is not a string");
+				return false;
+			}
+
+			m_valCount++;
+
+			if (item == ITEM_CONTAINER) {
+				if (m_indefinite || m_count > 0) {
+					bool is_map = unsafe_yyjson_is_obj(val);
+					m_stack.push_back({ m_valCount - 1, is_map ? m_count * 2 : m_count, 0, is_map, m_indefinite });
+					continue;
+				}
+				val->uni.ofs = sizeof(yyjson_val);
+			}
+		}
+
+		// The value is complete, which may complete the containers around it as well
+		for (;;) {
+			if (m_stack.empty()) {
+				if (m_cur != m_end) {
+					Fail("unexpected data after the root value");
+					return false;
+				}
+				return true;
+			}
+
+			Frame& frame = m_stack.back();
+			frame.entries++;
+			if (frame.indefinite || --frame.remaining > 0) {
+				break;
+			}
+			CloseContainer();
+		}
+	}
+}
+
+template <bool Cbor>
+yyjson_doc* BinaryDecoder::Decode(const char** error, size_t* error_pos)
+{
+	// Values usually take a few bytes each, strings never take more pool space than input
+	size_t capacity = m_size / 4 + 16;
+	m_pool = static_cast<char*>(malloc(m_size + 1));
+
+	if (!m_pool || !ResizeValues(capacity < m_size + 1 ? capacity : m_size + 1)) {
+		Fail("memory allocation failed");
+	} else if (Run<Cbor>()) {
+		if (m_valCapacity > m_valCount + m_valCount / 4 + 16) {
+			ResizeValues(m_valCount);
+		}
+
+		yyjson_doc* doc = reinterpret_cast<yyjson_doc*>(m_block);
+		memset(doc, 0, sizeof(yyjson_doc));
+		doc->root = Values();
+		doc->alc = g_LibcAllocator;
+		doc->dat_read = m_size;
+		doc->val_read = m_valCount;
+		if (m_poolUsed > 0) {
+			doc->str_pool = m_pool;
+			m_pool = nullptr;
+		}
+		m_block = nullptr;
+		return doc;
+	}
+
+	*error = m_error;
+	*error_pos = m_errorPos;
+	return nullptr;
+}
+
+} // namespace
+
+JsonBinaryWriter::JsonBinaryWriter(IJsonChunkSink* sink, JSON_BINARY_FORMAT format)
+	: m_sink(sink), m_format(format)
+{
+	m_buf.resize(FLUSH_SIZE + MAX_HEAD_SIZE + 1);
+}
+
+bool JsonBinaryWriter::Write(const yyjson_val* val)
+{
+	m_used = 0;
+	m_written = 0;
+	m_error = "";
+
+	if (!val) {
+		m_error = "input JSON is NULL";
+		return false;
+	}
+	bool ok = m_format == JSON_BINARY_CBOR ? WriteRoot<true>(val) : WriteRoot<false>(val);
+	return ok && Flush();
+}
+
+bool JsonBinaryWriter::Write(const yyjson_mut_val* val)
+{
+	m_used = 0;
+	m_written = 0;
+	m_error = "";
+
+	if (!val) {
+		m_error = "input JSON is NULL";
+		return false;
+	}
+	bool ok = m_format == JSON_BINARY_CBOR ? WriteRoot<true>(val) : WriteRoot<false>(val);
+	return ok && Flush();
+}
+
+template <bool Cbor, typename Val>
+bool JsonBinaryWriter::WriteRoot(const Val* root)
+{
+	struct Frame {
+		const Val* next;
+		size_t remaining;  // Keys and values counted separately
+	};
+
+	// Both formats prefix containers with their size, so children follow in plain document order
+	std::vector<Frame> stack;
+	const Val* val = root;
+
+	for (;;) {
+		// Below FLUSH_SIZE there is always room for the header of the next item
+		if (m_used >= FLUSH_SIZE && !Flush()) {
+			return false;
+		}
+
+		// Scalars and container headers share the layout of yyjson_val, as in JsonChunkWriter
+		if (!PutValue<Cbor>(reinterpret_cast<const yyjson_val*>(val))) {
+			return false;
+		}
+
+		void* raw = const_cast<Val*>(val);
+		if (unsafe_yyjson_is_ctn(raw) && unsafe_yyjson_get_len(raw) > 0) {
+			size_t len = unsafe_yyjson_get_len(raw);
+			stack.push_back({ JsonFirstChild(val), unsafe_yyjson_is_obj(raw) ? len * 2 : len });
+		}
+
+		while (!stack.empty() && stack.back().remaining == 0) {
+			stack.pop_back();
+		}
+
+		if (stack.empty()) {
+			return true;
+		}
+
+		Frame& frame = stack.back();
+		val = frame.next;
+		frame.next = JsonNextSibling(val);
+		frame.remaining--;
+	}
+}
+
+template <bool Cbor>
+bool JsonBinaryWriter::PutValue(const yyjson_val* val)
+{
+	void* raw = const_cast<yyjson_val*>(val);
+
+	switch (unsafe_yyjson_get_type(raw)) {
+	case YYJSON_TYPE_NULL:
+		m_buf[m_used++] = Cbor ? '\xf6' : '\xc0';
+		return true;
+	case YYJSON_TYPE_BOOL:
+		if (Cbor) {
+			m_buf[m_used++] = unsafe_yyjson_get_bool(raw) ? '\xf5' : '\xf4';
+		} else {
+			m_buf[m_used++] = unsafe_yyjson_get_bool(raw) ? '\xc3' : '\xc2';
+		}
+		return true;
+	case YYJSON_TYPE_NUM:
+		switch (unsafe_yyjson_get_subtype(raw)) {
+		case YYJSON_SUBTYPE_UINT:
+			PutUint<Cbor>(unsafe_yyjson_get_uint(raw));
+			break;
+		case YYJSON_SUBTYPE_SINT:
+			PutSint<Cbor>(unsafe_yyjson_get_sint(raw));
+			break;
+		default:
+			PutReal<Cbor>(unsafe_yyjson_get_real(raw));
+			break;
+		}
+		return true;
+	case YYJSON_TYPE_STR:
+		return PutString<Cbor>(unsafe_yyjson_get_str(raw), unsafe_yyjson_get_len(raw));
+	case YYJSON_TYPE_RAW:
+		// Raw numbers keep their digits as a string, the formats have no arbitrary precision number
+		return PutString<Cbor>(unsafe_yyjson_get_raw(raw), unsafe_yyjson_get_len(raw));
+	case YYJSON_TYPE_ARR:
+	case YYJSON_TYPE_OBJ:
+		PutContainer<Cbor>(unsafe_yyjson_is_obj(raw), unsafe_yyjson_get_len(raw));
+		return true;
+	default:
+		m_error = "invalid JSON value type";
+		return false;
+	}
+}
+
+template <bool Cbor>
+void JsonBinaryWriter::PutUint(uint64_t value)
+{
+	if (Cbor) {
+		PutCborHead(CBOR_UINT, value);
+	} else if (value < 0x80) {
+		m_buf[m_used++] = static_cast<char>(value);
+	} else if (value <= UINT8_MAX) {
+		PutBigEndian<1>(0xcc, value);
+	} else if (value <= UINT16_MAX) {
+		PutBigEndian<2>(0xcd, value);
+	} else if (value <= UINT32_MAX) {
+		PutBigEndian<4>(0xce, value);
+	} else {
+		PutBigEndian<8>(0xcf, value);
+	}
+}
+
+template <bool Cbor>
+void JsonBinaryWriter::PutSint(int64_t value)
+{
+	if (value >= 0) {
+		PutUint<Cbor>(static_cast<uint64_t>(value));
+	} else if (Cbor) {
+		PutCborHead(CBOR_NEGINT, static_cast<uint64_t>(-(value + 1)));
+	} else if (value >= -32) {
+		m_buf[m_used++] = static_cast<char>(value);
+	} else if (value >= INT8_MIN) {
+		PutBigEndian<1>(0xd0, static_cast<uint64_t>(value));
+	} else if (value >= INT16_MIN) {
+		PutBigEndian<2>(0xd1, static_cast<uint64_t>(value));
+	} else if (value >= INT32_MIN) {
+		PutBigEndian<4>(0xd2, static_cast<uint64_t>(value));
+	} else {
+		PutBigEndian<8>(0xd3, static_cast<uint64_t>(value));
+	}
+}
+
+template <bool Cbor>
+void JsonBinaryWriter::PutReal(double value)
+{
+	if (FitsFloat(value)) {
+		PutBigEndian<4>(Cbor ? 0xfa : 0xca, FloatBits(static_cast<float>(value)));
+	} else {
+		PutBigEndian<8>(Cbor ? 0xfb : 0xcb, DoubleBits(value));
+	}
+}
+
+template <bool Cbor>
+bool JsonBinaryWriter::PutString(const char* str, size_t len)
+{
+	if (Cbor) {
+		PutCborHead(CBOR_TEXT, len);
+	} else if (len < 32) {
+		m_buf[m_used++] = static_cast<char>(0xa0 | len);
+	} else if (len <= UINT8_MAX) {
+		PutBigEndian<1>(0xd9, len);
+	} else if (len <= UINT16_MAX) {
+		PutBigEndian<2>(0xda, len);
+	} else {
+		PutBigEndian<4>(0xdb, len);
+	}
+	return PutBytes(str, len);
+}
+
+template <bool Cbor>
+void JsonBinaryWriter::PutContainer(bool is_obj, size_t len)
+{
+	if (Cbor) {
+		PutCborHead(is_obj ? CBOR_MAP : CBOR_ARRAY, len);
+	} else if (len < 16) {
+		m_buf[m_used++] = static_cast<char>((is_obj ? 0x80 : 0x90) | len);
+	} else if (len <= UINT16_MAX) {
+		PutBigEndian<2>(is_obj ? 0xde : 0xdc, len);
+	} else {
+		PutBigEndian<4>(is_obj ? 0xdf : 0xdd, len);
+	}
+}
+
+void JsonBinaryWriter::PutCborHead(uint8_t major, uint64_t arg)
+{
+	uint8_t lead = static_cast<uint8_t>(major << 5);
+	if (arg < 24) {
+		m_buf[m_used++] = static_cast<char>(lead | arg);
+	} else if (arg <= UINT8_MAX) {
+		PutBigEndian<1>(lead | 24, arg);
+	} else if (arg <= UINT16_MAX) {
+		PutBigEndian<2>(lead | 25, arg);
+	} else if (arg <= UINT32_MAX) {
+		PutBigEndian<4>(lead | 26, arg);
+	} else {
+		PutBigEndian<8>(lead | 27, arg);
+	}
+}
+
+template <size_t Size>
+void JsonBinaryWriter::PutBigEndian(uint8_t lead, uint64_t value)
+{
+	// A constant size lets the compiler turn this into a single byte-swapped store
+	char* out = &m_buf[m_used];
+	out[0] = static_cast<char>(lead);
+	for (size_t i = Size; i > 0; i--) {
+		out[i] = static_cast<char>(value & 0xff);
+		value >>= 8;
+	}
+	m_used += Size + 1;
+}
+
+bool JsonBinaryWriter::PutBytes(const char* data, size_t len)
+{
+	// Long strings fill the buffer up to its end and continue in the next chunk
+	size_t room = FLUSH_SIZE + MAX_HEAD_SIZE - m_used;
+	while (len > room) {
+		memcpy(&m_buf[m_used], data, room);
+		m_used += room;
+		data += room;
+		len -= room;
+		if (!Flush()) {
+			return false;
+		}
+		room = FLUSH_SIZE + MAX_HEAD_SIZE;
+	}
+
+	memcpy(&m_buf[m_used], data, len);
+	m_used += len;
+	return true;
+}
+
+bool JsonBinaryWriter::Flush()
+{
+	if (m_used == 0) {
+		return true;
+	}
+
+	m_buf[m_used] = '\0';
+	if (!m_sink->WriteChunk(m_buf.data(), m_used)) {
+		m_error = "Write aborted by the chunk receiver";
+		return false;
+	}
+
+	m_written += m_used;
+	m_used = 0;
+	return true;
+}
+
+yyjson_doc* ReadBinaryDocument(const char* data, size_t size, JSON_BINARY_FORMAT format,
+	const char** error, size_t* error_pos)
+{
+	BinaryDecoder decoder(data, size);
+	if (format == JSON_BINARY_CBOR) {
+		return decoder.Decode<true>(error, error_pos);
+	}
+	return decoder.Decode<false>(error, error_pos);
+}
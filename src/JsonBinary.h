@@ -0,0 +1,89 @@
+#ifndef _INCLUDE_JSONBINARY_H_
+#define _INCLUDE_JSONBINARY_H_
+
+#include <IJsonManager.h>
+#include <yyjson.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief MessagePack and CBOR encoder handing its output to a chunk sink
+ *
+ * Walks the value itself, so numbers and strings are copied as they are, without the formatting
+ * and escaping of the text writer. Output is passed to the sink every FLUSH_SIZE bytes.
+ */
+class JsonBinaryWriter
+{
+public:
+	static constexpr size_t FLUSH_SIZE = 64 * 1024;
+
+	JsonBinaryWriter(IJsonChunkSink* sink, JSON_BINARY_FORMAT format);
+
+	JsonBinaryWriter(const JsonBinaryWriter&) = delete;
+	JsonBinaryWriter& operator=(const JsonBinaryWriter&) = delete;
+
+	/**
+	 * Encode a value and flush the remaining output
+	 * @param val Value to write, containers are written with all their children
+	 * @return false if the value cannot be encoded or the sink aborted, see GetError()
+	 */
+	bool Write(const yyjson_val* val);
+	bool Write(const yyjson_mut_val* val);
+
+	const char* GetError() const { return m_error; }
+	uint64_t GetWritten() const { return m_written; }
+
+private:
+	// Longest item header of both formats: one lead byte and a 64-bit argument
+	static constexpr size_t MAX_HEAD_SIZE = 9;
+
+	// The format is a template argument so that the per-value encoding does not branch on it
+	template <bool Cbor, typename Val>
+	bool WriteRoot(const Val* root);
+	template <bool Cbor>
+	bool PutValue(const yyjson_val* val);
+	template <bool Cbor>
+	void PutUint(uint64_t value);
+	template <bool Cbor>
+	void PutSint(int64_t value);
+	template <bool Cbor>
+	void PutReal(double value);
+	template <bool Cbor>
+	bool PutString(const char* str, size_t len);
+	template <bool Cbor>
+	void PutContainer(bool is_obj, size_t len);
+	void PutCborHead(uint8_t major, uint64_t arg);
+	template <size_t Size>
+	void PutBigEndian(uint8_t lead, uint64_t value);
+	bool PutBytes(const char* data, size_t len);
+	bool Flush();
+
+	IJsonChunkSink* m_sink;
+	JSON_BINARY_FORMAT m_format;
+
+	// Room for a full chunk, the header that may follow it and the terminator passed to the sink
+	std::vector<char> m_buf;
+	size_t m_used{ 0 };
+
+	uint64_t m_written{ 0 };
+	const char* m_error{ "" };
+};
+
+/**
+ * @brief Decode MessagePack or CBOR data into an immutable document
+ *
+ * Values are decoded in one pass straight into the value array of the document, laid out as
+ * yyjson's own reader would. Strings are copied into a pool sized from the input, which always
+ * has room since every string is preceded by at least one header byte.
+ *
+ * @param data Encoded data, exactly one value
+ * @param size Data size in bytes
+ * @param format Binary format
+ * @param error Receives the error message on failure
+ * @param error_pos Receives the byte offset of the error on failure
+ * @return Document allocated with the libc allocator, or nullptr on error
+ */
+yyjson_doc* ReadBinaryDocument(const char* data, size_t size, JSON_BINARY_FORMAT format,
+	const char** error, size_t* error_pos);
+
+#endif // _INCLUDE_JSONBINARY_H_
@@ -0,0 +1,310 @@
+#include "JsonChunkWriter.h"
+#include "JsonTreeWalk.h"
+#include <cmath>
+#include <cstring>
+
+namespace {
+
+const char SPACES[] = "                                                                ";
+
+// Shortest double output, where yyjson_write_number matches the writer and the flags only matter for NaN/Inf
+bool IsShortestReal(const yyjson_val* val, yyjson_write_flag write_flg)
+{
+	uint64_t fmt = (val->tag >> 32) | write_flg;
+	return !(fmt >> (32 - YYJSON_WRITE_FP_FLAG_BITS)) && std::isfinite(val->uni.f64);
+}
+
+bool IsUtf8Continuation(char c)
+{
+	return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+}
+
+} // namespace
+
+JsonChunkWriter::JsonChunkWriter(IJsonChunkSink* sink, size_t chunk_size)
+	: m_sink(sink)
+{
+	if (chunk_size < MIN_CHUNK_SIZE) {
+		chunk_size = MIN_CHUNK_SIZE;
+	}
+
+	// One spare byte keeps every chunk null-terminated for the sink
+	m_chunk.resize(chunk_size + 1);
+
+	// A string slice escapes to at most 6 bytes per input byte, plus quotes and the writer's terminator
+	m_sliceSize = chunk_size / 8;
+	m_scratch.resize(m_sliceSize * 6 + 4);
+}
+
+bool JsonChunkWriter::Write(const yyjson_val* val, yyjson_write_flag write_flg)
+{
+	m_writeFlg = write_flg & ~YYJSON_WRITE_NEWLINE_AT_END;
+	m_used = 0;
+	m_written = 0;
+	m_error = "";
+
+	if (!val) {
+		m_error = "input JSON is NULL";
+		return false;
+	}
+
+	if (!WriteRoot(val)) {
+		return false;
+	}
+	if ((write_flg & YYJSON_WRITE_NEWLINE_AT_END) && !Put("\n", 1)) {
+		return false;
+	}
+	return Flush();
+}
+
+bool JsonChunkWriter::Write(const yyjson_mut_val* val, yyjson_write_flag write_flg)
+{
+	m_writeFlg = write_flg & ~YYJSON_WRITE_NEWLINE_AT_END;
+	m_used = 0;
+	m_written = 0;
+	m_error = "";
+
+	if (!val) {
+		m_error = "input JSON is NULL";
+		return false;
+	}
+
+	if (!WriteRoot(val)) {
+		return false;
+	}
+	if ((write_flg & YYJSON_WRITE_NEWLINE_AT_END) && !Put("\n", 1)) {
+		return false;
+	}
+	return Flush();
+}
+
+template <typename Val>
+bool JsonChunkWriter::WriteRoot(const Val* root)
+{
+	struct Frame {
+		const Val* next;
+		size_t remaining;
+		bool is_obj;
+		bool first;
+	};
+
+	// Same layout as the yyjson pretty writer: one item per line, ": " after keys
+	bool pretty = (m_writeFlg & (YYJSON_WRITE_PRETTY | YYJSON_WRITE_PRETTY_TWO_SPACES)) != 0;
+	std::vector<Frame> stack;
+	const Val* val = root;
+
+	for (;;) {
+		void* raw = const_cast<Val*>(val);
+		if (unsafe_yyjson_is_ctn(raw) && unsafe_yyjson_get_len(raw) > 0) {
+			bool is_obj = unsafe_yyjson_is_obj(raw);
+			if (!Put(is_obj ? "{" : "[", 1) || (pretty && !Put("\n", 1))) {
+				return false;
+			}
+			stack.push_back({ JsonFirstChild(val), unsafe_yyjson_get_len(raw), is_obj, true });
+		} else if (!PutScalar(val)) {
+			return false;
+		}
+
+		// Close finished containers until one has items left
+		while (!stack.empty() && stack.back().remaining == 0) {
+			bool is_obj = stack.back().is_obj;
+			stack.pop_back();
+			if (pretty && (!Put("\n", 1) || !PutIndent(stack.size()))) {
+				return false;
+			}
+			if (!Put(is_obj ? "}" : "]", 1)) {
+				return false;
+			}
+		}
+
+		if (stack.empty()) {
+			return true;
+		}
+
+		Frame& frame = stack.back();
+		if (!frame.first && !Put(",\n", pretty ? 2 : 1)) {
+			return false;
+		}
+		frame.first = false;
+
+		if (pretty && !PutIndent(stack.size())) {
+			return false;
+		}
+
+		val = frame.next;
+		if (frame.is_obj) {
+			if (!PutScalar(val) || !Put(": ", pretty ? 2 : 1)) {
+				return false;
+			}
+			val = JsonNextSibling(val);
+		}
+
+		frame.next = JsonNextSibling(val);
+		frame.remaining--;
+	}
+}
+
+template <typename Val>
+bool JsonChunkWriter::PutScalar(const Val* val)
+{
+	// Scalars and empty containers share the layout of yyjson_val, as in yyjson's own single value writer
+	const yyjson_val* ival = reinterpret_cast<const yyjson_val*>(val);
+	void* raw = const_cast<yyjson_val*>(ival);
+
+	// Room the single value writer asks for, as computed in write_root_single
+	size_t needed = 64;
+
+	switch (unsafe_yyjson_get_type(raw)) {
+	case YYJSON_TYPE_RAW:
+		return Put(unsafe_yyjson_get_raw(raw), unsafe_yyjson_get_len(raw));
+	case YYJSON_TYPE_STR:
+		if (unsafe_yyjson_get_len(raw) > m_sliceSize) {
+			return PutString(ival);
+		}
+		needed = unsafe_yyjson_get_len(raw) * 6 + 4;
+		break;
+	case YYJSON_TYPE_BOOL:
+		return unsafe_yyjson_get_bool(raw) ? Put("true", 4) : Put("false", 5);
+	case YYJSON_TYPE_NULL:
+		return Put("null", 4);
+	case YYJSON_TYPE_NUM:
+		if (unsafe_yyjson_get_subtype(raw) != YYJSON_SUBTYPE_REAL || IsShortestReal(ival, m_writeFlg)) {
+			return PutNumber(ival);
+		}
+		break;
+	default:
+		break;
+	}
+
+	// Write in place when the chunk has room, the terminator lands in the spare byte at worst
+	char* out = m_scratch.data();
+	size_t out_size = m_scratch.size();
+	if (m_chunk.size() - m_used >= needed) {
+		out = m_chunk.data() + m_used;
+		out_size = m_chunk.size() - m_used;
+	}
+
+	yyjson_write_err err;
+	size_t len = yyjson_val_write_buf(out, out_size, ival, m_writeFlg, &err);
+	if (!len) {
+		m_error = err.msg;
+		return false;
+	}
+
+	if (out != m_scratch.data()) {
+		m_used += len;
+		return true;
+	}
+	return Put(out, len);
+}
+
+bool JsonChunkWriter::PutNumber(const yyjson_val* val)
+{
+	if (m_chunk.size() - m_used >= 64) {
+		char* end = yyjson_write_number(val, m_chunk.data() + m_used);
+		m_used = static_cast<size_t>(end - m_chunk.data());
+		return true;
+	}
+
+	char* end = yyjson_write_number(val, m_scratch.data());
+	return Put(m_scratch.data(), static_cast<size_t>(end - m_scratch.data()));
+}
+
+bool JsonChunkWriter::PutString(const yyjson_val* val)
+{
+	void* raw = const_cast<yyjson_val*>(val);
+	const char* str = unsafe_yyjson_get_str(raw);
+	size_t len = unsafe_yyjson_get_len(raw);
+
+	if (!Put("\"", 1)) {
+		return false;
+	}
+
+	while (len > 0) {
+		size_t n = len < m_sliceSize ? len : m_sliceSize;
+
+		// Never cut a UTF-8 sequence, the writer validates and escapes whole sequences.
+		// A sequence has at most three continuation bytes, past that nothing valid crosses the cut
+		if (n < len) {
+			size_t cut = n;
+			while (cut > n - 3 && IsUtf8Continuation(str[cut])) {
+				cut--;
+			}
+			if (!IsUtf8Continuation(str[cut])) {
+				n = cut;
+			}
+		}
+
+		// Each slice is written as its own string, with the type and subtype of the original
+		yyjson_val slice;
+		slice.tag = (static_cast<uint64_t>(n) << YYJSON_TAG_BIT) | (val->tag & YYJSON_TAG_MASK);
+		slice.uni.str = str;
+
+		yyjson_write_err err;
+		size_t out = yyjson_val_write_buf(m_scratch.data(), m_scratch.size(), &slice, m_writeFlg, &err);
+		if (!out) {
+			m_error = err.msg;
+			return false;
+		}
+
+		// Strip the quotes around the slice
+		if (!Put(m_scratch.data() + 1, out - 2)) {
+			return false;
+		}
+
+		str += n;
+		len -= n;
+	}
+
+	return Put("\"", 1);
+}
+
+bool JsonChunkWriter::PutIndent(size_t level)
+{
+	size_t count = level * ((m_writeFlg & YYJSON_WRITE_PRETTY_TWO_SPACES) ? 2 : 4);
+	while (count > 0) {
+		size_t n = count < sizeof(SPACES) - 1 ? count : sizeof(SPACES) - 1;
+		if (!Put(SPACES, n)) {
+			return false;
+		}
+		count -= n;
+	}
+	return true;
+}
+
+bool JsonChunkWriter::Put(const char* data, size_t len)
+{
+	while (len > 0) {
+		size_t room = m_chunk.size() - 1 - m_used;
+		if (room == 0) {
+			if (!Flush()) {
+				return false;
+			}
+			continue;
+		}
+
+		size_t n = len < room ? len : room;
+		memcpy(m_chunk.data() + m_used, data, n);
+		m_used += n;
+		data += n;
+		len -= n;
+	}
+	return true;
+}
+
+bool JsonChunkWriter::Flush()
+{
+	if (m_used == 0) {
+		return true;
+	}
+
+	m_chunk[m_used] = '\0';
+	if (!m_sink->WriteChunk(m_chunk.data(), m_used)) {
+		m_error = "Write aborted by the chunk receiver";
+		return false;
+	}
+
+	m_written += m_used;
+	m_used = 0;
+	return true;
+}
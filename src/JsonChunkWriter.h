@@ -0,0 +1,67 @@
+#ifndef _INCLUDE_JSONCHUNKWRITER_H_
+#define _INCLUDE_JSONCHUNKWRITER_H_
+
+#include <IJsonManager.h>
+#include <yyjson.h>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Serializer that hands its output to a sink in fixed-size chunks
+ *
+ * Produces the same bytes as the yyjson writer, but walks the value itself and only keeps one
+ * chunk of output in memory. Long strings are escaped in slices, so the extra memory stays
+ * bounded by the chunk size whatever the document size.
+ */
+class JsonChunkWriter
+{
+public:
+	static constexpr size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+	static constexpr size_t MIN_CHUNK_SIZE = 64;
+
+	/**
+	 * @param sink Receives every chunk, all chunks but the last are exactly chunk_size bytes
+	 * @param chunk_size Chunk size in bytes, raised to MIN_CHUNK_SIZE
+	 */
+	JsonChunkWriter(IJsonChunkSink* sink, size_t chunk_size);
+
+	JsonChunkWriter(const JsonChunkWriter&) = delete;
+	JsonChunkWriter& operator=(const JsonChunkWriter&) = delete;
+
+	/**
+	 * Serialize a value and flush the last chunk
+	 * @param val Value to write, containers are written with all their children
+	 * @param write_flg Write flags
+	 * @return false if the value cannot be written or the sink aborted, see GetError()
+	 */
+	bool Write(const yyjson_val* val, yyjson_write_flag write_flg);
+	bool Write(const yyjson_mut_val* val, yyjson_write_flag write_flg);
+
+	const char* GetError() const { return m_error; }
+	uint64_t GetWritten() const { return m_written; }
+
+private:
+	template <typename Val>
+	bool WriteRoot(const Val* root);
+	template <typename Val>
+	bool PutScalar(const Val* val);
+	bool PutNumber(const yyjson_val* val);
+	bool PutString(const yyjson_val* val);
+	bool PutIndent(size_t level);
+	bool Put(const char* data, size_t len);
+	bool Flush();
+
+	IJsonChunkSink* m_sink;
+	std::vector<char> m_chunk;
+	size_t m_used{ 0 };
+
+	// Escaped output of one string slice or number
+	std::vector<char> m_scratch;
+	size_t m_sliceSize;
+
+	yyjson_write_flag m_writeFlg{ 0 };
+	uint64_t m_written{ 0 };
+	const char* m_error{ "" };
+};
+
+#endif // _INCLUDE_JSONCHUNKWRITER_H_
@@ -0,0 +1,611 @@
+#include "JsonFile.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+HeapBuffer::~HeapBuffer()
+{
+	free(m_ptr);
+}
+
+static void* LibcMalloc(void* ctx, size_t size)
+{
+	return malloc(size);
+}
+
+static void* LibcRealloc(void* ctx, void* ptr, size_t old_size, size_t size)
+{
+	return realloc(ptr, size);
+}
+
+static void LibcFree(void* ctx, void* ptr)
+{
+	free(ptr);
+}
+
+const yyjson_alc g_LibcAllocator = { LibcMalloc, LibcRealloc, LibcFree, nullptr };
+
+/**
+ * Header at the start of every ScratchArena allocation, followed by the usable memory
+ */
+struct ScratchArena::Block
+{
+	class LeaseStorage : public JsonDocStorage
+	{
+	public:
+		explicit LeaseStorage(Block* block) : m_block(block) {}
+		~LeaseStorage() override { m_block->leased.store(false, std::memory_order_release); }
+
+		// Lives inside the block, which is owned by the arena
+		static void operator delete(void*) noexcept {}
+
+	private:
+		Block* m_block;
+	};
+
+	std::atomic<bool> leased{ false };
+	size_t size{ 0 };
+	alignas(LeaseStorage) unsigned char lease[sizeof(LeaseStorage)];
+
+	static constexpr size_t HeaderSize() { return (sizeof(Block) + 15) & ~static_cast<size_t>(15); }
+	char* data() { return reinterpret_cast<char*>(this) + HeaderSize(); }
+};
+
+ScratchArena::~ScratchArena()
+{
+	// Blocks still used by a document are leaked rather than freed underneath it
+	if (m_current && !m_current->leased.load(std::memory_order_acquire)) {
+		m_current->~Block();
+		free(m_current);
+	}
+	FreeRetired();
+}
+
+void ScratchArena::FreeRetired()
+{
+	for (size_t i = 0; i < m_retired.size();) {
+		Block* block = m_retired[i];
+		if (block->leased.load(std::memory_order_acquire)) {
+			i++;
+			continue;
+		}
+		block->~Block();
+		free(block);
+		m_retired[i] = m_retired.back();
+		m_retired.pop_back();
+	}
+}
+
+char* ScratchArena::Acquire(size_t size, size_t min_size, size_t* out_size)
+{
+	if (!m_retired.empty()) {
+		FreeRetired();
+	}
+
+	if (m_current && !m_current->leased.load(std::memory_order_acquire) && m_current->size >= size) {
+		*out_size = m_current->size;
+		return m_current->data();
+	}
+
+	size_t new_size = std::max(size, min_size);
+	if (m_current) {
+		new_size = std::max(new_size, m_current->size);
+		if (m_current->leased.load(std::memory_order_acquire)) {
+			m_retired.push_back(m_current);
+		} else {
+			m_current->~Block();
+			free(m_current);
+		}
+		m_current = nullptr;
+	}
+
+	void* mem = malloc(Block::HeaderSize() + new_size);
+	if (!mem) {
+		return nullptr;
+	}
+
+	m_current = new (mem) Block();
+	m_current->size = new_size;
+	*out_size = new_size;
+	return m_current->data();
+}
+
+std::unique_ptr<JsonDocStorage> ScratchArena::Lease()
+{
+	m_current->leased.store(true, std::memory_order_relaxed);
+	return std::unique_ptr<JsonDocStorage>(new (m_current->lease) Block::LeaseStorage(m_current));
+}
+
+bool SyncFileToDisk(FILE* fp)
+{
+	if (!fp || fflush(fp) != 0) {
+		return false;
+	}
+
+#ifdef _WIN32
+	return _commit(_fileno(fp)) == 0;
+#else
+	return fsync(fileno(fp)) == 0;
+#endif
+}
+
+bool ReplaceFileAtomic(const char* src, const char* dst, bool sync)
+{
+	if (!src || !dst) {
+		return false;
+	}
+
+#ifdef _WIN32
+	DWORD flags = MOVEFILE_REPLACE_EXISTING;
+	if (sync) {
+		flags |= MOVEFILE_WRITE_THROUGH;
+	}
+	return MoveFileExA(src, dst, flags) != 0;
+#else
+	if (rename(src, dst) != 0) {
+		return false;
+	}
+
+	if (sync) {
+		// The directory entry has to be flushed as well for the rename to survive a crash
+		char dir[4096];
+		const char* slash = strrchr(dst, '/');
+		if (!slash) {
+			strcpy(dir, ".");
+		} else {
+			size_t len = static_cast<size_t>(slash - dst);
+			if (len == 0) {
+				len = 1;
+			}
+			if (len >= sizeof(dir)) {
+				return true;
+			}
+			memcpy(dir, dst, len);
+			dir[len] = '\0';
+		}
+
+		int fd = open(dir, O_RDONLY);
+		if (fd >= 0) {
+			fsync(fd);
+			close(fd);
+		}
+	}
+
+	return true;
+#endif
+}
+
+bool GetFileStamp(const char* path, FileStamp* out)
+{
+	if (!path || !out) {
+		return false;
+	}
+
+#ifdef _WIN32
+	WIN32_FILE_ATTRIBUTE_DATA data;
+	if (!GetFileAttributesExA(path, GetFileExInfoStandard, &data) || (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)) {
+		return false;
+	}
+	out->size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+	out->mtime = static_cast<int64_t>((static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime);
+#else
+	struct stat st;
+	if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) {
+		return false;
+	}
+	out->size = static_cast<uint64_t>(st.st_size);
+#ifdef __APPLE__
+	out->mtime = static_cast<int64_t>(st.st_mtimespec.tv_sec) * 1000000000 + st.st_mtimespec.tv_nsec;
+#else
+	out->mtime = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+#endif
+#endif
+
+	return true;
+}
+
+#ifdef _WIN32
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char* path, size_t padding, bool prefault)
+{
+	HANDLE hFile = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (hFile == INVALID_HANDLE_VALUE) {
+		return nullptr;
+	}
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart <= 0 ||
+		static_cast<unsigned long long>(fileSize.QuadPart) >= SIZE_MAX - padding) {
+		CloseHandle(hFile);
+		return nullptr;
+	}
+
+	size_t size = static_cast<size_t>(fileSize.QuadPart);
+
+	// A view cannot extend past the end of the file, so the padding has to fit into the last page
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	size_t page = info.dwPageSize;
+	size_t tail = size % page;
+	if (padding > 0 && (tail == 0 || tail + padding > page)) {
+		CloseHandle(hFile);
+		return nullptr;
+	}
+
+	HANDLE hMapping = CreateFileMappingA(hFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+	CloseHandle(hFile);
+	if (!hMapping) {
+		return nullptr;
+	}
+
+	void* view = MapViewOfFile(hMapping, FILE_MAP_COPY, 0, 0, 0);
+	if (!view) {
+		CloseHandle(hMapping);
+		return nullptr;
+	}
+
+	std::unique_ptr<MappedFile> mapping(new MappedFile());
+	mapping->m_data = static_cast<char*>(view);
+	mapping->m_size = size;
+	mapping->m_mapSize = size + padding;
+	mapping->m_hMapping = hMapping;
+	return mapping;
+}
+
+MappedFile::~MappedFile()
+{
+	if (m_data) {
+		UnmapViewOfFile(m_data);
+	}
+	if (m_hMapping) {
+		CloseHandle(m_hMapping);
+	}
+}
+
+#else
+
+std::unique_ptr<MappedFile> MappedFile::Open(const char* path, size_t padding, bool prefault)
+{
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return nullptr;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0 ||
+		static_cast<unsigned long long>(st.st_size) >= SIZE_MAX - padding) {
+		close(fd);
+		return nullptr;
+	}
+
+	size_t size = static_cast<size_t>(st.st_size);
+	size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+	size_t mapSize = (size + padding + page - 1) / page * page;
+
+	// Reserve zeroed anonymous memory for file and padding, then map the file over the front of it,
+	// so the padding is valid memory even when the file ends exactly on a page boundary
+	void* base = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (base == MAP_FAILED) {
+		close(fd);
+		return nullptr;
+	}
+
+	int flags = MAP_PRIVATE | MAP_FIXED;
+#ifdef MAP_POPULATE
+	// Faulting the pages in one by one on first write costs about as much as reading the file again
+	if (prefault) {
+		flags |= MAP_POPULATE;
+	}
+#endif
+
+	void* view = mmap(base, size, PROT_READ | PROT_WRITE, flags, fd, 0);
+	close(fd);
+	if (view == MAP_FAILED) {
+		munmap(base, mapSize);
+		return nullptr;
+	}
+
+	std::unique_ptr<MappedFile> mapping(new MappedFile());
+	mapping->m_data = static_cast<char*>(base);
+	mapping->m_size = size;
+	mapping->m_mapSize = mapSize;
+	return mapping;
+}
+
+MappedFile::~MappedFile()
+{
+	if (m_data) {
+		munmap(m_data, m_mapSize);
+	}
+}
+
+#endif
+
+std::unique_ptr<LineFileReader> LineFileReader::Open(const char* path, size_t buffer_size)
+{
+	if (!path || !buffer_size) {
+		return nullptr;
+	}
+
+	FILE* fp = fopen(path, "rb");
+	if (!fp) {
+		return nullptr;
+	}
+
+	std::unique_ptr<LineFileReader> reader(new LineFileReader());
+	reader->m_fp = fp;
+	reader->m_buf.resize(buffer_size);
+	return reader;
+}
+
+LineFileReader::~LineFileReader()
+{
+	if (m_fp) {
+		fclose(m_fp);
+	}
+}
+
+bool LineFileReader::NextLine(const char** out_line, size_t* out_len)
+{
+	size_t scanned = m_start;
+
+	while (true) {
+		char* nl = static_cast<char*>(memchr(m_buf.data() + scanned, '\n', m_end - scanned));
+		if (nl) {
+			size_t len = static_cast<size_t>(nl - (m_buf.data() + m_start));
+			*out_line = m_buf.data() + m_start;
+			*out_len = (len && nl[-1] == '\r') ? len - 1 : len;
+			m_start += len + 1;
+			return true;
+		}
+
+		if (m_eof) {
+			if (m_start == m_end) {
+				return false;
+			}
+			// Last line without a line ending
+			size_t len = m_end - m_start;
+			*out_line = m_buf.data() + m_start;
+			*out_len = (m_buf[m_end - 1] == '\r') ? len - 1 : len;
+			m_start = m_end;
+			return true;
+		}
+
+		// Move the partial line to the front, and only grow the buffer if the line fills all of it
+		size_t partial = m_end - m_start;
+		if (m_start) {
+			memmove(m_buf.data(), m_buf.data() + m_start, partial);
+			m_bufOffset += m_start;
+			m_start = 0;
+			m_end = partial;
+		}
+		if (m_end == m_buf.size()) {
+			m_buf.resize(m_buf.size() * 2);
+		}
+		scanned = m_end;
+
+		size_t read = fread(m_buf.data() + m_end, 1, m_buf.size() - m_end, m_fp);
+		m_end += read;
+		if (read == 0) {
+			if (ferror(m_fp)) {
+				return false;
+			}
+			m_eof = true;
+		}
+	}
+}
+
+bool LineFileReader::Seek(uint64_t offset)
+{
+#ifdef _WIN32
+	int result = _fseeki64(m_fp, static_cast<__int64>(offset), SEEK_SET);
+#else
+	int result = fseeko(m_fp, static_cast<off_t>(offset), SEEK_SET);
+#endif
+	if (result != 0) {
+		return false;
+	}
+
+	clearerr(m_fp);
+	m_start = 0;
+	m_end = 0;
+	m_bufOffset = offset;
+	m_eof = false;
+	return true;
+}
+
+bool IsGzipFile(const char* path)
+{
+	FILE* fp = fopen(path, "rb");
+	if (!fp) {
+		return false;
+	}
+
+	unsigned char magic[2];
+	bool is_gzip = fread(magic, 1, 2, fp) == 2 && magic[0] == 0x1F && magic[1] == 0x8B;
+	fclose(fp);
+	return is_gzip;
+}
+
+bool IsGzipPath(const char* path)
+{
+	size_t len = strlen(path);
+	return len >= 3 && path[len - 3] == '.' && (path[len - 2] | 0x20) == 'g' && (path[len - 1] | 0x20) == 'z';
+}
+
+#ifdef JSON_HAS_ZLIB
+
+static constexpr size_t GZIP_READ_CHUNK = 64 * 1024;
+
+// deflate never compresses better than about 1032:1, which bounds the size taken from a corrupt trailer
+static constexpr uint64_t GZIP_MAX_RATIO = 1032;
+
+char* ReadGzipFile(const char* path, size_t padding, size_t* out_size, size_t max_size)
+{
+	FILE* fp = fopen(path, "rb");
+	if (!fp) {
+		return nullptr;
+	}
+
+	// The trailer of the last member holds the uncompressed size modulo 4 GB. One spare byte lets
+	// the trailer be consumed without growing the block when the size is right
+	size_t capacity = GZIP_READ_CHUNK;
+	unsigned char trailer[4];
+	if (fseek(fp, -4, SEEK_END) == 0 && fread(trailer, 1, 4, fp) == 4) {
+		uint64_t compressed = static_cast<uint64_t>(ftell(fp));
+		uint64_t isize = trailer[0] | (trailer[1] << 8) | (trailer[2] << 16) | (static_cast<uint64_t>(trailer[3]) << 24);
+		capacity = static_cast<size_t>(std::min<uint64_t>(std::min<uint64_t>(isize, compressed * GZIP_MAX_RATIO) + 1, SIZE_MAX / 4));
+	}
+	if (max_size && capacity > max_size + 1) {
+		capacity = max_size + 1;
+	}
+	rewind(fp);
+
+	z_stream stream{};
+	if (inflateInit2(&stream, 15 + 16) != Z_OK) {
+		fclose(fp);
+		return nullptr;
+	}
+
+	std::unique_ptr<unsigned char[]> in(new(std::nothrow) unsigned char[GZIP_READ_CHUNK]);
+	char* block = static_cast<char*>(malloc(capacity + padding));
+	size_t used = 0;
+	bool ok = in && block;
+	bool member_end = false;
+
+	while (ok) {
+		if (stream.avail_in == 0) {
+			size_t read = fread(in.get(), 1, GZIP_READ_CHUNK, fp);
+			if (read == 0) {
+				// A truncated member is an error, a file ending after a complete one is not
+				ok = member_end && !ferror(fp);
+				break;
+			}
+			stream.next_in = in.get();
+			stream.avail_in = static_cast<uInt>(read);
+		}
+
+		if (used == capacity) {
+			size_t grown = capacity * 2;
+			char* bigger = static_cast<char*>(realloc(block, grown + padding));
+			if (!bigger) {
+				ok = false;
+				break;
+			}
+			block = bigger;
+			capacity = grown;
+		}
+
+		size_t room = std::min<size_t>(capacity - used, UINT32_MAX);
+		stream.next_out = reinterpret_cast<Bytef*>(block + used);
+		stream.avail_out = static_cast<uInt>(room);
+
+		int ret = inflate(&stream, Z_NO_FLUSH);
+		size_t produced = room - stream.avail_out;
+		used += produced;
+
+		if (max_size && used > max_size) {
+			ok = false;
+			break;
+		}
+
+		if (ret == Z_STREAM_END) {
+			member_end = true;
+			inflateReset(&stream);
+		} else if (ret == Z_OK || ret == Z_BUF_ERROR) {
+			if (produced) {
+				member_end = false;
+			}
+		} else {
+			// Bytes after a complete member that are not another member are ignored, like gzip does
+			ok = member_end && used > 0;
+			break;
+		}
+	}
+
+	inflateEnd(&stream);
+	fclose(fp);
+
+	*out_size = used;
+	if (!ok) {
+		free(block);
+		return nullptr;
+	}
+
+	memset(block + used, 0, padding);
+	return block;
+}
+
+GzipFileWriter::GzipFileWriter(FILE* fp, int level)
+	: m_fp(fp)
+{
+	// 15 window bits plus 16 selects the gzip wrapper
+	m_ready = deflateInit2(&m_stream, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) == Z_OK;
+}
+
+GzipFileWriter::~GzipFileWriter()
+{
+	if (m_ready) {
+		deflateEnd(&m_stream);
+	}
+}
+
+bool GzipFileWriter::Write(const char* data, size_t len)
+{
+	while (len > 0) {
+		uInt n = static_cast<uInt>(std::min<size_t>(len, UINT32_MAX));
+		m_stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+		m_stream.avail_in = n;
+		if (!Deflate(Z_NO_FLUSH)) {
+			return false;
+		}
+		data += n;
+		len -= n;
+	}
+	return true;
+}
+
+bool GzipFileWriter::Finish()
+{
+	return Deflate(Z_FINISH);
+}
+
+bool GzipFileWriter::Deflate(int flush)
+{
+	if (!m_ready) {
+		return false;
+	}
+
+	int ret;
+	do {
+		m_stream.next_out = m_out;
+		m_stream.avail_out = sizeof(m_out);
+		ret = deflate(&m_stream, flush);
+		if (ret == Z_STREAM_ERROR) {
+			return false;
+		}
+
+		size_t have = sizeof(m_out) - m_stream.avail_out;
+		if (have && fwrite(m_out, 1, have, m_fp) != have) {
+			return false;
+		}
+	} while (m_stream.avail_out == 0 || (flush == Z_FINISH && ret != Z_STREAM_END));
+
+	return true;
+}
+
+#endif
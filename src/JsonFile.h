@@ -0,0 +1,290 @@
+#ifndef _INCLUDE_JSONFILE_H_
+#define _INCLUDE_JSONFILE_H_
+
+#include <cstdio>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <yyjson.h>
+
+#ifdef JSON_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+/**
+ * @brief Flush a stdio stream and the OS file buffers behind it to disk
+ * @param fp Open file stream
+ * @return true on success
+ */
+bool SyncFileToDisk(FILE* fp);
+
+/**
+ * @brief Atomically replace a file with another one on the same filesystem
+ * @param src Path of the new file, usually a temporary file next to dst
+ * @param dst Path of the file to replace
+ * @param sync true to also make the rename itself durable
+ * @return true on success, src no longer exists afterwards
+ */
+bool ReplaceFileAtomic(const char* src, const char* dst, bool sync);
+
+/**
+ * @brief Size and modification time of a file, used to detect changes
+ */
+struct FileStamp
+{
+	uint64_t size{ 0 };
+	int64_t mtime{ 0 };  // Platform-specific ticks, only meaningful for equality checks
+
+	bool operator==(const FileStamp& other) const { return size == other.size && mtime == other.mtime; }
+	bool operator!=(const FileStamp& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Read the size and modification time of a regular file
+ * @param path Resolved file path
+ * @param out Receives the stamp
+ * @return false if the file does not exist or is not a regular file
+ */
+bool GetFileStamp(const char* path, FileStamp* out);
+
+/**
+ * @brief Memory kept alive alongside a document
+ *
+ * Used when values or strings of a document point into memory that yyjson does not own.
+ * The storage is released after the document itself.
+ */
+class JsonDocStorage
+{
+public:
+	virtual ~JsonDocStorage() = default;
+};
+
+/**
+ * @brief Heap block allocated with malloc(), released with free()
+ */
+class HeapBuffer : public JsonDocStorage
+{
+public:
+	explicit HeapBuffer(void* ptr) : m_ptr(ptr) {}
+	~HeapBuffer() override;
+
+	HeapBuffer(const HeapBuffer&) = delete;
+	HeapBuffer& operator=(const HeapBuffer&) = delete;
+
+	void* data() const { return m_ptr; }
+
+private:
+	void* m_ptr;
+};
+
+/**
+ * @brief yyjson allocator on malloc() and free()
+ *
+ * For documents built outside of yyjson, whose blocks may later be taken over by a HeapBuffer
+ */
+extern const yyjson_alc g_LibcAllocator;
+
+/**
+ * @brief Reference to a block shared with its allocator, which may reuse it once the document is gone
+ */
+class SharedBlock : public JsonDocStorage
+{
+public:
+	explicit SharedBlock(std::shared_ptr<char> block) : m_block(std::move(block)) {}
+
+private:
+	std::shared_ptr<char> m_block;
+};
+
+/**
+ * @brief Per-thread parse block that is reused once the document parsed into it is gone
+ *
+ * Acquire() and Lease() must only be called by the owning thread. The lease returned for a document
+ * is placed inside the block header, so handing a block to a document needs no allocation.
+ * A block still leased when a new one is needed is retired and freed once its document is released.
+ */
+class ScratchArena
+{
+public:
+	ScratchArena() = default;
+	~ScratchArena();
+
+	ScratchArena(const ScratchArena&) = delete;
+	ScratchArena& operator=(const ScratchArena&) = delete;
+
+	/**
+	 * Get a free block
+	 * @param size Minimum usable size in bytes
+	 * @param min_size Size of a newly allocated block if size is smaller
+	 * @param out_size Receives the usable size
+	 * @return Usable memory, or nullptr on allocation failure
+	 */
+	char* Acquire(size_t size, size_t min_size, size_t* out_size);
+
+	/**
+	 * Hand the block returned by the last Acquire() to a document
+	 * @return Storage to keep with the document, releasing it makes the block reusable
+	 */
+	std::unique_ptr<JsonDocStorage> Lease();
+
+private:
+	struct Block;
+
+	void FreeRetired();
+
+	Block* m_current{ nullptr };
+	std::vector<Block*> m_retired;
+};
+
+/**
+ * @brief Private, writable memory mapping of a whole file followed by zeroed padding
+ *
+ * Pages are copy-on-write, so in-situ parsing never modifies the file on disk.
+ */
+class MappedFile : public JsonDocStorage
+{
+public:
+	~MappedFile() override;
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	/**
+	 * Map a file
+	 * @param path Resolved file path
+	 * @param padding Number of zero bytes that must be readable and writable after the file data
+	 * @param prefault Copy in every page up front where supported, for callers about to write to most of them
+	 * @return Mapping, or nullptr if the file cannot be mapped (missing, empty, or no room for the padding)
+	 */
+	static std::unique_ptr<MappedFile> Open(const char* path, size_t padding, bool prefault = false);
+
+	char* data() const { return m_data; }
+	size_t size() const { return m_size; }
+
+private:
+	MappedFile() = default;
+
+	char* m_data{ nullptr };
+	size_t m_size{ 0 };
+	size_t m_mapSize{ 0 };
+#ifdef _WIN32
+	void* m_hMapping{ nullptr };
+#endif
+};
+
+/**
+ * @brief Buffered line reader for files of any size
+ *
+ * Reads the file in fixed-size chunks. The buffer only grows when a single line does not fit.
+ */
+class LineFileReader
+{
+public:
+	~LineFileReader();
+
+	LineFileReader(const LineFileReader&) = delete;
+	LineFileReader& operator=(const LineFileReader&) = delete;
+
+	/**
+	 * Open a file
+	 * @param path Resolved file path
+	 * @param buffer_size Chunk size in bytes
+	 * @return Reader, or nullptr if the file cannot be opened
+	 */
+	static std::unique_ptr<LineFileReader> Open(const char* path, size_t buffer_size);
+
+	/**
+	 * Read the next line
+	 * @param out_line Receives the line without its line ending, valid until the next call
+	 * @param out_len Receives the line length
+	 * @return false at the end of the file or on a read error
+	 */
+	bool NextLine(const char** out_line, size_t* out_len);
+
+	/**
+	 * Continue reading at a byte offset, which should be the start of a line
+	 * @param offset Byte offset from the start of the file
+	 * @return true on success
+	 */
+	bool Seek(uint64_t offset);
+
+	/**
+	 * @return Byte offset of the next line
+	 */
+	uint64_t Offset() const { return m_bufOffset + m_start; }
+
+private:
+	LineFileReader() = default;
+
+	FILE* m_fp{ nullptr };
+	std::vector<char> m_buf;
+	size_t m_start{ 0 };
+	size_t m_end{ 0 };
+	uint64_t m_bufOffset{ 0 };
+	bool m_eof{ false };
+};
+
+/**
+ * @brief Check whether a file starts with the gzip magic bytes
+ * @param path Resolved file path
+ * @return false if the file is not gzip compressed or cannot be read
+ */
+bool IsGzipFile(const char* path);
+
+/**
+ * @brief Check whether a path names a gzip file (".gz" extension, any case)
+ */
+bool IsGzipPath(const char* path);
+
+#ifdef JSON_HAS_ZLIB
+/**
+ * @brief Decompress a gzip file into one heap block followed by zeroed padding
+ *
+ * The block is sized from the gzip trailer and inflated into directly, so in-situ parsing
+ * needs no further copy. Concatenated gzip members are read as one stream.
+ *
+ * @param path Resolved file path
+ * @param padding Number of zero bytes after the data
+ * @param out_size Receives the decompressed size, not including the padding. On failure, the size
+ *                 decompressed before it, which is above max_size if the data was too large
+ * @param max_size Largest decompressed size accepted, 0 for no limit
+ * @return Block to release with free(), or nullptr if the file cannot be read, is corrupt or too large
+ */
+char* ReadGzipFile(const char* path, size_t padding, size_t* out_size, size_t max_size = 0);
+
+/**
+ * @brief Streaming gzip compressor writing to an open file
+ */
+class GzipFileWriter
+{
+public:
+	explicit GzipFileWriter(FILE* fp, int level = Z_DEFAULT_COMPRESSION);
+	~GzipFileWriter();
+
+	GzipFileWriter(const GzipFileWriter&) = delete;
+	GzipFileWriter& operator=(const GzipFileWriter&) = delete;
+
+	/**
+	 * Compress data, full output blocks are written to the file as they fill up
+	 * @return false on a compression or write error
+	 */
+	bool Write(const char* data, size_t len);
+
+	/**
+	 * Write the remaining output and the gzip trailer, the file itself stays open
+	 * @return false on a compression or write error
+	 */
+	bool Finish();
+
+private:
+	bool Deflate(int flush);
+
+	FILE* m_fp;
+	z_stream m_stream{};
+	bool m_ready{ false };
+	unsigned char m_out[16 * 1024];
+};
+#endif
+
+#endif // _INCLUDE_JSONFILE_H_
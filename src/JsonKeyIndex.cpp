@@ -0,0 +1,141 @@
+#include "JsonKeyIndex.h"
+#include <cstring>
+
+std::atomic<size_t> JsonKeyIndex::s_count{ 0 };
+std::atomic<size_t> JsonKeyIndex::s_bytes{ 0 };
+
+JsonKeyIndex::JsonKeyIndex(yyjson_val* obj)
+{
+	Reserve(unsafe_yyjson_get_len(obj));
+
+	yyjson_obj_iter iter = yyjson_obj_iter_with(obj);
+	yyjson_val* key;
+	while ((key = yyjson_obj_iter_next(&iter))) {
+		Insert(key);
+	}
+
+	s_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+JsonKeyIndex::JsonKeyIndex(yyjson_mut_val* obj)
+{
+	Reserve(unsafe_yyjson_get_len(obj));
+
+	yyjson_mut_obj_iter iter = yyjson_mut_obj_iter_with(obj);
+	yyjson_mut_val* key;
+	while ((key = yyjson_mut_obj_iter_next(&iter))) {
+		Insert(key);
+	}
+
+	m_objSize = unsafe_yyjson_get_len(obj);
+	m_objTail = obj->uni.ptr;
+	s_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+JsonKeyIndex::~JsonKeyIndex()
+{
+	s_count.fetch_sub(1, std::memory_order_relaxed);
+	s_bytes.fetch_sub(m_accounted, std::memory_order_relaxed);
+}
+
+void JsonKeyIndex::GetStats(size_t* count, size_t* bytes)
+{
+	if (count) {
+		*count = s_count.load(std::memory_order_relaxed);
+	}
+	if (bytes) {
+		*bytes = s_bytes.load(std::memory_order_relaxed);
+	}
+}
+
+uint32_t JsonKeyIndex::Hash(const char* str, size_t len)
+{
+	// Eight bytes per step, keys are mostly short identifiers
+	uint64_t h = 0x9E3779B97F4A7C15ull ^ len;
+	while (len >= 8) {
+		uint64_t word;
+		memcpy(&word, str, 8);
+		h = (h ^ word) * 0xFF51AFD7ED558CCDull;
+		h ^= h >> 32;
+		str += 8;
+		len -= 8;
+	}
+
+	uint64_t tail = 0;
+	memcpy(&tail, str, len);
+	h = (h ^ tail) * 0xC4CEB9FE1A85EC53ull;
+	h ^= h >> 29;
+	return static_cast<uint32_t>(h);
+}
+
+void* JsonKeyIndex::FindKey(const char* key, size_t len) const
+{
+	uint32_t hash = Hash(key, len);
+	for (size_t i = hash & m_mask;; i = (i + 1) & m_mask) {
+		const Slot& slot = m_slots[i];
+		if (!slot.key) {
+			return nullptr;
+		}
+		if (slot.hash == hash && unsafe_yyjson_equals_strn(slot.key, key, len)) {
+			return slot.key;
+		}
+	}
+}
+
+void JsonKeyIndex::Reserve(size_t count)
+{
+	// At most three quarters of the slots are used, so probe sequences stay short
+	size_t capacity = 16;
+	while (capacity / 4 * 3 < count) {
+		capacity *= 2;
+	}
+	if (capacity <= m_slots.size()) {
+		return;
+	}
+
+	std::vector<Slot> old;
+	old.swap(m_slots);
+	m_slots.assign(capacity, Slot{ nullptr, 0 });
+	m_mask = capacity - 1;
+
+	for (const Slot& slot : old) {
+		if (slot.key) {
+			size_t i = slot.hash & m_mask;
+			while (m_slots[i].key) {
+				i = (i + 1) & m_mask;
+			}
+			m_slots[i] = slot;
+		}
+	}
+
+	size_t usage = GetMemoryUsage();
+	s_bytes.fetch_add(usage - m_accounted, std::memory_order_relaxed);
+	m_accounted = usage;
+}
+
+void JsonKeyIndex::Insert(void* key)
+{
+	const char* str = unsafe_yyjson_get_str(key);
+	size_t len = unsafe_yyjson_get_len(key);
+	uint32_t hash = Hash(str, len);
+
+	size_t i = hash & m_mask;
+	for (; m_slots[i].key; i = (i + 1) & m_mask) {
+		if (m_slots[i].hash == hash && unsafe_yyjson_equals_strn(m_slots[i].key, str, len)) {
+			m_hasDuplicates = true;
+			return;
+		}
+	}
+
+	m_slots[i] = Slot{ key, hash };
+	m_count++;
+}
+
+void JsonKeyIndex::AddLast(yyjson_mut_val* obj)
+{
+	Reserve(m_count + 1);
+	Insert(obj->uni.ptr);
+
+	m_objSize = unsafe_yyjson_get_len(obj);
+	m_objTail = obj->uni.ptr;
+}
@@ -0,0 +1,118 @@
+#ifndef _INCLUDE_JSONKEYINDEX_H_
+#define _INCLUDE_JSONKEYINDEX_H_
+
+#include <yyjson.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Open-addressing hash index over the keys of one object
+ *
+ * Slots point at the key values of the object, so a lookup hashes the key once and compares the
+ * bytes of the keys in its probe sequence instead of scanning the whole object. Only the first of
+ * several equal keys is indexed, which is the one yyjson_obj_get() finds.
+ *
+ * An index of a mutable object remembers the object size and its last key. Adding or removing keys
+ * changes one of them, so IsCurrent() detects such changes. Renaming a key in place or reordering
+ * equal keys does not, the index of that object has to be dropped instead.
+ */
+class JsonKeyIndex
+{
+public:
+	explicit JsonKeyIndex(yyjson_val* obj);
+	explicit JsonKeyIndex(yyjson_mut_val* obj);
+	~JsonKeyIndex();
+
+	JsonKeyIndex(const JsonKeyIndex&) = delete;
+	JsonKeyIndex& operator=(const JsonKeyIndex&) = delete;
+
+	/**
+	 * @return Value of the key in an immutable object, nullptr if absent
+	 */
+	yyjson_val* Find(const char* key, size_t len) const
+	{
+		yyjson_val* found = static_cast<yyjson_val*>(FindKey(key, len));
+		return found ? found + 1 : nullptr;
+	}
+
+	/**
+	 * @return Key value of the key in a mutable object, its value is next, nullptr if absent
+	 */
+	yyjson_mut_val* FindMut(const char* key, size_t len) const
+	{
+		return static_cast<yyjson_mut_val*>(FindKey(key, len));
+	}
+
+	/**
+	 * @return true if a mutable object has not gained or lost keys since it was indexed
+	 */
+	bool IsCurrent(yyjson_mut_val* obj) const
+	{
+		return unsafe_yyjson_get_len(obj) == m_objSize && obj->uni.ptr == m_objTail;
+	}
+
+	/**
+	 * @return true if the object holds equal keys, updates then have to remove the later ones
+	 */
+	bool HasDuplicates() const { return m_hasDuplicates; }
+
+	/**
+	 * Index the key just appended to the end of a mutable object
+	 */
+	void AddLast(yyjson_mut_val* obj);
+
+	/**
+	 * @return Bytes used by the index
+	 */
+	size_t GetMemoryUsage() const { return sizeof(*this) + m_slots.capacity() * sizeof(Slot); }
+
+	/**
+	 * Get the number of live indexes and the bytes they use, across all documents
+	 */
+	static void GetStats(size_t* count, size_t* bytes);
+
+private:
+	struct Slot
+	{
+		void* key;       // Key value, nullptr if the slot is empty
+		uint32_t hash;
+	};
+
+	static uint32_t Hash(const char* str, size_t len);
+
+	void* FindKey(const char* key, size_t len) const;
+	void Reserve(size_t count);
+	void Insert(void* key);
+
+	std::vector<Slot> m_slots;
+	size_t m_mask{ 0 };
+	size_t m_count{ 0 };
+	size_t m_accounted{ 0 };
+	bool m_hasDuplicates{ false };
+
+	size_t m_objSize{ 0 };
+	void* m_objTail{ nullptr };
+
+	static std::atomic<size_t> s_count;
+	static std::atomic<size_t> s_bytes;
+};
+
+/**
+ * @brief Key index of one object, built once enough lookups have scanned the object
+ */
+struct JsonKeyIndexEntry
+{
+	std::unique_ptr<JsonKeyIndex> index;
+	uint32_t scans{ 0 };
+};
+
+/**
+ * @brief Key indexes of the objects of one document, by object value
+ */
+using JsonKeyIndexMap = std::unordered_map<const void*, JsonKeyIndexEntry>;
+
+#endif // _INCLUDE_JSONKEYINDEX_H_
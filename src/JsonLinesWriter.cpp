@@ -0,0 +1,186 @@
+#include "JsonLinesWriter.h"
+#include <algorithm>
+#include <ctime>
+
+JsonLinesWriter::~JsonLinesWriter()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_lock);
+		m_stop = true;
+		m_cond.notify_all();
+	}
+
+	// The thread writes whatever is still queued before it exits
+	if (m_thread.joinable()) {
+		m_thread.join();
+	}
+
+	if (m_fp) {
+		fclose(m_fp);
+	}
+}
+
+std::unique_ptr<JsonLinesWriter> JsonLinesWriter::Open(const char* path, const Options& options)
+{
+	if (!path) {
+		return nullptr;
+	}
+
+	FILE* fp = fopen(path, "ab");
+	if (!fp) {
+		return nullptr;
+	}
+
+	std::unique_ptr<JsonLinesWriter> writer(new JsonLinesWriter());
+	writer->m_path = path;
+	writer->m_options = options;
+	writer->m_fp = fp;
+	writer->m_fileOpened = std::chrono::steady_clock::now();
+
+	if (fseek(fp, 0, SEEK_END) == 0) {
+		long size = ftell(fp);
+		writer->m_fileSize = size > 0 ? static_cast<uint64_t>(size) : 0;
+	}
+
+	writer->m_pending.reserve(std::min(options.buffer_limit, options.flush_size * 2));
+	writer->m_thread = std::thread(&JsonLinesWriter::ThreadMain, writer.get());
+
+	return writer;
+}
+
+bool JsonLinesWriter::Append(const char* data, size_t len)
+{
+	std::lock_guard<std::mutex> lock(m_lock);
+
+	if (m_pending.size() + len + 1 > m_options.buffer_limit) {
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	m_pending.append(data, len);
+	m_pending.push_back('\n');
+	m_pendingLines++;
+
+	if (m_pending.size() >= m_options.flush_size) {
+		m_cond.notify_one();
+	}
+
+	return true;
+}
+
+void JsonLinesWriter::Flush(bool wait)
+{
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	uint64_t target = ++m_requestedSeq;
+	m_cond.notify_one();
+
+	if (wait) {
+		m_flushedCond.wait(lock, [this, target] { return m_flushedSeq >= target; });
+	}
+}
+
+void JsonLinesWriter::ThreadMain()
+{
+	const auto interval = std::chrono::milliseconds(m_options.flush_interval_ms ? m_options.flush_interval_ms : 1000);
+
+	std::unique_lock<std::mutex> lock(m_lock);
+
+	while (true) {
+		m_cond.wait_for(lock, interval, [this] {
+			return m_stop || m_requestedSeq != m_flushedSeq || m_pending.size() >= m_options.flush_size;
+		});
+
+		uint64_t seq = m_requestedSeq;
+
+		if (!m_pending.empty()) {
+			// Swap instead of copying, both buffers keep their capacity for the next round
+			m_writing.swap(m_pending);
+			uint64_t lines = m_pendingLines;
+			m_pendingLines = 0;
+
+			lock.unlock();
+			WriteChunk(m_writing, lines);
+			m_writing.clear();
+			lock.lock();
+		}
+
+		m_flushedSeq = seq;
+		m_flushedCond.notify_all();
+
+		if (m_stop && m_pending.empty()) {
+			break;
+		}
+	}
+}
+
+void JsonLinesWriter::WriteChunk(const std::string& chunk, uint64_t lines)
+{
+	if (m_fileSize) {
+		bool expired = m_options.rotate_interval &&
+			std::chrono::steady_clock::now() - m_fileOpened >= std::chrono::seconds(m_options.rotate_interval);
+		bool full = m_options.rotate_size && m_fileSize + chunk.size() > m_options.rotate_size;
+
+		// A failed rotation keeps appending to the current file
+		if (expired || full) {
+			Rotate();
+		}
+	}
+
+	if (!m_fp || fwrite(chunk.data(), 1, chunk.size(), m_fp) != chunk.size() || fflush(m_fp) != 0) {
+		m_dropped.fetch_add(lines, std::memory_order_relaxed);
+		return;
+	}
+
+	m_fileSize += chunk.size();
+	m_written.fetch_add(lines, std::memory_order_relaxed);
+}
+
+bool JsonLinesWriter::Rotate()
+{
+	// events.jsonl -> events.20250101-120000.jsonl
+	size_t sep = m_path.find_last_of("/\\");
+	size_t dot = m_path.find_last_of('.');
+	if (dot == std::string::npos || (sep != std::string::npos && dot < sep)) {
+		dot = m_path.size();
+	}
+
+	time_t now = time(nullptr);
+	struct tm local;
+#ifdef _WIN32
+	localtime_s(&local, &now);
+#else
+	localtime_r(&now, &local);
+#endif
+
+	char stamp[32];
+	strftime(stamp, sizeof(stamp), "%Y%m%d-%H%M%S", &local);
+
+	std::string base = m_path.substr(0, dot) + "." + stamp;
+	std::string ext = m_path.substr(dot);
+	std::string target = base + ext;
+
+	for (int i = 1; i < 1000; i++) {
+		FILE* existing = fopen(target.c_str(), "rb");
+		if (!existing) {
+			break;
+		}
+		fclose(existing);
+		target = base + "-" + std::to_string(i) + ext;
+	}
+
+	if (m_fp) {
+		fclose(m_fp);
+		m_fp = nullptr;
+	}
+
+	bool renamed = rename(m_path.c_str(), target.c_str()) == 0;
+
+	m_fp = fopen(m_path.c_str(), "ab");
+	m_fileOpened = std::chrono::steady_clock::now();
+	if (renamed) {
+		m_fileSize = 0;
+	}
+
+	return renamed && m_fp;
+}
@@ -0,0 +1,105 @@
+#ifndef _INCLUDE_JSONLINESWRITER_H_
+#define _INCLUDE_JSONLINESWRITER_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @brief Buffered JSON Lines appender
+ *
+ * Records are appended to an in-memory buffer on the game thread. A writer-owned thread swaps
+ * the buffer with a second one and writes it to disk when it reaches the flush size, when the
+ * flush interval elapses, or when a flush is requested, so no file I/O happens on the caller's thread.
+ * The file is rotated by size and/or age before a chunk is written.
+ */
+class JsonLinesWriter
+{
+public:
+	struct Options {
+		size_t rotate_size{ 0 };                 // Rotate once the file would exceed this many bytes, 0 to disable
+		uint32_t rotate_interval{ 0 };           // Rotate files older than this many seconds, 0 to disable
+		uint32_t flush_interval_ms{ 1000 };      // Maximum time records stay in memory
+		size_t flush_size{ 64 * 1024 };          // Buffered bytes that trigger an early flush
+		size_t buffer_limit{ 4 * 1024 * 1024 };  // Records are dropped while this many bytes are pending
+	};
+
+	~JsonLinesWriter();
+
+	JsonLinesWriter(const JsonLinesWriter&) = delete;
+	JsonLinesWriter& operator=(const JsonLinesWriter&) = delete;
+
+	/**
+	 * Open a file for appending and start the writer thread
+	 * @param path Resolved file path
+	 * @param options Flush and rotation options
+	 * @return Writer, or nullptr if the file cannot be opened
+	 */
+	static std::unique_ptr<JsonLinesWriter> Open(const char* path, const Options& options);
+
+	/**
+	 * Queue one record, a line ending is added
+	 * @param data Serialized record without line ending
+	 * @param len Record length
+	 * @return false if the record was dropped because the buffer is full
+	 */
+	bool Append(const char* data, size_t len);
+
+	/**
+	 * Ask the writer thread to write all queued records
+	 * @param wait true to block until they have been written
+	 */
+	void Flush(bool wait);
+
+	/**
+	 * @return Number of records dropped because the buffer was full or the write failed
+	 */
+	uint64_t GetDropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+	/**
+	 * @return Number of records written to disk
+	 */
+	uint64_t GetWritten() const { return m_written.load(std::memory_order_relaxed); }
+
+	// Write flags for yyjson, set by the owner
+	uint32_t m_writeFlg{ 0 };
+
+private:
+	JsonLinesWriter() = default;
+
+	void ThreadMain();
+	void WriteChunk(const std::string& chunk, uint64_t lines);
+	bool Rotate();
+
+	std::string m_path;
+	Options m_options;
+
+	std::mutex m_lock;
+	std::condition_variable m_cond;
+	std::condition_variable m_flushedCond;
+	std::thread m_thread;
+
+	// Game thread appends to m_pending, the writer thread owns m_writing while it is on disk
+	std::string m_pending;
+	std::string m_writing;
+	uint64_t m_pendingLines{ 0 };
+	uint64_t m_requestedSeq{ 0 };
+	uint64_t m_flushedSeq{ 0 };
+	bool m_stop{ false };
+
+	// Writer thread only
+	FILE* m_fp{ nullptr };
+	uint64_t m_fileSize{ 0 };
+	std::chrono::steady_clock::time_point m_fileOpened;
+
+	std::atomic<uint64_t> m_dropped{ 0 };
+	std::atomic<uint64_t> m_written{ 0 };
+};
+
+#endif // _INCLUDE_JSONLINESWRITER_H_
@@ -1,5 +1,13 @@
 #include "JsonManager.h"
+#include "JsonFile.h"
+#include "JsonWriteSize.h"
+#include "JsonChunkWriter.h"
+#include "JsonBinary.h"
+#include "JsonPeek.h"
+#include "JsonSnapshot.h"
 #include "extension.h"
+#include <atomic>
+#include <limits>
 
 static inline void ReadInt64FromVal(yyjson_val* val, std::variant<int64_t, uint64_t>* out_value) {
 	if (yyjson_is_uint(val)) {
@@ -31,6 +39,12 @@ static inline void SetErrorSafe(char* error, size_t error_size, const char* form
 	}
 }
 
+uint64_t NextDocGeneration() noexcept {
+	// Documents are also created on the async worker threads
+	static std::atomic<uint64_t> s_generation{ 0 };
+	return s_generation.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
 std::unique_ptr<JsonValue> JsonManager::CreateWrapper() {
 	return std::make_unique<JsonValue>();
 }
@@ -46,15 +60,97 @@ RefPtr<RefCountedMutDoc> JsonManager::CopyDocument(yyjson_doc* doc) {
 	return WrapDocument(yyjson_doc_mut_copy(doc, nullptr));
 }
 
+// Same conversion as yyjson_val_mut_copy, except that strings are not copied and keep
+// pointing into the memory of the source document
+static yyjson_mut_val* MutValsFromImmutable(yyjson_mut_doc* m_doc, yyjson_val* i_vals) {
+	yyjson_val* i_end = unsafe_yyjson_get_next(i_vals);
+	size_t i_vals_len = static_cast<size_t>(i_end - i_vals);
+	yyjson_mut_val* m_vals = unsafe_yyjson_mut_val(m_doc, i_vals_len);
+	if (!m_vals) {
+		return nullptr;
+	}
+
+	yyjson_mut_val* m_val = m_vals;
+	for (yyjson_val* i_val = i_vals; i_val < i_end; i_val++, m_val++) {
+		yyjson_type type = unsafe_yyjson_get_type(i_val);
+		m_val->tag = i_val->tag;
+		m_val->uni.u64 = i_val->uni.u64;
+
+		if (type == YYJSON_TYPE_ARR) {
+			size_t len = unsafe_yyjson_get_len(i_val);
+			if (len > 0) {
+				yyjson_val* ii_val = i_val + 1;
+				yyjson_mut_val* mm_val = m_val + 1;
+				while (len-- > 1) {
+					yyjson_val* ii_next = unsafe_yyjson_get_next(ii_val);
+					yyjson_mut_val* mm_next = mm_val + (ii_next - ii_val);
+					mm_val->next = mm_next;
+					ii_val = ii_next;
+					mm_val = mm_next;
+				}
+				mm_val->next = m_val + 1;
+				m_val->uni.ptr = mm_val;
+			}
+		} else if (type == YYJSON_TYPE_OBJ) {
+			size_t len = unsafe_yyjson_get_len(i_val);
+			if (len > 0) {
+				yyjson_val* ii_key = i_val + 1;
+				yyjson_mut_val* mm_key = m_val + 1;
+				while (len-- > 1) {
+					yyjson_val* ii_nextkey = unsafe_yyjson_get_next(ii_key + 1);
+					yyjson_mut_val* mm_nextkey = mm_key + (ii_nextkey - ii_key);
+					mm_key->next = mm_key + 1;
+					mm_key->next->next = mm_nextkey;
+					ii_key = ii_nextkey;
+					mm_key = mm_nextkey;
+				}
+				mm_key->next = mm_key + 1;
+				mm_key->next->next = m_val + 1;
+				m_val->uni.ptr = mm_key;
+			}
+		}
+	}
+
+	return m_vals;
+}
+
+RefPtr<RefCountedMutDoc> JsonManager::AdoptDocument(yyjson_doc* doc, std::unique_ptr<JsonDocStorage> storage) {
+	if (!doc) {
+		return RefPtr<RefCountedMutDoc>();
+	}
+
+	yyjson_mut_doc* mdoc = yyjson_mut_doc_new(nullptr);
+	yyjson_mut_val* root = mdoc ? MutValsFromImmutable(mdoc, yyjson_doc_get_root(doc)) : nullptr;
+	if (!root) {
+		yyjson_mut_doc_free(mdoc);
+		yyjson_doc_free(doc);
+		return RefPtr<RefCountedMutDoc>();
+	}
+	yyjson_mut_doc_set_root(mdoc, root);
+
+	// Strings live in the parsed document's string pool (or in the caller's storage for in-situ reads),
+	// so the pool is taken over instead of being freed with the document.
+	// Without storage the pool comes from the default libc allocator. With storage it lies inside
+	// the caller's block (pool allocator), which is kept instead.
+	if (doc->str_pool && !storage) {
+		storage = std::make_unique<HeapBuffer>(doc->str_pool);
+	}
+	doc->str_pool = nullptr;
+	yyjson_doc_free(doc);
+
+	return make_ref<RefCountedMutDoc>(mdoc, std::move(storage));
+}
+
 RefPtr<RefCountedMutDoc> JsonManager::CreateDocument() {
 	return WrapDocument(yyjson_mut_doc_new(nullptr));
 }
 
-RefPtr<RefCountedImmutableDoc> JsonManager::WrapImmutableDocument(yyjson_doc* doc) {
+RefPtr<RefCountedImmutableDoc> JsonManager::WrapImmutableDocument(yyjson_doc* doc,
+	std::unique_ptr<JsonDocStorage> storage) {
 	if (!doc) {
 		return RefPtr<RefCountedImmutableDoc>();
 	}
-	return make_ref<RefCountedImmutableDoc>(doc);
+	return make_ref<RefCountedImmutableDoc>(doc, std::move(storage));
 }
 
 RefPtr<RefCountedMutDoc> JsonManager::CloneValueToMutable(JsonValue* value) {
@@ -101,12 +197,249 @@ static yyjson_mut_val* CopyValueIntoDoc(JsonValue* value, yyjson_mut_doc* doc, c
 	return copy;
 }
 
+// Fail a read stopped by a parse limit, the budget holds the details
+static yyjson_doc* FailReadBudget(yyjson_read_err* err)
+{
+	err->pos = 0;
+	err->code = YYJSON_READ_ERROR_MEMORY_ALLOCATION;
+	err->msg = "parse limit exceeded";
+	return nullptr;
+}
+
+// Read a document from a resolved file path, honouring the extension read flags
+// Memory the document points into is returned through out_storage and must outlive the document
+static yyjson_doc* ReadFileDocument(const char* realpath, yyjson_read_flag read_flg,
+	std::unique_ptr<JsonDocStorage>* out_storage, yyjson_read_err* err, JsonReadBudget* budget = nullptr)
+{
+	yyjson_read_flag yy_flg = read_flg & ~JSON_READ_EXT_MASK;
+	const yyjson_alc* alc = budget ? budget->GetAllocator() : nullptr;
+
+	// Compressed files are recognized by their gzip header, whatever their name
+	if (IsGzipFile(realpath)) {
+#ifdef JSON_HAS_ZLIB
+		// Decompression stops as soon as the data no longer fits the limits
+		size_t max_size = budget ? budget->GetInputAllowance() : 0;
+		size_t size = 0;
+		char* block = ReadGzipFile(realpath, YYJSON_PADDING_SIZE, &size, max_size);
+		if (budget && (!budget->CheckInput(size) || !budget->Charge(block ? size + YYJSON_PADDING_SIZE : size))) {
+			free(block);
+			return FailReadBudget(err);
+		}
+		if (!block) {
+			err->pos = 0;
+			err->code = YYJSON_READ_ERROR_FILE_READ;
+			err->msg = "failed to decompress gzip file";
+			return nullptr;
+		}
+
+		yyjson_doc* doc = yyjson_read_opts(block, size, yy_flg | YYJSON_READ_INSITU, alc, err);
+		if (!doc) {
+			free(block);
+			return nullptr;
+		}
+		if (budget) {
+			budget->Detach(doc);
+		}
+		*out_storage = std::make_unique<HeapBuffer>(block);
+		return doc;
+#else
+		err->pos = 0;
+		err->code = YYJSON_READ_ERROR_FILE_READ;
+		err->msg = "gzip compressed files are not supported by this build";
+		return nullptr;
+#endif
+	}
+
+	// The size is known up front, so an oversized file is rejected before any of it is read
+	FileStamp stamp;
+	if (budget && GetFileStamp(realpath, &stamp) && !budget->CheckInput(static_cast<size_t>(stamp.size))) {
+		return FailReadBudget(err);
+	}
+
+	if (read_flg & JSON_READ_MMAP) {
+		std::unique_ptr<MappedFile> mapping = MappedFile::Open(realpath, YYJSON_PADDING_SIZE);
+		if (mapping) {
+			// In-situ parsing writes to the mapped pages, which then take up memory like a read buffer
+			if (budget && !budget->Charge(mapping->size() + YYJSON_PADDING_SIZE)) {
+				return FailReadBudget(err);
+			}
+			yyjson_doc* doc = yyjson_read_opts(mapping->data(), mapping->size(), yy_flg | YYJSON_READ_INSITU, alc, err);
+			if (doc) {
+				if (budget) {
+					budget->Detach(doc);
+				}
+				*out_storage = std::move(mapping);
+			}
+			return doc;
+		}
+		// Fall back to a regular read when the file cannot be mapped, which also reports a proper error
+	}
+
+	yyjson_doc* doc = yyjson_read_file(realpath, yy_flg, alc, err);
+	if (budget) {
+		budget->Detach(doc);
+	}
+	return doc;
+}
+
+// Index of the calling thread's scratch arena, assigned on its first pooled parse
+static thread_local int t_scratchSlot = -1;
+static std::atomic<int> g_scratchSlots{ 0 };
+
+ScratchArena* JsonManager::GetScratchArena()
+{
+	if (t_scratchSlot < 0) {
+		t_scratchSlot = g_scratchSlots.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	if (t_scratchSlot >= static_cast<int>(POOL_SCRATCH_SLOTS)) {
+		return nullptr;
+	}
+
+	return &m_scratch[t_scratchSlot];
+}
+
+yyjson_doc* JsonManager::ReadStringDocument(const char* str, size_t len, yyjson_read_flag read_flg,
+	std::unique_ptr<JsonDocStorage>* out_storage, yyjson_read_err* err, JsonReadBudget* budget)
+{
+	yyjson_read_flag yy_flg = read_flg & ~JSON_READ_EXT_MASK;
+
+	size_t needed = (read_flg & JSON_READ_POOL) ? yyjson_read_max_memory_usage(len, yy_flg) : 0;
+
+	// The pool block is sized for the worst case, the bounded allocator only takes what is used
+	if (needed && budget && !budget->Fits(needed)) {
+		needed = 0;
+	}
+
+	if (!needed) {
+		yyjson_doc* doc = yyjson_read_opts(const_cast<char*>(str), len, yy_flg, budget ? budget->GetAllocator() : nullptr, err);
+		if (budget) {
+			budget->Detach(doc);
+		}
+		return doc;
+	}
+
+	if (budget) {
+		budget->Charge(needed);
+	}
+
+	yyjson_alc alc;
+	ScratchArena* arena = needed <= POOL_SCRATCH_LIMIT ? GetScratchArena() : nullptr;
+	if (arena) {
+		size_t size;
+		char* block = arena->Acquire(needed, POOL_SCRATCH_MIN, &size);
+		if (block) {
+			yyjson_alc_pool_init(&alc, block, size);
+			yyjson_doc* doc = yyjson_read_opts(const_cast<char*>(str), len, yy_flg, &alc, err);
+			if (doc) {
+				*out_storage = arena->Lease();
+			}
+			return doc;
+		}
+	}
+
+	// One block sized for the worst case, released together with the document
+	void* block = malloc(needed);
+	if (!block) {
+		return yyjson_read_opts(const_cast<char*>(str), len, yy_flg, nullptr, err);
+	}
+
+	yyjson_alc_pool_init(&alc, block, needed);
+	yyjson_doc* doc = yyjson_read_opts(const_cast<char*>(str), len, yy_flg, &alc, err);
+	if (!doc) {
+		free(block);
+		return nullptr;
+	}
+
+	*out_storage = std::make_unique<HeapBuffer>(block);
+	return doc;
+}
+
+RefPtr<RefCountedImmutableDoc> JsonManager::ReadFileShared(const char* realpath, yyjson_read_flag read_flg, yyjson_read_err* err,
+	JsonReadBudget* budget)
+{
+	std::unique_ptr<JsonDocStorage> storage;
+
+	if (!(read_flg & JSON_READ_CACHE)) {
+		yyjson_doc* idoc = ReadFileDocument(realpath, read_flg, &storage, err, budget);
+		return WrapImmutableDocument(idoc, std::move(storage));
+	}
+
+	read_flg &= ~JSON_READ_CACHE;
+
+	// A missing file is not cached, the regular read below reports the error
+	FileStamp stamp;
+	if (!GetFileStamp(realpath, &stamp)) {
+		m_fileCache.erase(realpath);
+		yyjson_doc* idoc = ReadFileDocument(realpath, read_flg, &storage, err, budget);
+		return WrapImmutableDocument(idoc, std::move(storage));
+	}
+
+	auto it = m_fileCache.find(realpath);
+	if (it != m_fileCache.end() && it->second.stamp == stamp && it->second.readFlg == read_flg
+		&& it->second.generation == it->second.doc->generation()) {
+		m_fileCacheHits++;
+		memset(err, 0, sizeof(*err));
+		return it->second.doc;
+	}
+
+	m_fileCacheMisses++;
+
+	yyjson_doc* idoc = ReadFileDocument(realpath, read_flg, &storage, err, budget);
+	RefPtr<RefCountedImmutableDoc> doc = WrapImmutableDocument(idoc, std::move(storage));
+	if (!doc) {
+		if (it != m_fileCache.end()) {
+			m_fileCache.erase(it);
+		}
+		return doc;
+	}
+
+	// Handles still holding the previous version keep it alive until they are closed
+	FileCacheEntry& entry = m_fileCache[realpath];
+	entry.doc = doc;
+	entry.stamp = stamp;
+	entry.readFlg = read_flg;
+	entry.generation = doc->generation();
+
+	return doc;
+}
+
 JsonManager::JsonManager(): m_randomGenerator(m_randomDevice()) {}
 
-JsonManager::~JsonManager() {}
+JsonManager::~JsonManager()
+{
+	if (m_writeAlc) {
+		yyjson_alc_dyn_free(m_writeAlc);
+	}
+}
 
 JsonValue* JsonManager::ParseJSON(const char* json_str, bool is_file, bool is_mutable,
 	yyjson_read_flag read_flg, char* error, size_t error_size)
+{
+	return ParseDocument(json_str, is_file, is_mutable, read_flg, nullptr, error, error_size);
+}
+
+JsonValue* JsonManager::ParseJSONLimited(const char* json_str, bool is_file, bool is_mutable, yyjson_read_flag read_flg,
+	const JsonParseLimits& limits, JSON_PARSE_LIMIT* out_exceeded, char* error, size_t error_size)
+{
+	if (out_exceeded) {
+		*out_exceeded = JSON_LIMIT_NONE;
+	}
+
+	if (limits.IsUnlimited()) {
+		return ParseDocument(json_str, is_file, is_mutable, read_flg, nullptr, error, error_size);
+	}
+
+	JsonReadBudget budget(limits);
+	JsonValue* value = ParseDocument(json_str, is_file, is_mutable, read_flg, &budget, error, error_size);
+	if (out_exceeded) {
+		*out_exceeded = budget.GetExceeded();
+	}
+	return value;
+}
+
+JsonValue* JsonManager::ParseDocument(const char* json_str, bool is_file, bool is_mutable,
+	yyjson_read_flag read_flg, JsonReadBudget* budget, char* error, size_t error_size)
 {
 	if (!json_str) {
 		if (error && error_size > 0) {
@@ -117,14 +450,35 @@ JsonValue* JsonManager::ParseJSON(const char* json_str, bool is_file, bool is_mu
 
 	yyjson_read_err readError;
 	yyjson_doc* idoc;
+	std::unique_ptr<JsonDocStorage> storage;
+	RefPtr<RefCountedImmutableDoc> cached;
 	auto pJSONValue = CreateWrapper();
 
 	if (is_file) {
 		char realpath[PLATFORM_MAX_PATH];
 		smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", json_str);
-		idoc = yyjson_read_file(realpath, read_flg, nullptr, &readError);
+		if (read_flg & JSON_READ_CACHE) {
+			cached = ReadFileShared(realpath, read_flg, &readError, budget);
+			idoc = cached ? cached->get() : nullptr;
+		} else {
+			idoc = ReadFileDocument(realpath, read_flg, &storage, &readError, budget);
+		}
 	} else {
-		idoc = yyjson_read_opts(const_cast<char*>(json_str), strlen(json_str), read_flg, nullptr, &readError);
+		size_t len = strlen(json_str);
+		idoc = budget && !budget->CheckInput(len) ? nullptr
+			: ReadStringDocument(json_str, len, read_flg, &storage, &readError, budget);
+	}
+
+	if (budget && idoc && !budget->CheckDocument(idoc)) {
+		if (!cached) {
+			yyjson_doc_free(idoc);
+		}
+		idoc = nullptr;
+	}
+
+	if (budget && budget->GetExceeded() != JSON_LIMIT_NONE) {
+		budget->FormatError(error, error_size);
+		return nullptr;
 	}
 
 	if (!idoc || readError.code) {
@@ -143,8 +497,8 @@ JsonValue* JsonManager::ParseJSON(const char* json_str, bool is_file, bool is_mu
 	pJSONValue->m_readSize = yyjson_doc_get_read_size(idoc);
 
 	if (is_mutable) {
-		pJSONValue->m_pDocument_mut = CopyDocument(idoc);
-		yyjson_doc_free(idoc);
+		// A shared cached document must stay intact, so it is copied instead of adopted
+		pJSONValue->m_pDocument_mut = cached ? CopyDocument(idoc) : AdoptDocument(idoc, std::move(storage));
 		if (!pJSONValue->m_pDocument_mut) {
 			SetErrorSafe(error, error_size, "Failed to create mutable JSON document");
 			return nullptr;
@@ -155,15 +509,18 @@ JsonValue* JsonManager::ParseJSON(const char* json_str, bool is_file, bool is_mu
 			return nullptr;
 		}
 	} else {
-		pJSONValue->m_pDocument = WrapImmutableDocument(idoc);
+		pJSONValue->m_pDocument = cached ? cached : WrapImmutableDocument(idoc, std::move(storage));
 		if (!pJSONValue->m_pDocument) {
-			yyjson_doc_free(idoc);
+			// A cached document belongs to the cache
+			if (!cached) {
+				yyjson_doc_free(idoc);
+			}
 			SetErrorSafe(error, error_size, "Failed to create immutable JSON document");
 			return nullptr;
 		}
+		// The wrapper owns the document from here and frees it with itself
 		pJSONValue->m_pVal = yyjson_doc_get_root(idoc);
 		if (!pJSONValue->m_pVal) {
-			yyjson_doc_free(idoc);
 			SetErrorSafe(error, error_size, "Immutable JSON document has no root value");
 			return nullptr;
 		}
@@ -172,6 +529,124 @@ JsonValue* JsonManager::ParseJSON(const char* json_str, bool is_file, bool is_mu
 	return pJSONValue.release();
 }
 
+bool JsonManager::ValidateJSON(const char* str, uint32_t read_flg, uint8_t* out_type, size_t* out_read_size,
+	size_t* out_error_pos)
+{
+	*out_type = YYJSON_TYPE_NONE;
+	*out_read_size = 0;
+	*out_error_pos = 0;
+
+	if (!str) {
+		return false;
+	}
+
+	// The input is only read, and the document is dropped as soon as the reader is done with it
+	size_t len = strlen(str);
+	yyjson_read_flag yy_flg = read_flg & ~(JSON_READ_EXT_MASK | YYJSON_READ_INSITU);
+	yyjson_read_err readError;
+	yyjson_doc* doc = nullptr;
+
+	// The scratch block is not leased, so the next check reuses it right away
+	size_t needed = yyjson_read_max_memory_usage(len, yy_flg);
+	ScratchArena* arena = needed && needed <= POOL_SCRATCH_LIMIT ? GetScratchArena() : nullptr;
+	size_t size;
+	char* block = arena ? arena->Acquire(needed, POOL_SCRATCH_MIN, &size) : nullptr;
+	if (block) {
+		yyjson_alc alc;
+		yyjson_alc_pool_init(&alc, block, size);
+		doc = yyjson_read_opts(const_cast<char*>(str), len, yy_flg, &alc, &readError);
+	} else {
+		doc = yyjson_read_opts(const_cast<char*>(str), len, yy_flg, nullptr, &readError);
+	}
+
+	if (!doc) {
+		*out_error_pos = readError.pos;
+		return false;
+	}
+
+	*out_type = yyjson_get_type(yyjson_doc_get_root(doc));
+	*out_read_size = yyjson_doc_get_read_size(doc);
+	yyjson_doc_free(doc);
+	return true;
+}
+
+JsonValue* JsonManager::PeekPointer(const char* source, bool is_file, const char* pointer, uint32_t read_flg,
+	char* error, size_t error_size)
+{
+	if (!source || !pointer) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return nullptr;
+	}
+
+	// Only the text of the target is handed to the reader, which copies it
+	yyjson_read_flag yy_flg = read_flg & ~(JSON_READ_EXT_MASK | YYJSON_READ_INSITU | YYJSON_READ_STOP_WHEN_DONE);
+
+	std::unique_ptr<JsonDocStorage> storage;
+	const char* data;
+	size_t size;
+
+	if (is_file) {
+		char realpath[PLATFORM_MAX_PATH];
+		smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", source);
+
+		if (IsGzipFile(realpath)) {
+#ifdef JSON_HAS_ZLIB
+			char* block = ReadGzipFile(realpath, 0, &size);
+			if (!block) {
+				SetErrorSafe(error, error_size, "Failed to decompress gzip file: %s", source);
+				return nullptr;
+			}
+			storage = std::make_unique<HeapBuffer>(block);
+			data = block;
+#else
+			SetErrorSafe(error, error_size, "gzip compressed files are not supported by this build: %s", source);
+			return nullptr;
+#endif
+		} else {
+			// Pages past the target are never touched, so they are never read from disk
+			std::unique_ptr<MappedFile> mapping = MappedFile::Open(realpath, 0);
+			if (!mapping) {
+				SetErrorSafe(error, error_size, "Failed to read file: %s", source);
+				return nullptr;
+			}
+			data = mapping->data();
+			size = mapping->size();
+			storage = std::move(mapping);
+		}
+	} else {
+		data = source;
+		size = strlen(source);
+	}
+
+	JsonPointerScanner scanner(data, size, yy_flg);
+	size_t offset, len;
+	if (!scanner.Find(pointer, strlen(pointer), &offset, &len)) {
+		if (scanner.IsPointerError()) {
+			SetErrorSafe(error, error_size, "Failed to resolve JSON pointer: %s (position: %zu, path: %s)",
+				scanner.GetError(), scanner.GetErrorPos(), pointer);
+		} else {
+			SetErrorSafe(error, error_size, "Failed to scan JSON for path '%s': %s (position: %zu)",
+				pointer, scanner.GetError(), scanner.GetErrorPos());
+		}
+		return nullptr;
+	}
+
+	yyjson_read_err readError;
+	yyjson_doc* idoc = yyjson_read_opts(const_cast<char*>(data + offset), len, yy_flg, nullptr, &readError);
+	if (!idoc) {
+		SetErrorSafe(error, error_size, "Failed to parse JSON value at path '%s': %s (error code: %u, position: %zu)",
+			pointer, readError.msg, readError.code, offset + readError.pos);
+		return nullptr;
+	}
+
+	auto pJSONValue = CreateWrapper();
+	pJSONValue->m_readSize = len;
+	pJSONValue->m_pDocument = WrapImmutableDocument(idoc);
+	pJSONValue->m_pVal = yyjson_doc_get_root(idoc);
+
+	return pJSONValue.release();
+}
+
 bool JsonManager::WriteToString(JsonValue* handle, char* buffer, size_t buffer_size,
 	yyjson_write_flag write_flg, size_t* out_size)
 {
@@ -225,88 +700,288 @@ char* JsonManager::WriteToStringPtr(JsonValue* handle, yyjson_write_flag write_f
 	return json_str;
 }
 
-JsonValue* JsonManager::ApplyJsonPatch(JsonValue* target, JsonValue* patch, bool result_mutable,
-	char* error, size_t error_size)
+char* JsonManager::WriteScratch(JsonValue* handle, yyjson_write_flag write_flg, size_t* len, bool whole_doc)
 {
-	if (!target || !patch) {
-		SetErrorSafe(error, error_size, "Target or patch JSON value is null");
-		return nullptr;
+	if (!m_writeAlc) {
+		m_writeAlc = yyjson_alc_dyn_new();
+		if (!m_writeAlc) {
+			return nullptr;
+		}
 	}
 
-	auto docRef = CloneValueToMutable(target);
-	if (!docRef) {
-		SetErrorSafe(error, error_size, "Failed to clone target JSON value");
-		return nullptr;
+	if (handle->IsMutable()) {
+		yyjson_mut_val* val = whole_doc ? yyjson_mut_doc_get_root(handle->m_pDocument_mut->get()) : handle->m_pVal_mut;
+		return yyjson_mut_val_write_opts(val, write_flg, m_writeAlc, len, nullptr);
 	}
+	yyjson_val* val = whole_doc ? yyjson_doc_get_root(handle->m_pDocument->get()) : handle->m_pVal;
+	return yyjson_val_write_opts(val, write_flg, m_writeAlc, len, nullptr);
+}
 
-	yyjson_mut_doc* doc = docRef->get();
-	yyjson_mut_val* root = yyjson_mut_doc_get_root(doc);
-	if (!root) {
-		SetErrorSafe(error, error_size, "Target JSON has no root value");
-		return nullptr;
-	}
+void JsonManager::FreeScratch(char* str)
+{
+	m_writeAlc->free(m_writeAlc->ctx, str);
+}
 
-	yyjson_mut_val* patchCopy = CopyValueIntoDoc(patch, doc, error, error_size);
-	if (!patchCopy) {
+const std::string* JsonManager::WriteCached(JsonValue* handle, yyjson_write_flag write_flg, bool whole_doc)
+{
+	if (m_writeCacheLimit == 0) {
 		return nullptr;
 	}
 
-	yyjson_patch_err patch_err = {0};
-	yyjson_mut_val* resultRoot = yyjson_mut_patch(doc, root, patchCopy, &patch_err);
-	if (!resultRoot) {
-		SetErrorSafe(error, error_size, "JSON patch failed (code %u, op index %zu, message: %s)",
-			patch_err.code, patch_err.idx, patch_err.msg);
-		return nullptr;
+	WriteCacheKey key;
+	uint64_t generation;
+
+	if (handle->IsMutable()) {
+		key.doc = handle->m_pDocument_mut.get();
+		key.val = whole_doc ? yyjson_mut_doc_get_root(handle->m_pDocument_mut->get()) : handle->m_pVal_mut;
+		generation = handle->m_pDocument_mut->generation();
+	} else {
+		key.doc = handle->m_pDocument.get();
+		key.val = whole_doc ? yyjson_doc_get_root(handle->m_pDocument->get()) : handle->m_pVal;
+		generation = handle->m_pDocument->generation();
 	}
+	key.writeFlg = write_flg;
 
-	yyjson_mut_doc_set_root(doc, resultRoot);
+	auto it = m_writeCache.find(key);
+	if (it != m_writeCache.end()) {
+		if (it->second.generation == generation) {
+			m_writeCacheHits++;
+			m_writeCacheLru.splice(m_writeCacheLru.begin(), m_writeCacheLru, it->second.lru);
+			return &it->second.data;
+		}
 
-	if (result_mutable) {
-		auto wrapper = CreateWrapper();
-		wrapper->m_pDocument_mut = docRef;
-		wrapper->m_pVal_mut = yyjson_mut_doc_get_root(doc);
-		docRef.reset();
-		return wrapper.release();
+		// The document was modified since, drop the stale output
+		m_writeCacheBytes -= it->second.data.size();
+		m_writeCacheLru.erase(it->second.lru);
+		m_writeCache.erase(it);
 	}
 
-	yyjson_doc* imutDoc = yyjson_mut_doc_imut_copy(doc, nullptr);
-	if (!imutDoc) {
-		SetErrorSafe(error, error_size, "Failed to convert patched JSON to immutable document");
+	m_writeCacheMisses++;
+
+	size_t len = 0;
+	char* str = WriteScratch(handle, write_flg, &len, whole_doc);
+	if (!str) {
 		return nullptr;
 	}
 
-	auto wrapper = CreateWrapper();
-	wrapper->m_pDocument = WrapImmutableDocument(imutDoc);
-	if (!wrapper->m_pDocument) {
-		yyjson_doc_free(imutDoc);
-		SetErrorSafe(error, error_size, "Failed to wrap immutable JSON document");
-		return nullptr;
+	// Output larger than the whole cache is handed back once without being kept
+	if (len > m_writeCacheLimit) {
+		m_writeCacheSpill.assign(str, len);
+		FreeScratch(str);
+		return &m_writeCacheSpill;
 	}
-	wrapper->m_pVal = yyjson_doc_get_root(imutDoc);
-	return wrapper.release();
+
+	EvictWriteCache(m_writeCacheLimit - len);
+
+	m_writeCacheLru.push_front(key);
+	WriteCacheEntry& entry = m_writeCache[key];
+	entry.data.assign(str, len);
+	entry.generation = generation;
+	entry.lru = m_writeCacheLru.begin();
+	m_writeCacheBytes += len;
+	FreeScratch(str);
+
+	return &entry.data;
 }
 
-bool JsonManager::JsonPatchInPlace(JsonValue* target, JsonValue* patch,
-	char* error, size_t error_size)
+void JsonManager::EvictWriteCache(size_t limit)
 {
-	if (!target || !patch) {
-		SetErrorSafe(error, error_size, "Target or patch JSON value is null");
-		return false;
+	while (m_writeCacheBytes > limit && !m_writeCacheLru.empty()) {
+		auto it = m_writeCache.find(m_writeCacheLru.back());
+		m_writeCacheBytes -= it->second.data.size();
+		m_writeCache.erase(it);
+		m_writeCacheLru.pop_back();
 	}
+}
 
-	if (!target->IsMutable()) {
-		SetErrorSafe(error, error_size, "Target JSON must be mutable for in-place JSON Patch");
-		return false;
+void JsonManager::SetWriteCacheLimit(size_t bytes)
+{
+	m_writeCacheLimit = bytes;
+	EvictWriteCache(bytes);
+	if (bytes == 0) {
+		std::string().swap(m_writeCacheSpill);
 	}
+}
 
-	yyjson_mut_doc* doc = target->m_pDocument_mut->get();
-	yyjson_mut_val* root = target->m_pVal_mut;
-
-	if (!doc || !root) {
-		SetErrorSafe(error, error_size, "Target JSON has no root value");
-		return false;
+void JsonManager::GetWriteCacheStats(uint64_t* hits, uint64_t* misses, size_t* entries, size_t* bytes)
+{
+	if (hits) {
+		*hits = m_writeCacheHits;
+	}
+	if (misses) {
+		*misses = m_writeCacheMisses;
+	}
+	if (entries) {
+		*entries = m_writeCache.size();
+	}
+	if (bytes) {
+		*bytes = m_writeCacheBytes;
+	}
+}
+
+void JsonManager::ClearWriteCache()
+{
+	m_writeCache.clear();
+	m_writeCacheLru.clear();
+	std::string().swap(m_writeCacheSpill);
+	m_writeCacheBytes = 0;
+	m_writeCacheHits = 0;
+	m_writeCacheMisses = 0;
+}
+
+void JsonManager::SetKeyIndexThreshold(size_t min_keys)
+{
+	m_keyIndexThreshold = min_keys;
+}
+
+void JsonManager::GetKeyIndexStats(size_t* indexes, size_t* bytes)
+{
+	JsonKeyIndex::GetStats(indexes, bytes);
+}
+
+bool JsonManager::WriteToBuffer(JsonValue* handle, char* buffer, size_t buffer_size,
+	uint32_t write_flg, size_t* out_size)
+{
+	if (!handle) {
+		return false;
+	}
+
+	if (const std::string* cached = WriteCached(handle, write_flg)) {
+		size_t len = cached->size();
+		if (out_size) {
+			*out_size = len + 1;
+		}
+		if (!buffer || len >= buffer_size) {
+			return false;
+		}
+		memcpy(buffer, cached->data(), len);
+		buffer[len] = '\0';
+		return true;
+	}
+
+	// yyjson needs temporary space beyond the output, decide up front so the value is serialized once
+	size_t needed = handle->IsMutable()
+		? EstimateWriteBuffer(handle->m_pVal_mut, write_flg)
+		: EstimateWriteBuffer(handle->m_pVal, write_flg);
+	if (buffer && buffer_size >= needed) {
+		if (WriteToString(handle, buffer, buffer_size, write_flg, out_size)) {
+			return true;
+		}
+		// Enough room, so the value itself can't be written
+		if (out_size) {
+			*out_size = 0;
+		}
+		return false;
+	}
+
+	// Tight buffer: the output may still fit once written to scratch memory, or the caller needs the real size
+	size_t len = 0;
+	char* str = WriteScratch(handle, write_flg, &len);
+	if (!str) {
+		if (out_size) {
+			*out_size = 0;
+		}
+		return false;
+	}
+
+	if (out_size) {
+		*out_size = len + 1;
+	}
+
+	bool fits = buffer && len < buffer_size;
+	if (fits) {
+		memcpy(buffer, str, len);
+		buffer[len] = '\0';
+	}
+	FreeScratch(str);
+
+	return fits;
+}
+
+JsonValue* JsonManager::ApplyJsonPatch(JsonValue* target, JsonValue* patch, bool result_mutable,
+	char* error, size_t error_size)
+{
+	if (!target || !patch) {
+		SetErrorSafe(error, error_size, "Target or patch JSON value is null");
+		return nullptr;
+	}
+
+	auto docRef = CloneValueToMutable(target);
+	if (!docRef) {
+		SetErrorSafe(error, error_size, "Failed to clone target JSON value");
+		return nullptr;
+	}
+
+	yyjson_mut_doc* doc = docRef->get();
+	yyjson_mut_val* root = yyjson_mut_doc_get_root(doc);
+	if (!root) {
+		SetErrorSafe(error, error_size, "Target JSON has no root value");
+		return nullptr;
+	}
+
+	yyjson_mut_val* patchCopy = CopyValueIntoDoc(patch, doc, error, error_size);
+	if (!patchCopy) {
+		return nullptr;
+	}
+
+	yyjson_patch_err patch_err = {0};
+	yyjson_mut_val* resultRoot = yyjson_mut_patch(doc, root, patchCopy, &patch_err);
+	if (!resultRoot) {
+		SetErrorSafe(error, error_size, "JSON patch failed (code %u, op index %zu, message: %s)",
+			patch_err.code, patch_err.idx, patch_err.msg);
+		return nullptr;
+	}
+
+	yyjson_mut_doc_set_root(doc, resultRoot);
+
+	if (result_mutable) {
+		auto wrapper = CreateWrapper();
+		wrapper->m_pDocument_mut = docRef;
+		wrapper->m_pVal_mut = yyjson_mut_doc_get_root(doc);
+		docRef.reset();
+		return wrapper.release();
+	}
+
+	yyjson_doc* imutDoc = yyjson_mut_doc_imut_copy(doc, nullptr);
+	if (!imutDoc) {
+		SetErrorSafe(error, error_size, "Failed to convert patched JSON to immutable document");
+		return nullptr;
+	}
+
+	auto wrapper = CreateWrapper();
+	wrapper->m_pDocument = WrapImmutableDocument(imutDoc);
+	if (!wrapper->m_pDocument) {
+		yyjson_doc_free(imutDoc);
+		SetErrorSafe(error, error_size, "Failed to wrap immutable JSON document");
+		return nullptr;
+	}
+	wrapper->m_pVal = yyjson_doc_get_root(imutDoc);
+	return wrapper.release();
+}
+
+bool JsonManager::JsonPatchInPlace(JsonValue* target, JsonValue* patch,
+	char* error, size_t error_size)
+{
+	if (!target || !patch) {
+		SetErrorSafe(error, error_size, "Target or patch JSON value is null");
+		return false;
+	}
+
+	if (!target->IsMutable()) {
+		SetErrorSafe(error, error_size, "Target JSON must be mutable for in-place JSON Patch");
+		return false;
+	}
+
+	yyjson_mut_doc* doc = target->m_pDocument_mut->get();
+	yyjson_mut_val* root = target->m_pVal_mut;
+
+	if (!doc || !root) {
+		SetErrorSafe(error, error_size, "Target JSON has no root value");
+		return false;
 	}
 
+	target->MarkModified();
+
 	yyjson_mut_val* patchCopy = CopyValueIntoDoc(patch, doc, error, error_size);
 	if (!patchCopy) {
 		return false;
@@ -367,87 +1042,1283 @@ JsonValue* JsonManager::ApplyMergePatch(JsonValue* target, JsonValue* patch, boo
 		return wrapper.release();
 	}
 
-	yyjson_doc* imutDoc = yyjson_mut_doc_imut_copy(doc, nullptr);
-	if (!imutDoc) {
-		SetErrorSafe(error, error_size, "Failed to convert patched JSON to immutable document");
+	yyjson_doc* imutDoc = yyjson_mut_doc_imut_copy(doc, nullptr);
+	if (!imutDoc) {
+		SetErrorSafe(error, error_size, "Failed to convert patched JSON to immutable document");
+		return nullptr;
+	}
+
+	auto wrapper = CreateWrapper();
+	wrapper->m_pDocument = WrapImmutableDocument(imutDoc);
+	if (!wrapper->m_pDocument) {
+		yyjson_doc_free(imutDoc);
+		SetErrorSafe(error, error_size, "Failed to wrap immutable JSON document");
+		return nullptr;
+	}
+	wrapper->m_pVal = yyjson_doc_get_root(imutDoc);
+	return wrapper.release();
+}
+
+bool JsonManager::MergePatchInPlace(JsonValue* target, JsonValue* patch,
+	char* error, size_t error_size)
+{
+	if (!target || !patch) {
+		SetErrorSafe(error, error_size, "Target or patch JSON value is null");
+		return false;
+	}
+
+	if (!target->IsMutable()) {
+		SetErrorSafe(error, error_size, "Target JSON must be mutable for in-place merge patch");
+		return false;
+	}
+
+	yyjson_mut_doc* doc = target->m_pDocument_mut->get();
+	yyjson_mut_val* root = target->m_pVal_mut;
+
+	if (!doc || !root) {
+		SetErrorSafe(error, error_size, "Target JSON has no root value");
+		return false;
+	}
+
+	target->MarkModified();
+
+	yyjson_mut_val* patchCopy = CopyValueIntoDoc(patch, doc, error, error_size);
+	if (!patchCopy) {
+		return false;
+	}
+
+	yyjson_mut_val* resultRoot = yyjson_mut_merge_patch(doc, root, patchCopy);
+	if (!resultRoot) {
+		SetErrorSafe(error, error_size, "Failed to apply JSON Merge Patch in place");
+		return false;
+	}
+
+	yyjson_mut_doc_set_root(doc, resultRoot);
+	target->m_pVal_mut = yyjson_mut_doc_get_root(doc);
+	return true;
+}
+
+bool JsonManager::WriteToFile(JsonValue* handle, const char* path, yyjson_write_flag write_flg,
+	char* error, size_t error_size)
+{
+	if (!handle || !path) {
+		if (error && error_size > 0) {
+			SetErrorSafe(error, error_size, "Invalid parameters");
+		}
+		return false;
+	}
+
+	char realpath[PLATFORM_MAX_PATH];
+	smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", path);
+
+	if (IsGzipPath(realpath)) {
+		return WriteGzipFile(realpath, handle, true, write_flg, false, error, error_size);
+	}
+
+	if (const std::string* cached = WriteCached(handle, write_flg, true)) {
+		FILE* fp = fopen(realpath, "wb");
+		if (!fp) {
+			SetErrorSafe(error, error_size, "Failed to open file for writing: %s", realpath);
+			return false;
+		}
+
+		bool written = fwrite(cached->data(), 1, cached->size(), fp) == cached->size();
+		if (fclose(fp) != 0) {
+			written = false;
+		}
+		if (!written) {
+			SetErrorSafe(error, error_size, "Failed to write JSON to file: %s", realpath);
+		}
+		return written;
+	}
+
+	yyjson_write_err writeError;
+	bool is_success;
+
+	if (handle->IsMutable()) {
+		is_success = yyjson_mut_write_file(realpath, handle->m_pDocument_mut->get(), write_flg, nullptr, &writeError);
+	} else {
+		is_success = yyjson_write_file(realpath, handle->m_pDocument->get(), write_flg, nullptr, &writeError);
+	}
+
+	if (writeError.code && error && error_size > 0) {
+		SetErrorSafe(error, error_size, "Failed to write JSON to file: %s (error code: %u)", writeError.msg, writeError.code);
+	}
+
+	return is_success;
+}
+
+// Writes chunks straight to an open file
+class FileChunkSink : public IJsonChunkSink
+{
+public:
+	explicit FileChunkSink(FILE* fp) : m_fp(fp) {}
+
+	bool WriteChunk(const char* data, size_t len) override
+	{
+		m_failed = fwrite(data, 1, len, m_fp) != len;
+		return !m_failed;
+	}
+
+	bool Failed() const { return m_failed; }
+
+private:
+	FILE* m_fp;
+	bool m_failed{ false };
+};
+
+bool JsonManager::WriteChunked(JsonValue* handle, IJsonChunkSink* sink, uint32_t write_flg, size_t chunk_size,
+	char* error, size_t error_size)
+{
+	if (!handle || !sink) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return false;
+	}
+
+	// The sink may run plugin code that frees the handle, the writer keeps walking the document it held
+	RefPtr<RefCountedMutDoc> mut_doc = handle->m_pDocument_mut;
+	RefPtr<RefCountedImmutableDoc> doc = handle->m_pDocument;
+	yyjson_mut_val* val_mut = handle->m_pVal_mut;
+	yyjson_val* val = handle->m_pVal;
+
+	JsonChunkWriter writer(sink, chunk_size);
+	bool is_success;
+
+	if (mut_doc) {
+		is_success = writer.Write(val_mut, write_flg);
+	} else {
+		is_success = writer.Write(val, write_flg);
+	}
+
+	if (!is_success) {
+		SetErrorSafe(error, error_size, "Failed to write JSON: %s", writer.GetError());
+	}
+
+	return is_success;
+}
+
+bool JsonManager::WriteToFileChunked(JsonValue* handle, const char* path, uint32_t write_flg, size_t chunk_size,
+	char* error, size_t error_size)
+{
+	if (!handle || !path) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return false;
+	}
+
+	char realpath[PLATFORM_MAX_PATH];
+	smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", path);
+
+	if (IsGzipPath(realpath)) {
+		return WriteGzipFile(realpath, handle, false, write_flg, false, error, error_size);
+	}
+
+	FILE* fp = fopen(realpath, "wb");
+	if (!fp) {
+		SetErrorSafe(error, error_size, "Failed to open file for writing: %s", realpath);
+		return false;
+	}
+
+	FileChunkSink sink(fp);
+	bool is_success = WriteChunked(handle, &sink, write_flg, chunk_size, error, error_size);
+
+	if ((fclose(fp) != 0 && is_success) || sink.Failed()) {
+		SetErrorSafe(error, error_size, "Failed to write JSON to file: %s", realpath);
+		is_success = false;
+	}
+
+	return is_success;
+}
+
+#ifdef JSON_HAS_ZLIB
+// Compresses chunks into an open file
+class GzipChunkSink : public IJsonChunkSink
+{
+public:
+	explicit GzipChunkSink(FILE* fp) : m_writer(fp) {}
+
+	bool WriteChunk(const char* data, size_t len) override
+	{
+		return m_writer.Write(data, len);
+	}
+
+	bool Finish() { return m_writer.Finish(); }
+
+private:
+	GzipFileWriter m_writer;
+};
+#endif
+
+bool JsonManager::WriteGzipFile(const char* realpath, JsonValue* handle, bool whole_doc, uint32_t write_flg,
+	bool sync, char* error, size_t error_size)
+{
+#ifdef JSON_HAS_ZLIB
+	FILE* fp = fopen(realpath, "wb");
+	if (!fp) {
+		SetErrorSafe(error, error_size, "Failed to open file for writing: %s", realpath);
+		return false;
+	}
+
+	// Serialized in chunks that are compressed as they fill up, the uncompressed output is never held whole
+	GzipChunkSink sink(fp);
+	JsonChunkWriter writer(&sink, JsonChunkWriter::DEFAULT_CHUNK_SIZE);
+	bool is_success;
+
+	if (handle->IsMutable()) {
+		yyjson_mut_val* val = whole_doc ? yyjson_mut_doc_get_root(handle->m_pDocument_mut->get()) : handle->m_pVal_mut;
+		is_success = writer.Write(val, write_flg);
+	} else {
+		yyjson_val* val = whole_doc ? yyjson_doc_get_root(handle->m_pDocument->get()) : handle->m_pVal;
+		is_success = writer.Write(val, write_flg);
+	}
+
+	if (!is_success) {
+		fclose(fp);
+		SetErrorSafe(error, error_size, "Failed to write JSON to file: %s", writer.GetError());
+		return false;
+	}
+
+	bool flushed = sink.Finish() && (sync ? SyncFileToDisk(fp) : (fflush(fp) == 0));
+	if (fclose(fp) != 0 || !flushed) {
+		SetErrorSafe(error, error_size, "Failed to write JSON to file: %s", realpath);
+		return false;
+	}
+
+	return true;
+#else
+	SetErrorSafe(error, error_size, "gzip compressed files are not supported by this build: %s", realpath);
+	return false;
+#endif
+}
+
+static bool IsBinaryFormat(JSON_BINARY_FORMAT format)
+{
+	return format == JSON_BINARY_MSGPACK || format == JSON_BINARY_CBOR;
+}
+
+static const char* BinaryFormatName(JSON_BINARY_FORMAT format)
+{
+	return format == JSON_BINARY_CBOR ? "CBOR" : "MessagePack";
+}
+
+static bool EncodeBinary(JsonBinaryWriter& writer, JsonValue* handle)
+{
+	if (handle->IsMutable()) {
+		return writer.Write(handle->m_pVal_mut);
+	}
+	return writer.Write(handle->m_pVal);
+}
+
+// Copies output into a caller buffer, and keeps counting once it is full so the needed size can be reported
+class BufferChunkSink : public IJsonChunkSink
+{
+public:
+	BufferChunkSink(char* buffer, size_t size) : m_buffer(buffer), m_size(size) {}
+
+	bool WriteChunk(const char* data, size_t len) override
+	{
+		if (m_used <= m_size && len <= m_size - m_used) {
+			memcpy(m_buffer + m_used, data, len);
+		}
+		m_used += len;
+		return true;
+	}
+
+	size_t Used() const { return m_used; }
+	bool Fits() const { return m_used <= m_size; }
+
+private:
+	char* m_buffer;
+	size_t m_size;
+	size_t m_used{ 0 };
+};
+
+bool JsonManager::WriteBinary(JsonValue* handle, JSON_BINARY_FORMAT format, char* buffer, size_t buffer_size,
+	size_t* out_size, char* error, size_t error_size)
+{
+	if (out_size) {
+		*out_size = 0;
+	}
+
+	if (!handle || (!buffer && buffer_size > 0)) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return false;
+	}
+
+	if (!IsBinaryFormat(format)) {
+		SetErrorSafe(error, error_size, "Invalid binary format: %d", format);
+		return false;
+	}
+
+	BufferChunkSink sink(buffer, buffer_size);
+	JsonBinaryWriter writer(&sink, format);
+
+	if (!EncodeBinary(writer, handle)) {
+		SetErrorSafe(error, error_size, "Failed to encode JSON as %s: %s", BinaryFormatName(format), writer.GetError());
+		return false;
+	}
+
+	if (out_size) {
+		*out_size = sink.Used();
+	}
+
+	if (!sink.Fits()) {
+		SetErrorSafe(error, error_size, "Buffer too small (need %zu, have %zu)", sink.Used(), buffer_size);
+		return false;
+	}
+
+	return true;
+}
+
+bool JsonManager::WriteBinaryToFile(JsonValue* handle, JSON_BINARY_FORMAT format, const char* path,
+	char* error, size_t error_size)
+{
+	if (!handle || !path) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return false;
+	}
+
+	if (!IsBinaryFormat(format)) {
+		SetErrorSafe(error, error_size, "Invalid binary format: %d", format);
+		return false;
+	}
+
+	char realpath[PLATFORM_MAX_PATH];
+	smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", path);
+
+	bool gzip = IsGzipPath(realpath);
+#ifndef JSON_HAS_ZLIB
+	if (gzip) {
+		SetErrorSafe(error, error_size, "gzip compressed files are not supported by this build: %s", realpath);
+		return false;
+	}
+#endif
+
+	FILE* fp = fopen(realpath, "wb");
+	if (!fp) {
+		SetErrorSafe(error, error_size, "Failed to open file for writing: %s", realpath);
+		return false;
+	}
+
+	FileChunkSink file_sink(fp);
+	IJsonChunkSink* sink = &file_sink;
+#ifdef JSON_HAS_ZLIB
+	std::unique_ptr<GzipChunkSink> gzip_sink;
+	if (gzip) {
+		gzip_sink = std::make_unique<GzipChunkSink>(fp);
+		sink = gzip_sink.get();
+	}
+#endif
+
+	JsonBinaryWriter writer(sink, format);
+	bool is_success = EncodeBinary(writer, handle);
+	bool write_failed = file_sink.Failed();
+
+	if (!is_success) {
+		SetErrorSafe(error, error_size, "Failed to encode JSON as %s: %s", BinaryFormatName(format), writer.GetError());
+	}
+
+#ifdef JSON_HAS_ZLIB
+	if (is_success && gzip_sink && !gzip_sink->Finish()) {
+		write_failed = true;
+	}
+#endif
+
+	if (fclose(fp) != 0 || write_failed) {
+		SetErrorSafe(error, error_size, "Failed to write %s to file: %s", BinaryFormatName(format), realpath);
+		is_success = false;
+	}
+
+	return is_success;
+}
+
+JsonValue* JsonManager::WrapBinaryDocument(yyjson_doc* idoc, bool is_mutable, char* error, size_t error_size)
+{
+	auto pJSONValue = CreateWrapper();
+	pJSONValue->m_readSize = yyjson_doc_get_read_size(idoc);
+
+	if (is_mutable) {
+		pJSONValue->m_pDocument_mut = AdoptDocument(idoc, nullptr);
+		if (!pJSONValue->m_pDocument_mut) {
+			SetErrorSafe(error, error_size, "Failed to create mutable JSON document");
+			return nullptr;
+		}
+		pJSONValue->m_pVal_mut = yyjson_mut_doc_get_root(pJSONValue->m_pDocument_mut->get());
+	} else {
+		pJSONValue->m_pDocument = WrapImmutableDocument(idoc);
+		pJSONValue->m_pVal = yyjson_doc_get_root(idoc);
+	}
+
+	return pJSONValue.release();
+}
+
+JsonValue* JsonManager::ParseBinary(const void* data, size_t size, JSON_BINARY_FORMAT format, bool is_mutable,
+	char* error, size_t error_size)
+{
+	if (!data) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return nullptr;
+	}
+
+	if (!IsBinaryFormat(format)) {
+		SetErrorSafe(error, error_size, "Invalid binary format: %d", format);
+		return nullptr;
+	}
+
+	const char* decodeError;
+	size_t errorPos;
+	yyjson_doc* idoc = ReadBinaryDocument(static_cast<const char*>(data), size, format, &decodeError, &errorPos);
+	if (!idoc) {
+		SetErrorSafe(error, error_size, "Failed to decode %s data: %s (position: %zu)",
+			BinaryFormatName(format), decodeError, errorPos);
+		return nullptr;
+	}
+
+	return WrapBinaryDocument(idoc, is_mutable, error, error_size);
+}
+
+JsonValue* JsonManager::ParseBinaryFile(const char* path, JSON_BINARY_FORMAT format, bool is_mutable,
+	char* error, size_t error_size)
+{
+	if (!path) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return nullptr;
+	}
+
+	if (!IsBinaryFormat(format)) {
+		SetErrorSafe(error, error_size, "Invalid binary format: %d", format);
+		return nullptr;
+	}
+
+	char realpath[PLATFORM_MAX_PATH];
+	smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", path);
+
+	const char* decodeError;
+	size_t errorPos;
+	yyjson_doc* idoc;
+
+	// Values are copied out of the file data, which is released right after decoding
+	if (IsGzipFile(realpath)) {
+#ifdef JSON_HAS_ZLIB
+		size_t size;
+		char* block = ReadGzipFile(realpath, 0, &size);
+		if (!block) {
+			SetErrorSafe(error, error_size, "Failed to decompress gzip file: %s", path);
+			return nullptr;
+		}
+		idoc = ReadBinaryDocument(block, size, format, &decodeError, &errorPos);
+		free(block);
+#else
+		SetErrorSafe(error, error_size, "gzip compressed files are not supported by this build: %s", path);
+		return nullptr;
+#endif
+	} else {
+		std::unique_ptr<MappedFile> mapping = MappedFile::Open(realpath, 0);
+		if (!mapping) {
+			SetErrorSafe(error, error_size, "Failed to read file: %s", path);
+			return nullptr;
+		}
+		idoc = ReadBinaryDocument(mapping->data(), mapping->size(), format, &decodeError, &errorPos);
+	}
+
+	if (!idoc) {
+		SetErrorSafe(error, error_size, "Failed to decode %s file: %s (msg: %s, position: %zu)",
+			BinaryFormatName(format), path, decodeError, errorPos);
+		return nullptr;
+	}
+
+	return WrapBinaryDocument(idoc, is_mutable, error, error_size);
+}
+
+bool JsonManager::SaveSnapshot(JsonValue* handle, const char* path, char* error, size_t error_size)
+{
+	if (!handle || !path) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return false;
+	}
+
+	char realpath[PLATFORM_MAX_PATH];
+	smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", path);
+
+	// Mutable values are copied into the immutable layout first
+	yyjson_doc* copy = nullptr;
+	const yyjson_val* root = handle->m_pVal;
+	if (handle->IsMutable()) {
+		copy = yyjson_mut_val_imut_copy(handle->m_pVal_mut, nullptr);
+		if (!copy) {
+			SetErrorSafe(error, error_size, "Failed to copy mutable JSON value");
+			return false;
+		}
+		root = yyjson_doc_get_root(copy);
+	}
+
+	// A loaded snapshot maps its file, so the file is replaced rather than overwritten in place
+	char temppath[PLATFORM_MAX_PATH + 8];
+	snprintf(temppath, sizeof(temppath), "%s.tmp", realpath);
+
+	FILE* fp = fopen(temppath, "wb");
+	if (!fp) {
+		yyjson_doc_free(copy);
+		SetErrorSafe(error, error_size, "Failed to open temporary file: %s", temppath);
+		return false;
+	}
+
+	const char* writeError = "";
+	bool is_success = WriteJsonSnapshot(root, fp, &writeError);
+	yyjson_doc_free(copy);
+
+	if (fclose(fp) != 0 && is_success) {
+		writeError = "write failed";
+		is_success = false;
+	}
+
+	if (!is_success) {
+		remove(temppath);
+		SetErrorSafe(error, error_size, "Failed to write snapshot file: %s (msg: %s)", realpath, writeError);
+		return false;
+	}
+
+	if (!ReplaceFileAtomic(temppath, realpath, false)) {
+		remove(temppath);
+		SetErrorSafe(error, error_size, "Failed to replace file: %s", realpath);
+		return false;
+	}
+
+	return true;
+}
+
+JsonValue* JsonManager::LoadSnapshot(const char* path, char* error, size_t error_size)
+{
+	if (!path) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return nullptr;
+	}
+
+	char realpath[PLATFORM_MAX_PATH];
+	smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", path);
+
+	// Every page holds strings to rebase, so all of them are copied in at once
+	std::unique_ptr<MappedFile> mapping = MappedFile::Open(realpath, 0, true);
+	if (!mapping) {
+		SetErrorSafe(error, error_size, "Failed to read file: %s", path);
+		return nullptr;
+	}
+
+	const char* loadError;
+	yyjson_doc* doc = LoadJsonSnapshot(mapping->data(), mapping->size(), &loadError);
+	if (!doc) {
+		SetErrorSafe(error, error_size, "Failed to load snapshot file: %s (msg: %s)", path, loadError);
+		return nullptr;
+	}
+
+	auto pJSONValue = CreateWrapper();
+	pJSONValue->m_readSize = mapping->size();
+	pJSONValue->m_pVal = yyjson_doc_get_root(doc);
+	pJSONValue->m_pDocument = WrapImmutableDocument(doc, std::move(mapping));
+
+	return pJSONValue.release();
+}
+
+JsonValue* JsonManager::CreateSnapshot(JsonValue* handle)
+{
+	if (!handle) {
+		return nullptr;
+	}
+
+	if (handle->IsMutable()) {
+		return ToImmutable(handle);
+	}
+
+	if (!handle->m_pDocument) {
+		return nullptr;
+	}
+
+	// Immutable values can still be changed in place on the game thread, so the snapshot is a copy
+	yyjson_doc* doc = handle->m_pDocument->get();
+	yyjson_doc* idoc = CopyJsonValues(yyjson_doc_get_root(doc), yyjson_doc_get_read_size(doc));
+	if (!idoc) {
+		return nullptr;
+	}
+
+	auto pJSONValue = CreateWrapper();
+	pJSONValue->m_pDocument = WrapImmutableDocument(idoc);
+	pJSONValue->m_pVal = yyjson_doc_get_root(idoc);
+	pJSONValue->m_readSize = handle->m_readSize;
+
+	return pJSONValue.release();
+}
+
+bool JsonManager::WriteToFileAtomic(JsonValue* handle, const char* path, yyjson_write_flag write_flg,
+	bool sync, char* error, size_t error_size)
+{
+	if (!handle || !path) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return false;
+	}
+
+	char realpath[PLATFORM_MAX_PATH];
+	smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", path);
+
+	char temppath[PLATFORM_MAX_PATH + 8];
+	snprintf(temppath, sizeof(temppath), "%s.tmp", realpath);
+
+	if (IsGzipPath(realpath)) {
+		if (!WriteGzipFile(temppath, handle, true, write_flg, sync, error, error_size)) {
+			remove(temppath);
+			return false;
+		}
+
+		if (!ReplaceFileAtomic(temppath, realpath, sync)) {
+			remove(temppath);
+			SetErrorSafe(error, error_size, "Failed to replace file: %s", realpath);
+			return false;
+		}
+		return true;
+	}
+
+	FILE* fp = fopen(temppath, "wb");
+	if (!fp) {
+		SetErrorSafe(error, error_size, "Failed to open temporary file: %s", temppath);
+		return false;
+	}
+
+	yyjson_write_err writeError;
+	bool is_success;
+
+	if (handle->IsMutable()) {
+		is_success = yyjson_mut_write_fp(fp, handle->m_pDocument_mut->get(), write_flg, nullptr, &writeError);
+	} else {
+		is_success = yyjson_write_fp(fp, handle->m_pDocument->get(), write_flg, nullptr, &writeError);
+	}
+
+	if (!is_success) {
+		fclose(fp);
+		remove(temppath);
+		SetErrorSafe(error, error_size, "Failed to write JSON to file: %s (error code: %u)", writeError.msg, writeError.code);
+		return false;
+	}
+
+	bool flushed = sync ? SyncFileToDisk(fp) : (fflush(fp) == 0);
+	if (fclose(fp) != 0 || !flushed) {
+		remove(temppath);
+		SetErrorSafe(error, error_size, "Failed to flush temporary file: %s", temppath);
+		return false;
+	}
+
+	if (!ReplaceFileAtomic(temppath, realpath, sync)) {
+		remove(temppath);
+		SetErrorSafe(error, error_size, "Failed to replace file: %s", realpath);
+		return false;
+	}
+
+	return true;
+}
+
+// Flags the incremental reader ignores; input read with any of them is parsed in one go by StreamParserFinish()
+static const yyjson_read_flag kIncrUnsupportedFlags =
+	YYJSON_READ_JSON5 | YYJSON_READ_ALLOW_BOM | YYJSON_READ_ALLOW_INVALID_UNICODE;
+
+static const size_t kStreamMinCapacity = 16384;
+
+static inline bool IsJsonWhitespace(char c) {
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+JsonStreamParser* JsonManager::StreamParserCreate(yyjson_read_flag read_flg, size_t expected_size)
+{
+	auto parser = new(std::nothrow) JsonStreamParser();
+	if (!parser) {
+		return nullptr;
+	}
+
+	parser->m_readFlg = read_flg & ~JSON_READ_EXT_MASK & ~YYJSON_READ_INSITU;
+	parser->m_expectedSize = expected_size;
+	parser->m_incremental = (parser->m_readFlg & kIncrUnsupportedFlags) == 0;
+
+	return parser;
+}
+
+bool JsonManager::StreamParserGrow(JsonStreamParser* parser, size_t needed)
+{
+	size_t cap = parser->m_expectedSize;
+	if (!cap) {
+		cap = parser->m_cap ? parser->m_cap * 2 : kStreamMinCapacity;
+		if (cap < needed) {
+			cap = needed;
+		}
+	}
+
+	char* buf = static_cast<char*>(malloc(cap + YYJSON_PADDING_SIZE));
+	if (!buf) {
+		return false;
+	}
+
+	// Once parsing has started the buffer holds in-situ modified data, so the state is dropped
+	// and the document is parsed again from the untouched copy
+	if (parser->m_state) {
+		yyjson_incr_free(parser->m_state);
+		parser->m_state = nullptr;
+		memcpy(buf, parser->m_raw.data(), parser->m_len);
+	} else if (parser->m_len) {
+		memcpy(buf, parser->m_buf, parser->m_len);
+	}
+
+	free(parser->m_buf);
+	parser->m_buf = buf;
+	parser->m_cap = cap;
+	return true;
+}
+
+bool JsonManager::StreamParserAdvance(JsonStreamParser* parser)
+{
+	if (!parser->m_state) {
+		if (!parser->m_incremental) {
+			return true;
+		}
+
+		// Only containers are parsed incrementally, the reader could stop early inside a top-level number
+		size_t pos = 0;
+		while (pos < parser->m_len && IsJsonWhitespace(parser->m_buf[pos])) {
+			pos++;
+		}
+		if (pos == parser->m_len || (parser->m_buf[pos] != '{' && parser->m_buf[pos] != '[')) {
+			return true;
+		}
+
+		if (!parser->m_expectedSize && parser->m_raw.empty()) {
+			parser->m_raw.assign(parser->m_buf, parser->m_len);
+		}
+
+		parser->m_state = yyjson_incr_new(parser->m_buf, parser->m_cap, parser->m_readFlg | YYJSON_READ_INSITU, nullptr);
+		if (!parser->m_state) {
+			SetErrorSafe(parser->m_error, sizeof(parser->m_error), "Failed to create incremental reader");
+			return false;
+		}
+	}
+
+	yyjson_read_err readError;
+	yyjson_doc* doc = yyjson_incr_read(parser->m_state, parser->m_len, &readError);
+
+	if (doc) {
+		yyjson_incr_free(parser->m_state);
+		parser->m_state = nullptr;
+		parser->m_doc = doc;
+		std::string().swap(parser->m_raw);
+		return true;
+	}
+
+	if (readError.code == YYJSON_READ_ERROR_MORE) {
+		return true;
+	}
+
+	SetErrorSafe(parser->m_error, sizeof(parser->m_error), "Failed to parse JSON stream: %s (error code: %u, position: %zu)",
+		readError.msg, readError.code, readError.pos);
+	return false;
+}
+
+bool JsonManager::StreamParserFeed(JsonStreamParser* parser, const char* data, size_t len,
+	char* error, size_t error_size)
+{
+	if (!parser || (!data && len)) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return false;
+	}
+
+	if (parser->m_failed) {
+		SetErrorSafe(error, error_size, "%s", parser->m_error);
+		return false;
+	}
+
+	if (!len) {
+		return true;
+	}
+
+	if (parser->m_doc) {
+		// The document is complete, anything after it is only checked and then dropped
+		if (!(parser->m_readFlg & YYJSON_READ_STOP_WHEN_DONE)) {
+			for (size_t i = 0; i < len; i++) {
+				if (!IsJsonWhitespace(data[i])) {
+					parser->m_failed = true;
+					SetErrorSafe(parser->m_error, sizeof(parser->m_error),
+						"Failed to parse JSON stream: unexpected content after document (position: %zu)", parser->m_len + i);
+					SetErrorSafe(error, error_size, "%s", parser->m_error);
+					return false;
+				}
+			}
+		}
+		parser->m_len += len;
+		return true;
+	}
+
+	size_t needed = parser->m_len + len;
+	if (parser->m_expectedSize && needed > parser->m_expectedSize) {
+		parser->m_failed = true;
+		SetErrorSafe(parser->m_error, sizeof(parser->m_error),
+			"Input exceeds the expected size of %zu bytes", parser->m_expectedSize);
+		SetErrorSafe(error, error_size, "%s", parser->m_error);
+		return false;
+	}
+
+	// Without a known size one spare byte is kept, the reader treats a full buffer as the end of input
+	size_t required = parser->m_expectedSize ? needed : needed + 1;
+	if (required > parser->m_cap && !StreamParserGrow(parser, required)) {
+		parser->m_failed = true;
+		SetErrorSafe(parser->m_error, sizeof(parser->m_error), "Failed to allocate %zu bytes for JSON stream", needed);
+		SetErrorSafe(error, error_size, "%s", parser->m_error);
+		return false;
+	}
+
+	memcpy(parser->m_buf + parser->m_len, data, len);
+	if (!parser->m_raw.empty()) {
+		parser->m_raw.append(data, len);
+	}
+	parser->m_len = needed;
+
+	if (!StreamParserAdvance(parser)) {
+		parser->m_failed = true;
+		SetErrorSafe(error, error_size, "%s", parser->m_error);
+		return false;
+	}
+
+	return true;
+}
+
+bool JsonManager::StreamParserIsComplete(JsonStreamParser* parser)
+{
+	return parser && parser->m_doc;
+}
+
+JsonValue* JsonManager::StreamParserFinish(JsonStreamParser* parser, bool is_mutable,
+	char* error, size_t error_size)
+{
+	if (!parser) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return nullptr;
+	}
+
+	if (parser->m_failed) {
+		SetErrorSafe(error, error_size, "%s", parser->m_error);
+		parser->Reset();
+		return nullptr;
+	}
+
+	yyjson_doc* doc = parser->m_doc;
+	parser->m_doc = nullptr;
+
+	if (!doc) {
+		if (parser->m_state) {
+			SetErrorSafe(error, error_size, "Failed to parse JSON stream: unexpected end of data (position: %zu)", parser->m_len);
+			parser->Reset();
+			return nullptr;
+		}
+
+		if (!parser->m_len) {
+			SetErrorSafe(error, error_size, "Failed to parse JSON stream: no data");
+			parser->Reset();
+			return nullptr;
+		}
+
+		// Input that was only buffered is parsed in one go
+		memset(parser->m_buf + parser->m_len, 0, YYJSON_PADDING_SIZE);
+		yyjson_read_err readError;
+		doc = yyjson_read_opts(parser->m_buf, parser->m_len, parser->m_readFlg | YYJSON_READ_INSITU, nullptr, &readError);
+		if (!doc) {
+			SetErrorSafe(error, error_size, "Failed to parse JSON stream: %s (error code: %u, position: %zu)",
+				readError.msg, readError.code, readError.pos);
+			parser->Reset();
+			return nullptr;
+		}
+	}
+
+	// Strings of the in-situ document point into the parse buffer
+	auto storage = std::make_unique<HeapBuffer>(parser->m_buf);
+	parser->m_buf = nullptr;
+	parser->Reset();
+
+	auto pJSONValue = CreateWrapper();
+	pJSONValue->m_readSize = yyjson_doc_get_read_size(doc);
+
+	if (is_mutable) {
+		pJSONValue->m_pDocument_mut = AdoptDocument(doc, std::move(storage));
+		if (!pJSONValue->m_pDocument_mut) {
+			SetErrorSafe(error, error_size, "Failed to create mutable JSON document");
+			return nullptr;
+		}
+		pJSONValue->m_pVal_mut = yyjson_mut_doc_get_root(pJSONValue->m_pDocument_mut->get());
+	} else {
+		pJSONValue->m_pDocument = WrapImmutableDocument(doc, std::move(storage));
+		pJSONValue->m_pVal = yyjson_doc_get_root(doc);
+	}
+
+	return pJSONValue.release();
+}
+
+void JsonManager::ReleaseStreamParser(JsonStreamParser* parser)
+{
+	if (parser) {
+		delete parser;
+	}
+}
+
+HandleType_t JsonManager::GetStreamParserHandleType()
+{
+	return g_StreamParserType;
+}
+
+JsonStreamParser* JsonManager::GetStreamParserFromHandle(IPluginContext* pContext, Handle_t handle)
+{
+	HandleError err;
+	HandleSecurity sec(pContext->GetIdentity(), myself->GetIdentity());
+
+	JsonStreamParser* pParser;
+	if ((err = handlesys->ReadHandle(handle, g_StreamParserType, &sec, (void**)&pParser)) != HandleError_None)
+	{
+		pContext->ReportError("Invalid JSONStreamParser handle %x (error %d)", handle, err);
+		return nullptr;
+	}
+
+	return pParser;
+}
+
+JsonLinesReader* JsonManager::LinesReaderOpen(const char* path, yyjson_read_flag read_flg, size_t buffer_size,
+	bool pooled, char* error, size_t error_size)
+{
+	if (!path || !buffer_size) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return nullptr;
+	}
+
+	char realpath[PLATFORM_MAX_PATH];
+	smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", path);
+
+	auto file = LineFileReader::Open(realpath, buffer_size);
+	if (!file) {
+		SetErrorSafe(error, error_size, "Failed to open file: %s", path);
+		return nullptr;
+	}
+
+	auto reader = new(std::nothrow) JsonLinesReader();
+	if (!reader) {
+		SetErrorSafe(error, error_size, "Failed to create JSON Lines reader");
+		return nullptr;
+	}
+
+	reader->m_file = std::move(file);
+	// Lines live in the shared read buffer, so they are never parsed in-situ
+	reader->m_readFlg = read_flg & ~JSON_READ_EXT_MASK & ~YYJSON_READ_INSITU;
+	reader->m_pooled = pooled;
+
+	return reader;
+}
+
+bool JsonManager::LinesReaderReadLine(JsonLinesReader* reader, const char** out_line, size_t* out_len)
+{
+	if (reader->m_eof) {
+		return false;
+	}
+
+	uint64_t offset = reader->m_file->Offset();
+	if (!reader->m_file->NextLine(out_line, out_len)) {
+		reader->m_eof = true;
+		return false;
+	}
+
+	if (reader->m_line == reader->m_checkpoints.size() * JsonLinesReader::LINES_CHECKPOINT_INTERVAL) {
+		reader->m_checkpoints.push_back(offset);
+	}
+	reader->m_line++;
+
+	return true;
+}
+
+JsonValue* JsonManager::LinesReaderNext(JsonLinesReader* reader, bool is_mutable,
+	char* error, size_t error_size)
+{
+	if (!reader) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return nullptr;
+	}
+
+	const char* line;
+	size_t len;
+	while (true) {
+		if (!LinesReaderReadLine(reader, &line, &len)) {
+			SetErrorSafe(error, error_size, "");
+			return nullptr;
+		}
+
+		size_t pos = 0;
+		while (pos < len && (line[pos] == ' ' || line[pos] == '\t' || line[pos] == '\r')) {
+			pos++;
+		}
+		if (pos < len) {
+			break;
+		}
+	}
+
+	yyjson_read_err readError;
+	yyjson_doc* doc = nullptr;
+	std::unique_ptr<JsonDocStorage> storage;
+
+	// Immutable documents go into the reader's block when nothing parsed earlier still lives in it,
+	// otherwise the line is parsed with the default allocator and the block is left alone
+	size_t needed = (reader->m_pooled && !is_mutable) ? yyjson_read_max_memory_usage(len, reader->m_readFlg) : 0;
+	if (needed && (!reader->m_block || reader->m_block.use_count() == 1)) {
+		if (reader->m_blockSize < needed) {
+			size_t size = std::max(needed, reader->m_blockSize * 2);
+			reader->m_block.reset(static_cast<char*>(malloc(size)), free);
+			reader->m_blockSize = reader->m_block ? size : 0;
+		}
+		if (reader->m_block) {
+			yyjson_alc alc;
+			yyjson_alc_pool_init(&alc, reader->m_block.get(), reader->m_blockSize);
+			doc = yyjson_read_opts(const_cast<char*>(line), len, reader->m_readFlg, &alc, &readError);
+			if (doc) {
+				storage = std::make_unique<SharedBlock>(reader->m_block);
+			}
+		} else {
+			needed = 0;
+		}
+	} else {
+		needed = 0;
+	}
+
+	if (!needed) {
+		doc = yyjson_read_opts(const_cast<char*>(line), len, reader->m_readFlg, nullptr, &readError);
+	}
+
+	if (!doc) {
+		SetErrorSafe(error, error_size, "Failed to parse JSON line %zu: %s (error code: %u, position: %zu)",
+			reader->m_line - 1, readError.msg, readError.code, readError.pos);
+		return nullptr;
+	}
+
+	auto pJSONValue = CreateWrapper();
+	pJSONValue->m_readSize = yyjson_doc_get_read_size(doc);
+
+	if (is_mutable) {
+		pJSONValue->m_pDocument_mut = AdoptDocument(doc, nullptr);
+		if (!pJSONValue->m_pDocument_mut) {
+			SetErrorSafe(error, error_size, "Failed to create mutable JSON document");
+			return nullptr;
+		}
+		pJSONValue->m_pVal_mut = yyjson_mut_doc_get_root(pJSONValue->m_pDocument_mut->get());
+	} else {
+		pJSONValue->m_pDocument = WrapImmutableDocument(doc, std::move(storage));
+		pJSONValue->m_pVal = yyjson_doc_get_root(doc);
+	}
+
+	return pJSONValue.release();
+}
+
+size_t JsonManager::LinesReaderSkip(JsonLinesReader* reader, size_t count)
+{
+	if (!reader) {
+		return 0;
+	}
+
+	const char* line;
+	size_t len;
+	size_t skipped = 0;
+	while (skipped < count && LinesReaderReadLine(reader, &line, &len)) {
+		skipped++;
+	}
+
+	return skipped;
+}
+
+bool JsonManager::LinesReaderSeekLine(JsonLinesReader* reader, size_t line)
+{
+	if (!reader) {
+		return false;
+	}
+
+	// Closest checkpoint at or before the target, the start of the file if none was recorded
+	const size_t interval = JsonLinesReader::LINES_CHECKPOINT_INTERVAL;
+	bool hasCheckpoint = !reader->m_checkpoints.empty();
+	size_t index = hasCheckpoint ? std::min(line / interval, reader->m_checkpoints.size() - 1) : 0;
+	size_t checkpointLine = index * interval;
+
+	// Rewind when the target is behind, jump when the checkpoint is ahead of the current position
+	if (line < reader->m_line || checkpointLine > reader->m_line) {
+		if (!reader->m_file->Seek(hasCheckpoint ? reader->m_checkpoints[index] : 0)) {
+			return false;
+		}
+		reader->m_line = checkpointLine;
+		reader->m_eof = false;
+	}
+
+	size_t remaining = line - reader->m_line;
+	return LinesReaderSkip(reader, remaining) == remaining;
+}
+
+bool JsonManager::LinesReaderSeekOffset(JsonLinesReader* reader, uint64_t offset, size_t line)
+{
+	if (!reader || !reader->m_file->Seek(offset)) {
+		return false;
+	}
+
+	// Line numbers before the offset are not known to match the checkpoints, so recording starts over
+	reader->m_checkpoints.clear();
+	reader->m_line = line;
+	reader->m_eof = false;
+
+	return true;
+}
+
+size_t JsonManager::LinesReaderGetLine(JsonLinesReader* reader)
+{
+	return reader ? reader->m_line : 0;
+}
+
+uint64_t JsonManager::LinesReaderGetOffset(JsonLinesReader* reader)
+{
+	return reader ? reader->m_file->Offset() : 0;
+}
+
+bool JsonManager::LinesReaderIsEOF(JsonLinesReader* reader)
+{
+	return !reader || reader->m_eof;
+}
+
+void JsonManager::ReleaseLinesReader(JsonLinesReader* reader)
+{
+	if (reader) {
+		delete reader;
+	}
+}
+
+HandleType_t JsonManager::GetLinesReaderHandleType()
+{
+	return g_LinesReaderType;
+}
+
+JsonLinesReader* JsonManager::GetLinesReaderFromHandle(IPluginContext* pContext, Handle_t handle)
+{
+	HandleError err;
+	HandleSecurity sec(pContext->GetIdentity(), myself->GetIdentity());
+
+	JsonLinesReader* pReader;
+	if ((err = handlesys->ReadHandle(handle, g_LinesReaderType, &sec, (void**)&pReader)) != HandleError_None)
+	{
+		pContext->ReportError("Invalid JSONLinesReader handle %x (error %d)", handle, err);
 		return nullptr;
 	}
 
-	auto wrapper = CreateWrapper();
-	wrapper->m_pDocument = WrapImmutableDocument(imutDoc);
-	if (!wrapper->m_pDocument) {
-		yyjson_doc_free(imutDoc);
-		SetErrorSafe(error, error_size, "Failed to wrap immutable JSON document");
-		return nullptr;
-	}
-	wrapper->m_pVal = yyjson_doc_get_root(imutDoc);
-	return wrapper.release();
+	return pReader;
 }
 
-bool JsonManager::MergePatchInPlace(JsonValue* target, JsonValue* patch,
+JsonLinesWriter* JsonManager::LinesWriterOpen(const char* path, yyjson_write_flag write_flg, size_t rotate_size,
+	uint32_t rotate_interval, uint32_t flush_interval_ms, size_t buffer_limit,
 	char* error, size_t error_size)
 {
-	if (!target || !patch) {
-		SetErrorSafe(error, error_size, "Target or patch JSON value is null");
-		return false;
+	if (!path || !buffer_limit) {
+		SetErrorSafe(error, error_size, "Invalid parameters");
+		return nullptr;
 	}
 
-	if (!target->IsMutable()) {
-		SetErrorSafe(error, error_size, "Target JSON must be mutable for in-place merge patch");
-		return false;
+	char realpath[PLATFORM_MAX_PATH];
+	smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", path);
+
+	JsonLinesWriter::Options options;
+	options.rotate_size = rotate_size;
+	options.rotate_interval = rotate_interval;
+	options.flush_interval_ms = flush_interval_ms;
+	options.buffer_limit = buffer_limit;
+	options.flush_size = std::min(options.flush_size, buffer_limit / 2 + 1);
+
+	auto writer = JsonLinesWriter::Open(realpath, options);
+	if (!writer) {
+		SetErrorSafe(error, error_size, "Failed to open file: %s", path);
+		return nullptr;
 	}
 
-	yyjson_mut_doc* doc = target->m_pDocument_mut->get();
-	yyjson_mut_val* root = target->m_pVal_mut;
+	// One record per line, so pretty printing and the trailing newline are dropped
+	writer->m_writeFlg = write_flg & ~(YYJSON_WRITE_PRETTY | YYJSON_WRITE_PRETTY_TWO_SPACES | YYJSON_WRITE_NEWLINE_AT_END);
 
-	if (!doc || !root) {
-		SetErrorSafe(error, error_size, "Target JSON has no root value");
+	return writer.release();
+}
+
+bool JsonManager::LinesWriterAppend(JsonLinesWriter* writer, JsonValue* handle)
+{
+	if (!writer || !handle) {
 		return false;
 	}
 
-	yyjson_mut_val* patchCopy = CopyValueIntoDoc(patch, doc, error, error_size);
-	if (!patchCopy) {
+	// The scratch allocator keeps freed blocks, so steady-state logging does not hit malloc
+	size_t len = 0;
+	char* str = WriteScratch(handle, writer->m_writeFlg, &len);
+	if (!str) {
 		return false;
 	}
 
-	yyjson_mut_val* resultRoot = yyjson_mut_merge_patch(doc, root, patchCopy);
-	if (!resultRoot) {
-		SetErrorSafe(error, error_size, "Failed to apply JSON Merge Patch in place");
-		return false;
+	bool queued = writer->Append(str, len);
+	FreeScratch(str);
+
+	return queued;
+}
+
+void JsonManager::LinesWriterFlush(JsonLinesWriter* writer, bool wait)
+{
+	if (writer) {
+		writer->Flush(wait);
 	}
+}
 
-	yyjson_mut_doc_set_root(doc, resultRoot);
-	target->m_pVal_mut = yyjson_mut_doc_get_root(doc);
-	return true;
+uint64_t JsonManager::LinesWriterGetDropped(JsonLinesWriter* writer)
+{
+	return writer ? writer->GetDropped() : 0;
 }
 
-bool JsonManager::WriteToFile(JsonValue* handle, const char* path, yyjson_write_flag write_flg,
-	char* error, size_t error_size)
+uint64_t JsonManager::LinesWriterGetWritten(JsonLinesWriter* writer)
 {
-	if (!handle || !path) {
-		if (error && error_size > 0) {
-			SetErrorSafe(error, error_size, "Invalid parameters");
-		}
-		return false;
+	return writer ? writer->GetWritten() : 0;
+}
+
+void JsonManager::ReleaseLinesWriter(JsonLinesWriter* writer)
+{
+	if (writer) {
+		delete writer;
 	}
+}
 
-	char realpath[PLATFORM_MAX_PATH];
-	smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s", path);
+HandleType_t JsonManager::GetLinesWriterHandleType()
+{
+	return g_LinesWriterType;
+}
 
-	yyjson_write_err writeError;
-	bool is_success;
+JsonLinesWriter* JsonManager::GetLinesWriterFromHandle(IPluginContext* pContext, Handle_t handle)
+{
+	HandleError err;
+	HandleSecurity sec(pContext->GetIdentity(), myself->GetIdentity());
 
-	if (handle->IsMutable()) {
-		is_success = yyjson_mut_write_file(realpath, handle->m_pDocument_mut->get(), write_flg, nullptr, &writeError);
-	} else {
-		is_success = yyjson_write_file(realpath, handle->m_pDocument->get(), write_flg, nullptr, &writeError);
+	JsonLinesWriter* pWriter;
+	if ((err = handlesys->ReadHandle(handle, g_LinesWriterType, &sec, (void**)&pWriter)) != HandleError_None)
+	{
+		pContext->ReportError("Invalid JSONLinesWriter handle %x (error %d)", handle, err);
+		return nullptr;
 	}
 
-	if (writeError.code && error && error_size > 0) {
-		SetErrorSafe(error, error_size, "Failed to write JSON to file: %s (error code: %u)", writeError.msg, writeError.code);
+	return pWriter;
+}
+
+void JsonManager::GetFileCacheStats(uint64_t* hits, uint64_t* misses, size_t* entries)
+{
+	if (hits) {
+		*hits = m_fileCacheHits;
 	}
+	if (misses) {
+		*misses = m_fileCacheMisses;
+	}
+	if (entries) {
+		*entries = m_fileCache.size();
+	}
+}
 
-	return is_success;
+void JsonManager::ClearFileCache()
+{
+	m_fileCache.clear();
+	m_fileCacheHits = 0;
+	m_fileCacheMisses = 0;
 }
 
 bool JsonManager::Equals(JsonValue* handle1, JsonValue* handle2)
@@ -587,21 +2458,22 @@ size_t JsonManager::GetSerializedSize(JsonValue* handle, yyjson_write_flag write
 		return 0;
 	}
 
+	// With the write cache the output is kept for the ToString that usually follows
+	if (const std::string* cached = WriteCached(handle, write_flg)) {
+		return cached->size() + 1;
+	}
+
+	// Count the output instead of writing it, the usual caller serializes right afterwards
 	size_t json_size;
-	char* json_str;
+	bool ok;
 
 	if (handle->IsMutable()) {
-		json_str = yyjson_mut_val_write(handle->m_pVal_mut, write_flg, &json_size);
+		ok = MeasureWriteSize(handle->m_pVal_mut, write_flg, &json_size);
 	} else {
-		json_str = yyjson_val_write(handle->m_pVal, write_flg, &json_size);
-	}
-
-	if (json_str) {
-		free(json_str);
-		return json_size + 1;
+		ok = MeasureWriteSize(handle->m_pVal, write_flg, &json_size);
 	}
 
-	return 0;
+	return ok ? json_size + 1 : 0;
 }
 
 JsonValue* JsonManager::ToMutable(JsonValue* handle)
@@ -947,7 +2819,8 @@ JsonValue* JsonManager::ObjectParseString(const char* str, yyjson_read_flag read
 	auto pJSONValue = CreateWrapper();
 
 	yyjson_read_err readError;
-	yyjson_doc* idoc = yyjson_read_opts(const_cast<char*>(str), strlen(str), read_flg, nullptr, &readError);
+	std::unique_ptr<JsonDocStorage> storage;
+	yyjson_doc* idoc = ReadStringDocument(str, strlen(str), read_flg, &storage, &readError);
 
 	if (!idoc || readError.code) {
 		if (error && error_size > 0) {
@@ -968,7 +2841,7 @@ JsonValue* JsonManager::ObjectParseString(const char* str, yyjson_read_flag read
 	}
 
 	pJSONValue->m_readSize = yyjson_doc_get_read_size(idoc);
-	pJSONValue->m_pDocument = WrapImmutableDocument(idoc);
+	pJSONValue->m_pDocument = WrapImmutableDocument(idoc, std::move(storage));
 	pJSONValue->m_pVal = root;
 
 	return pJSONValue.release();
@@ -989,9 +2862,9 @@ JsonValue* JsonManager::ObjectParseFile(const char* path, yyjson_read_flag read_
 	auto pJSONValue = CreateWrapper();
 
 	yyjson_read_err readError;
-	yyjson_doc* idoc = yyjson_read_file(realpath, read_flg, nullptr, &readError);
+	RefPtr<RefCountedImmutableDoc> doc = ReadFileShared(realpath, read_flg, &readError);
 
-	if (!idoc || readError.code) {
+	if (!doc || readError.code) {
 		if (error && error_size > 0) {
 			SetErrorSafe(error, error_size, "Failed to parse JSON file: %s (error code: %u, msg: %s, position: %zu)",
 				realpath, readError.code, readError.msg, readError.pos);
@@ -999,18 +2872,17 @@ JsonValue* JsonManager::ObjectParseFile(const char* path, yyjson_read_flag read_
 		return nullptr;
 	}
 
-	yyjson_val* root = yyjson_doc_get_root(idoc);
+	yyjson_val* root = yyjson_doc_get_root(doc->get());
 
 	if (!yyjson_is_obj(root)) {
 		if (error && error_size > 0) {
 			SetErrorSafe(error, error_size, "Root value in file is not an object (got %s)", yyjson_get_type_desc(root));
 		}
-		yyjson_doc_free(idoc);
 		return nullptr;
 	}
 
-	pJSONValue->m_readSize = yyjson_doc_get_read_size(idoc);
-	pJSONValue->m_pDocument = WrapImmutableDocument(idoc);
+	pJSONValue->m_readSize = yyjson_doc_get_read_size(doc->get());
+	pJSONValue->m_pDocument = std::move(doc);
 	pJSONValue->m_pVal = root;
 
 	return pJSONValue.release();
@@ -1029,101 +2901,333 @@ size_t JsonManager::ObjectGetSize(JsonValue* handle)
 	}
 }
 
+void* JsonManager::ObjectKeyAt(JsonValue* handle, size_t index)
+{
+	bool is_mutable = handle->IsMutable();
+	void* obj = is_mutable ? static_cast<void*>(handle->m_pVal_mut) : static_cast<void*>(handle->m_pVal);
+	size_t obj_size = is_mutable ? yyjson_mut_obj_size(handle->m_pVal_mut) : yyjson_obj_size(handle->m_pVal);
+	if (index >= obj_size) {
+		return nullptr;
+	}
+
+	// Value setters leave the keys where they are, only relinking or a changed size drops the cache
+	JsonValue::KeyPositionCache& cache = handle->m_keyPos;
+	uint64_t layout = handle->GetDocumentLayout();
+	if (cache.obj != obj || cache.layout != layout || cache.size != obj_size) {
+		cache.obj = obj;
+		cache.layout = layout;
+		cache.size = obj_size;
+		cache.key = nullptr;
+		cache.table.clear();
+	}
+
+	if (!cache.table.empty()) {
+		return cache.table[index];
+	}
+
+	// Keys are linked forwards only: mutable keys through their value, immutable keys follow their value
+	auto next_key = [is_mutable](void* key) -> void* {
+		if (is_mutable) {
+			return static_cast<yyjson_mut_val*>(key)->next->next;
+		}
+		return unsafe_yyjson_get_next(static_cast<yyjson_val*>(key) + 1);
+	};
+	void* first = is_mutable ? static_cast<yyjson_mut_val*>(static_cast<yyjson_mut_val*>(obj)->uni.ptr)->next->next
+		: static_cast<void*>(unsafe_yyjson_get_first(static_cast<yyjson_val*>(obj)));
+
+	// Going backwards means random access, which is served from a table of all keys from now on
+	if (cache.key && index < cache.index) {
+		cache.table.reserve(obj_size);
+		void* key = first;
+		for (size_t i = 0; i < obj_size; i++) {
+			cache.table.push_back(key);
+			key = next_key(key);
+		}
+		return cache.table[index];
+	}
+
+	size_t pos = 0;
+	void* key = first;
+	if (cache.key) {
+		pos = cache.index;
+		key = cache.key;
+	}
+	for (; pos < index; pos++) {
+		key = next_key(key);
+	}
+
+	cache.index = index;
+	cache.key = key;
+	return key;
+}
+
 bool JsonManager::ObjectGetKey(JsonValue* handle, size_t index, const char** out_key)
 {
 	if (!handle || !out_key) {
 		return false;
 	}
 
+	void* key = ObjectKeyAt(handle, index);
+	if (!key) {
+		return false;
+	}
+
+	*out_key = unsafe_yyjson_get_str(key);
+	return true;
+}
+
+JsonValue* JsonManager::ObjectGetValueAt(JsonValue* handle, size_t index)
+{
+	if (!handle) {
+		return nullptr;
+	}
+
+	void* key = ObjectKeyAt(handle, index);
+	if (!key) {
+		return nullptr;
+	}
+
+	auto pJSONValue = CreateWrapper();
+
 	if (handle->IsMutable()) {
-		size_t obj_size = yyjson_mut_obj_size(handle->m_pVal_mut);
-		if (index >= obj_size) {
-			return false;
-		}
+		pJSONValue->m_pDocument_mut = handle->m_pDocument_mut;
+		pJSONValue->m_pVal_mut = static_cast<yyjson_mut_val*>(key)->next;
+	} else {
+		pJSONValue->m_pDocument = handle->m_pDocument;
+		pJSONValue->m_pVal = static_cast<yyjson_val*>(key) + 1;
+	}
+
+	return pJSONValue.release();
+}
 
-		yyjson_mut_obj_iter iter;
-		yyjson_mut_obj_iter_init(handle->m_pVal_mut, &iter);
+JsonKeyIndex* JsonManager::GetKeyIndex(JsonValue* handle)
+{
+	if (!m_keyIndexThreshold) {
+		return nullptr;
+	}
 
-		for (size_t i = 0; i < index; i++) {
-			yyjson_mut_obj_iter_next(&iter);
+	if (handle->IsMutable()) {
+		yyjson_mut_val* obj = handle->m_pVal_mut;
+		if (!yyjson_mut_is_obj(obj) || unsafe_yyjson_get_len(obj) < m_keyIndexThreshold) {
+			return nullptr;
 		}
 
-		yyjson_mut_val* key = yyjson_mut_obj_iter_next(&iter);
-		if (!key) {
-			return false;
+		// An index that went stale was in use, so it is rebuilt right away
+		JsonKeyIndexEntry& entry = handle->m_pDocument_mut->keyIndexes()[obj];
+		if (!entry.index && ++entry.scans < KEY_INDEX_MIN_SCANS) {
+			return nullptr;
+		}
+		if (!entry.index || !entry.index->IsCurrent(obj)) {
+			entry.index = std::make_unique<JsonKeyIndex>(obj);
 		}
+		return entry.index.get();
+	}
 
-		*out_key = yyjson_mut_get_str(key);
-		return true;
-	} else {
-		size_t obj_size = yyjson_obj_size(handle->m_pVal);
-		if (index >= obj_size) {
-			return false;
+	return GetKeyIndex(*handle->m_pDocument, handle->m_pVal);
+}
+
+JsonKeyIndex* JsonManager::GetKeyIndex(RefCountedImmutableDoc& doc, yyjson_val* obj)
+{
+	if (!m_keyIndexThreshold || !yyjson_is_obj(obj) || unsafe_yyjson_get_len(obj) < m_keyIndexThreshold) {
+		return nullptr;
+	}
+
+	// A few lookups scan faster than the index is built, only objects read again and again get one
+	JsonKeyIndexEntry& entry = doc.keyIndexes()[obj];
+	if (!entry.index) {
+		if (++entry.scans < KEY_INDEX_MIN_SCANS) {
+			return nullptr;
 		}
+		entry.index = std::make_unique<JsonKeyIndex>(obj);
+	}
+	return entry.index.get();
+}
 
-		yyjson_obj_iter iter;
-		yyjson_obj_iter_init(handle->m_pVal, &iter);
+JsonArrayIndex* JsonManager::GetArrayIndex(JsonValue* handle, bool build)
+{
+	if (handle->IsMutable()) {
+		yyjson_mut_val* arr = handle->m_pVal_mut;
+		if (!yyjson_mut_is_arr(arr)) {
+			return nullptr;
+		}
 
-		for (size_t i = 0; i < index; i++) {
-			yyjson_obj_iter_next(&iter);
+		// A current table is kept up to date even once the array is small again
+		JsonArrayIndexMap& indexes = handle->m_pDocument_mut->arrayIndexes();
+		uint64_t layout = handle->m_pDocument_mut->layout();
+		auto it = indexes.find(arr);
+		if (it != indexes.end() && it->second.index && it->second.index->IsCurrent(layout)) {
+			return it->second.index.get();
 		}
 
-		yyjson_val* key = yyjson_obj_iter_next(&iter);
-		if (!key) {
-			return false;
+		if (!build || unsafe_yyjson_get_len(arr) < ARRAY_INDEX_MIN_SIZE) {
+			return nullptr;
 		}
 
-		*out_key = yyjson_get_str(key);
-		return true;
+		// A table that went stale was in use, so it is rebuilt right away
+		JsonArrayIndexEntry& entry = it != indexes.end() ? it->second : indexes[arr];
+		if (!entry.index && ++entry.walks < ARRAY_INDEX_MIN_WALKS) {
+			return nullptr;
+		}
+		entry.index = std::make_unique<JsonArrayIndex>(arr, layout);
+		return entry.index.get();
 	}
+
+	return GetArrayIndex(*handle->m_pDocument, handle->m_pVal, build);
 }
 
-JsonValue* JsonManager::ObjectGetValueAt(JsonValue* handle, size_t index)
+JsonArrayIndex* JsonManager::GetArrayIndex(RefCountedImmutableDoc& doc, yyjson_val* arr, bool build)
 {
-	if (!handle) {
+	// Arrays of scalars are laid out flat, yyjson_arr_get() reaches their elements directly
+	if (!yyjson_is_arr(arr) || unsafe_yyjson_arr_is_flat(arr)) {
 		return nullptr;
 	}
 
-	size_t obj_size = handle->IsMutable() ? yyjson_mut_obj_size(handle->m_pVal_mut) : yyjson_obj_size(handle->m_pVal);
+	JsonArrayIndexMap& indexes = doc.arrayIndexes();
+	auto it = indexes.find(arr);
+	if (it != indexes.end() && it->second.index) {
+		return it->second.index.get();
+	}
 
-	if (index >= obj_size) {
+	if (!build || unsafe_yyjson_get_len(arr) < ARRAY_INDEX_MIN_SIZE || !JsonArrayIndex::CanIndex(arr)) {
 		return nullptr;
 	}
 
-	auto pJSONValue = CreateWrapper();
-
-	if (handle->IsMutable()) {
-		yyjson_mut_obj_iter iter;
-		yyjson_mut_obj_iter_init(handle->m_pVal_mut, &iter);
+	// A single access walks faster than the table is built, only arrays walked again and again get one
+	JsonArrayIndexEntry& entry = it != indexes.end() ? it->second : indexes[arr];
+	if (++entry.walks < ARRAY_INDEX_MIN_WALKS) {
+		return nullptr;
+	}
+	entry.index = std::make_unique<JsonArrayIndex>(arr);
+	return entry.index.get();
+}
 
-		for (size_t i = 0; i < index; i++) {
-			yyjson_mut_obj_iter_next(&iter);
-		}
+void* JsonManager::ArrayValueAt(JsonValue* handle, size_t index)
+{
+	// The first elements are reached quickly without a table
+	bool build = index >= ARRAY_INDEX_MIN_SIZE;
 
-		yyjson_mut_val* key = yyjson_mut_obj_iter_next(&iter);
-		if (!key) {
+	if (handle->IsMutable()) {
+		if (index >= yyjson_mut_arr_size(handle->m_pVal_mut)) {
 			return nullptr;
 		}
 
-		pJSONValue->m_pDocument_mut = handle->m_pDocument_mut;
-		pJSONValue->m_pVal_mut = yyjson_mut_obj_iter_get_val(key);
-	} else {
-		yyjson_obj_iter iter;
-		yyjson_obj_iter_init(handle->m_pVal, &iter);
+		JsonArrayIndex* arr_index = GetArrayIndex(handle, build);
+		return arr_index ? arr_index->GetMut(index) : yyjson_mut_arr_get(handle->m_pVal_mut, index);
+	}
 
-		yyjson_val* key;
-		for (size_t i = 0; i <= index; i++) {
-			key = yyjson_obj_iter_next(&iter);
-			if (!key) {
-				return nullptr;
-			}
-		}
+	return ArrayValueAt(*handle->m_pDocument, handle->m_pVal, index);
+}
 
-		pJSONValue->m_pDocument = handle->m_pDocument;
-		pJSONValue->m_pVal = yyjson_obj_iter_get_val(key);
+yyjson_val* JsonManager::ArrayValueAt(RefCountedImmutableDoc& doc, yyjson_val* arr, size_t index)
+{
+	if (index >= yyjson_arr_size(arr)) {
+		return nullptr;
 	}
 
-	return pJSONValue.release();
+	JsonArrayIndex* arr_index = GetArrayIndex(doc, arr, index >= ARRAY_INDEX_MIN_SIZE);
+	return arr_index ? arr_index->Get(arr, index) : yyjson_arr_get(arr, index);
+}
+
+bool JsonManager::ArraySetAt(JsonValue* handle, size_t index, yyjson_mut_val* val)
+{
+	yyjson_mut_val* arr = handle->m_pVal_mut;
+	if (!val || !yyjson_mut_is_arr(arr) || index >= unsafe_yyjson_get_len(arr)) {
+		return false;
+	}
+
+	JsonArrayIndex* arr_index = GetArrayIndex(handle, index >= ARRAY_INDEX_MIN_SIZE);
+	if (!arr_index) {
+		return yyjson_mut_arr_replace(arr, index, val) != nullptr;
+	}
+
+	arr_index->Replace(arr, index, val);
+	return true;
+}
+
+bool JsonManager::ArrayInsertAt(JsonValue* handle, size_t index, yyjson_mut_val* val)
+{
+	yyjson_mut_val* arr = handle->m_pVal_mut;
+	if (!val || !yyjson_mut_is_arr(arr)) {
+		return false;
+	}
+
+	size_t arr_size = unsafe_yyjson_get_len(arr);
+	if (index > arr_size) {
+		return false;
+	}
+
+	// Appending needs no table, an existing one is still kept current
+	JsonArrayIndex* arr_index = GetArrayIndex(handle, index >= ARRAY_INDEX_MIN_SIZE && index < arr_size);
+	if (!arr_index) {
+		return yyjson_mut_arr_insert(arr, val, index);
+	}
+
+	arr_index->Insert(arr, index, val);
+	return true;
+}
+
+bool JsonManager::ArrayRemoveAt(JsonValue* handle, size_t index)
+{
+	yyjson_mut_val* arr = handle->m_pVal_mut;
+	if (!yyjson_mut_is_arr(arr) || index >= unsafe_yyjson_get_len(arr)) {
+		return false;
+	}
+
+	JsonArrayIndex* arr_index = GetArrayIndex(handle, index >= ARRAY_INDEX_MIN_SIZE);
+	if (!arr_index) {
+		return yyjson_mut_arr_remove(arr, index) != nullptr;
+	}
+
+	arr_index->Remove(arr, index);
+	return true;
+}
+
+yyjson_val* JsonManager::ObjectLookup(JsonValue* handle, const char* key)
+{
+	return ObjectLookup(*handle->m_pDocument, handle->m_pVal, key);
+}
+
+yyjson_val* JsonManager::ObjectLookup(RefCountedImmutableDoc& doc, yyjson_val* obj, const char* key)
+{
+	JsonKeyIndex* index = GetKeyIndex(doc, obj);
+	return index ? index->Find(key, strlen(key)) : yyjson_obj_get(obj, key);
+}
+
+yyjson_mut_val* JsonManager::ObjectLookupMut(JsonValue* handle, const char* key)
+{
+	JsonKeyIndex* index = GetKeyIndex(handle);
+	if (!index) {
+		return yyjson_mut_obj_get(handle->m_pVal_mut, key);
+	}
+
+	yyjson_mut_val* found = index->FindMut(key, strlen(key));
+	return found ? found->next : nullptr;
+}
+
+bool JsonManager::ObjectPut(JsonValue* handle, const char* key, yyjson_mut_val* val)
+{
+	yyjson_mut_doc* doc = handle->m_pDocument_mut->get();
+	yyjson_mut_val* obj = handle->m_pVal_mut;
+
+	// Equal keys after the first have to be removed, which takes a scan anyway
+	JsonKeyIndex* index = val ? GetKeyIndex(handle) : nullptr;
+	if (!index || index->HasDuplicates()) {
+		return yyjson_mut_obj_put(obj, yyjson_mut_strcpy(doc, key), val);
+	}
+
+	yyjson_mut_val* found = index->FindMut(key, strlen(key));
+	if (found) {
+		// Same relinking as yyjson_mut_obj_put(), the key itself is kept
+		val->next = found->next->next;
+		found->next = val;
+		return true;
+	}
+
+	if (!yyjson_mut_obj_add(obj, yyjson_mut_strcpy(doc, key), val)) {
+		return false;
+	}
+	index->AddLast(obj);
+	return true;
 }
 
 JsonValue* JsonManager::ObjectGet(JsonValue* handle, const char* key)
@@ -1135,7 +3239,7 @@ JsonValue* JsonManager::ObjectGet(JsonValue* handle, const char* key)
 	auto pJSONValue = CreateWrapper();
 
 	if (handle->IsMutable()) {
-		yyjson_mut_val* val = yyjson_mut_obj_get(handle->m_pVal_mut, key);
+		yyjson_mut_val* val = ObjectLookupMut(handle, key);
 		if (!val) {
 			return nullptr;
 		}
@@ -1143,7 +3247,7 @@ JsonValue* JsonManager::ObjectGet(JsonValue* handle, const char* key)
 		pJSONValue->m_pDocument_mut = handle->m_pDocument_mut;
 		pJSONValue->m_pVal_mut = val;
 	} else {
-		yyjson_val* val = yyjson_obj_get(handle->m_pVal, key);
+		yyjson_val* val = ObjectLookup(handle, key);
 		if (!val) {
 			return nullptr;
 		}
@@ -1162,7 +3266,7 @@ bool JsonManager::ObjectGetBool(JsonValue* handle, const char* key, bool* out_va
 	}
 
 	if (handle->IsMutable()) {
-		yyjson_mut_val* val = yyjson_mut_obj_get(handle->m_pVal_mut, key);
+		yyjson_mut_val* val = ObjectLookupMut(handle, key);
 		if (!val || !yyjson_mut_is_bool(val)) {
 			return false;
 		}
@@ -1170,7 +3274,7 @@ bool JsonManager::ObjectGetBool(JsonValue* handle, const char* key, bool* out_va
 		*out_value = yyjson_mut_get_bool(val);
 		return true;
 	} else {
-		yyjson_val* val = yyjson_obj_get(handle->m_pVal, key);
+		yyjson_val* val = ObjectLookup(handle, key);
 		if (!val || !yyjson_is_bool(val)) {
 			return false;
 		}
@@ -1187,7 +3291,7 @@ bool JsonManager::ObjectGetDouble(JsonValue* handle, const char* key, double* ou
 	}
 
 	if (handle->IsMutable()) {
-		yyjson_mut_val* val = yyjson_mut_obj_get(handle->m_pVal_mut, key);
+		yyjson_mut_val* val = ObjectLookupMut(handle, key);
 		if (!val || !yyjson_mut_is_num(val)) {
 			return false;
 		}
@@ -1195,7 +3299,7 @@ bool JsonManager::ObjectGetDouble(JsonValue* handle, const char* key, double* ou
 		*out_value = yyjson_mut_get_num(val);
 		return true;
 	} else {
-		yyjson_val* val = yyjson_obj_get(handle->m_pVal, key);
+		yyjson_val* val = ObjectLookup(handle, key);
 		if (!val || !yyjson_is_num(val)) {
 			return false;
 		}
@@ -1212,7 +3316,7 @@ bool JsonManager::ObjectGetInt(JsonValue* handle, const char* key, int* out_valu
 	}
 
 	if (handle->IsMutable()) {
-		yyjson_mut_val* val = yyjson_mut_obj_get(handle->m_pVal_mut, key);
+		yyjson_mut_val* val = ObjectLookupMut(handle, key);
 		if (!val || !yyjson_mut_is_int(val)) {
 			return false;
 		}
@@ -1220,7 +3324,7 @@ bool JsonManager::ObjectGetInt(JsonValue* handle, const char* key, int* out_valu
 		*out_value = yyjson_mut_get_int(val);
 		return true;
 	} else {
-		yyjson_val* val = yyjson_obj_get(handle->m_pVal, key);
+		yyjson_val* val = ObjectLookup(handle, key);
 		if (!val || !yyjson_is_int(val)) {
 			return false;
 		}
@@ -1237,7 +3341,7 @@ bool JsonManager::ObjectGetInt64(JsonValue* handle, const char* key, std::varian
 	}
 
 	if (handle->IsMutable()) {
-		yyjson_mut_val* val = yyjson_mut_obj_get(handle->m_pVal_mut, key);
+		yyjson_mut_val* val = ObjectLookupMut(handle, key);
 		if (!val || !yyjson_mut_is_int(val)) {
 			return false;
 		}
@@ -1245,7 +3349,7 @@ bool JsonManager::ObjectGetInt64(JsonValue* handle, const char* key, std::varian
 		ReadInt64FromMutVal(val, out_value);
 		return true;
 	} else {
-		yyjson_val* val = yyjson_obj_get(handle->m_pVal, key);
+		yyjson_val* val = ObjectLookup(handle, key);
 		if (!val || !yyjson_is_int(val)) {
 			return false;
 		}
@@ -1262,7 +3366,7 @@ bool JsonManager::ObjectGetString(JsonValue* handle, const char* key, const char
 	}
 
 	if (handle->IsMutable()) {
-		yyjson_mut_val* val = yyjson_mut_obj_get(handle->m_pVal_mut, key);
+		yyjson_mut_val* val = ObjectLookupMut(handle, key);
 		if (!val || !yyjson_mut_is_str(val)) {
 			return false;
 		}
@@ -1273,7 +3377,7 @@ bool JsonManager::ObjectGetString(JsonValue* handle, const char* key, const char
 		}
 		return true;
 	} else {
-		yyjson_val* val = yyjson_obj_get(handle->m_pVal, key);
+		yyjson_val* val = ObjectLookup(handle, key);
 		if (!val || !yyjson_is_str(val)) {
 			return false;
 		}
@@ -1293,7 +3397,7 @@ bool JsonManager::ObjectIsNull(JsonValue* handle, const char* key, bool* out_is_
 	}
 
 	if (handle->IsMutable()) {
-		yyjson_mut_val* val = yyjson_mut_obj_get(handle->m_pVal_mut, key);
+		yyjson_mut_val* val = ObjectLookupMut(handle, key);
 		if (!val) {
 			return false;
 		}
@@ -1301,7 +3405,7 @@ bool JsonManager::ObjectIsNull(JsonValue* handle, const char* key, bool* out_is_
 		*out_is_null = yyjson_mut_is_null(val);
 		return true;
 	} else {
-		yyjson_val* val = yyjson_obj_get(handle->m_pVal, key);
+		yyjson_val* val = ObjectLookup(handle, key);
 		if (!val) {
 			return false;
 		}
@@ -1321,15 +3425,13 @@ bool JsonManager::ObjectHasKey(JsonValue* handle, const char* key, bool use_poin
 		if (use_pointer) {
 			return yyjson_mut_doc_ptr_get(handle->m_pDocument_mut->get(), key) != nullptr;
 		} else {
-			yyjson_mut_obj_iter iter = yyjson_mut_obj_iter_with(handle->m_pVal_mut);
-			return yyjson_mut_obj_iter_get(&iter, key) != nullptr;
+			return ObjectLookupMut(handle, key) != nullptr;
 		}
 	} else {
 		if (use_pointer) {
 			return yyjson_doc_ptr_get(handle->m_pDocument->get(), key) != nullptr;
 		} else {
-			yyjson_obj_iter iter = yyjson_obj_iter_with(handle->m_pVal);
-			return yyjson_obj_iter_get(&iter, key) != nullptr;
+			return ObjectLookup(handle, key) != nullptr;
 		}
 	}
 }
@@ -1340,15 +3442,23 @@ bool JsonManager::ObjectRenameKey(JsonValue* handle, const char* old_key, const
 		return false;
 	}
 
-	if (!yyjson_mut_obj_get(handle->m_pVal_mut, old_key)) {
+	handle->MarkModified();
+
+	if (!ObjectLookupMut(handle, old_key)) {
+		return false;
+	}
+
+	if (!allow_duplicate && ObjectLookupMut(handle, new_key)) {
 		return false;
 	}
 
-	if (!allow_duplicate && yyjson_mut_obj_get(handle->m_pVal_mut, new_key)) {
+	if (!yyjson_mut_obj_rename_key(handle->m_pDocument_mut->get(), handle->m_pVal_mut, old_key, new_key)) {
 		return false;
 	}
 
-	return yyjson_mut_obj_rename_key(handle->m_pDocument_mut->get(), handle->m_pVal_mut, old_key, new_key);
+	// The key is renamed in place, which the index cannot detect
+	handle->m_pDocument_mut->keyIndexes().erase(handle->m_pVal_mut);
+	return true;
 }
 
 bool JsonManager::ObjectSet(JsonValue* handle, const char* key, JsonValue* value)
@@ -1357,6 +3467,8 @@ bool JsonManager::ObjectSet(JsonValue* handle, const char* key, JsonValue* value
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	yyjson_mut_val* val_copy;
 	if (value->IsMutable()) {
 		val_copy = yyjson_mut_val_mut_copy(handle->m_pDocument_mut->get(), value->m_pVal_mut);
@@ -1368,7 +3480,7 @@ bool JsonManager::ObjectSet(JsonValue* handle, const char* key, JsonValue* value
 		return false;
 	}
 
-	return yyjson_mut_obj_put(handle->m_pVal_mut, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), key), val_copy);
+	return ObjectPut(handle, key, val_copy);
 }
 
 bool JsonManager::ObjectSetBool(JsonValue* handle, const char* key, bool value)
@@ -1377,7 +3489,9 @@ bool JsonManager::ObjectSetBool(JsonValue* handle, const char* key, bool value)
 		return false;
 	}
 
-	return yyjson_mut_obj_put(handle->m_pVal_mut, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), key), yyjson_mut_bool(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ObjectPut(handle, key, yyjson_mut_bool(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ObjectSetDouble(JsonValue* handle, const char* key, double value)
@@ -1386,7 +3500,9 @@ bool JsonManager::ObjectSetDouble(JsonValue* handle, const char* key, double val
 		return false;
 	}
 
-	return yyjson_mut_obj_put(handle->m_pVal_mut, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), key), yyjson_mut_real(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ObjectPut(handle, key, yyjson_mut_real(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ObjectSetInt(JsonValue* handle, const char* key, int value)
@@ -1395,7 +3511,9 @@ bool JsonManager::ObjectSetInt(JsonValue* handle, const char* key, int value)
 		return false;
 	}
 
-	return yyjson_mut_obj_put(handle->m_pVal_mut, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), key), yyjson_mut_int(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ObjectPut(handle, key, yyjson_mut_int(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ObjectSetInt64(JsonValue* handle, const char* key, std::variant<int64_t, uint64_t> value)
@@ -1404,10 +3522,12 @@ bool JsonManager::ObjectSetInt64(JsonValue* handle, const char* key, std::varian
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (std::holds_alternative<int64_t>(value)) {
-		return yyjson_mut_obj_put(handle->m_pVal_mut, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), key), yyjson_mut_sint(handle->m_pDocument_mut->get(), std::get<int64_t>(value)));
+		return ObjectPut(handle, key, yyjson_mut_sint(handle->m_pDocument_mut->get(), std::get<int64_t>(value)));
 	} else {
-		return yyjson_mut_obj_put(handle->m_pVal_mut, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), key), yyjson_mut_uint(handle->m_pDocument_mut->get(), std::get<uint64_t>(value)));
+		return ObjectPut(handle, key, yyjson_mut_uint(handle->m_pDocument_mut->get(), std::get<uint64_t>(value)));
 	}
 }
 
@@ -1417,7 +3537,9 @@ bool JsonManager::ObjectSetNull(JsonValue* handle, const char* key)
 		return false;
 	}
 
-	return yyjson_mut_obj_put(handle->m_pVal_mut, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), key), yyjson_mut_null(handle->m_pDocument_mut->get()));
+	handle->MarkValuesModified();
+
+	return ObjectPut(handle, key, yyjson_mut_null(handle->m_pDocument_mut->get()));
 }
 
 bool JsonManager::ObjectSetString(JsonValue* handle, const char* key, const char* value)
@@ -1426,7 +3548,9 @@ bool JsonManager::ObjectSetString(JsonValue* handle, const char* key, const char
 		return false;
 	}
 
-	return yyjson_mut_obj_put(handle->m_pVal_mut, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), key), yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ObjectPut(handle, key, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ObjectRemove(JsonValue* handle, const char* key)
@@ -1435,6 +3559,9 @@ bool JsonManager::ObjectRemove(JsonValue* handle, const char* key)
 		return false;
 	}
 
+	// Keys are unlinked, positions cached for the object no longer hold
+	handle->MarkModified();
+
 	return yyjson_mut_obj_remove_key(handle->m_pVal_mut, key) != nullptr;
 }
 
@@ -1444,6 +3571,8 @@ bool JsonManager::ObjectClear(JsonValue* handle)
 		return false;
 	}
 
+	handle->MarkModified();
+
 	return yyjson_mut_obj_clear(handle->m_pVal_mut);
 }
 
@@ -1453,6 +3582,8 @@ bool JsonManager::ObjectSort(JsonValue* handle, JSON_SORT_ORDER sort_mode)
 		return false;
 	}
 
+	handle->MarkModified();
+
 	if (!yyjson_mut_is_obj(handle->m_pVal_mut)) {
 		return false;
 	}
@@ -1503,6 +3634,9 @@ bool JsonManager::ObjectSort(JsonValue* handle, JSON_SORT_ORDER sort_mode)
 		yyjson_mut_obj_add(handle->m_pVal_mut, pair.key, pair.val);
 	}
 
+	// Of several equal keys, another one may come first now
+	handle->m_pDocument_mut->keyIndexes().erase(handle->m_pVal_mut);
+
 	return true;
 }
 
@@ -1512,6 +3646,8 @@ bool JsonManager::ObjectRotate(JsonValue* handle, size_t idx)
 		return false;
 	}
 
+	handle->MarkModified();
+
 	if (!yyjson_mut_is_obj(handle->m_pVal_mut)) {
 		return false;
 	}
@@ -1738,7 +3874,8 @@ JsonValue* JsonManager::ArrayParseString(const char* str, yyjson_read_flag read_
 	auto pJSONValue = CreateWrapper();
 
 	yyjson_read_err readError;
-	yyjson_doc* idoc = yyjson_read_opts(const_cast<char*>(str), strlen(str), read_flg, nullptr, &readError);
+	std::unique_ptr<JsonDocStorage> storage;
+	yyjson_doc* idoc = ReadStringDocument(str, strlen(str), read_flg, &storage, &readError);
 
 	if (!idoc || readError.code) {
 		if (error && error_size > 0) {
@@ -1759,7 +3896,7 @@ JsonValue* JsonManager::ArrayParseString(const char* str, yyjson_read_flag read_
 	}
 
 	pJSONValue->m_readSize = yyjson_doc_get_read_size(idoc);
-	pJSONValue->m_pDocument = WrapImmutableDocument(idoc);
+	pJSONValue->m_pDocument = WrapImmutableDocument(idoc, std::move(storage));
 	pJSONValue->m_pVal = root;
 
 	return pJSONValue.release();
@@ -1780,9 +3917,9 @@ JsonValue* JsonManager::ArrayParseFile(const char* path, yyjson_read_flag read_f
 	auto pJSONValue = CreateWrapper();
 
 	yyjson_read_err readError;
-	yyjson_doc* idoc = yyjson_read_file(realpath, read_flg, nullptr, &readError);
+	RefPtr<RefCountedImmutableDoc> doc = ReadFileShared(realpath, read_flg, &readError);
 
-	if (!idoc || readError.code) {
+	if (!doc || readError.code) {
 		if (error && error_size > 0) {
 			SetErrorSafe(error, error_size, "Failed to parse JSON file: %s (error code: %u, msg: %s, position: %zu)",
 				realpath, readError.code, readError.msg, readError.pos);
@@ -1790,18 +3927,17 @@ JsonValue* JsonManager::ArrayParseFile(const char* path, yyjson_read_flag read_f
 		return nullptr;
 	}
 
-	yyjson_val* root = yyjson_doc_get_root(idoc);
+	yyjson_val* root = yyjson_doc_get_root(doc->get());
 
 	if (!yyjson_is_arr(root)) {
 		if (error && error_size > 0) {
 			SetErrorSafe(error, error_size, "Root value in file is not an array (got %s)", yyjson_get_type_desc(root));
 		}
-		yyjson_doc_free(idoc);
 		return nullptr;
 	}
 
-	pJSONValue->m_readSize = yyjson_doc_get_read_size(idoc);
-	pJSONValue->m_pDocument = WrapImmutableDocument(idoc);
+	pJSONValue->m_readSize = yyjson_doc_get_read_size(doc->get());
+	pJSONValue->m_pDocument = std::move(doc);
 	pJSONValue->m_pVal = root;
 
 	return pJSONValue.release();
@@ -1834,7 +3970,7 @@ JsonValue* JsonManager::ArrayGet(JsonValue* handle, size_t index)
 			return nullptr;
 		}
 
-		yyjson_mut_val* val = yyjson_mut_arr_get(handle->m_pVal_mut, index);
+		yyjson_mut_val* val = static_cast<yyjson_mut_val*>(ArrayValueAt(handle, index));
 		if (!val) {
 			return nullptr;
 		}
@@ -1847,7 +3983,7 @@ JsonValue* JsonManager::ArrayGet(JsonValue* handle, size_t index)
 			return nullptr;
 		}
 
-		yyjson_val* val = yyjson_arr_get(handle->m_pVal, index);
+		yyjson_val* val = static_cast<yyjson_val*>(ArrayValueAt(handle, index));
 		if (!val) {
 			return nullptr;
 		}
@@ -1949,7 +4085,7 @@ bool JsonManager::ArrayGetBool(JsonValue* handle, size_t index, bool* out_value)
 			return false;
 		}
 
-		yyjson_mut_val* val = yyjson_mut_arr_get(handle->m_pVal_mut, index);
+		yyjson_mut_val* val = static_cast<yyjson_mut_val*>(ArrayValueAt(handle, index));
 		if (!yyjson_mut_is_bool(val)) {
 			return false;
 		}
@@ -1962,7 +4098,7 @@ bool JsonManager::ArrayGetBool(JsonValue* handle, size_t index, bool* out_value)
 			return false;
 		}
 
-		yyjson_val* val = yyjson_arr_get(handle->m_pVal, index);
+		yyjson_val* val = static_cast<yyjson_val*>(ArrayValueAt(handle, index));
 		if (!yyjson_is_bool(val)) {
 			return false;
 		}
@@ -1984,7 +4120,7 @@ bool JsonManager::ArrayGetDouble(JsonValue* handle, size_t index, double* out_va
 			return false;
 		}
 
-		yyjson_mut_val* val = yyjson_mut_arr_get(handle->m_pVal_mut, index);
+		yyjson_mut_val* val = static_cast<yyjson_mut_val*>(ArrayValueAt(handle, index));
 		if (!yyjson_mut_is_num(val)) {
 			return false;
 		}
@@ -1997,7 +4133,7 @@ bool JsonManager::ArrayGetDouble(JsonValue* handle, size_t index, double* out_va
 			return false;
 		}
 
-		yyjson_val* val = yyjson_arr_get(handle->m_pVal, index);
+		yyjson_val* val = static_cast<yyjson_val*>(ArrayValueAt(handle, index));
 		if (!yyjson_is_num(val)) {
 			return false;
 		}
@@ -2019,7 +4155,7 @@ bool JsonManager::ArrayGetInt(JsonValue* handle, size_t index, int* out_value)
 			return false;
 		}
 
-		yyjson_mut_val* val = yyjson_mut_arr_get(handle->m_pVal_mut, index);
+		yyjson_mut_val* val = static_cast<yyjson_mut_val*>(ArrayValueAt(handle, index));
 		if (!yyjson_mut_is_int(val)) {
 			return false;
 		}
@@ -2032,7 +4168,7 @@ bool JsonManager::ArrayGetInt(JsonValue* handle, size_t index, int* out_value)
 			return false;
 		}
 
-		yyjson_val* val = yyjson_arr_get(handle->m_pVal, index);
+		yyjson_val* val = static_cast<yyjson_val*>(ArrayValueAt(handle, index));
 		if (!yyjson_is_int(val)) {
 			return false;
 		}
@@ -2054,7 +4190,7 @@ bool JsonManager::ArrayGetInt64(JsonValue* handle, size_t index, std::variant<in
 			return false;
 		}
 
-		yyjson_mut_val* val = yyjson_mut_arr_get(handle->m_pVal_mut, index);
+		yyjson_mut_val* val = static_cast<yyjson_mut_val*>(ArrayValueAt(handle, index));
 		if (!yyjson_mut_is_int(val)) {
 			return false;
 		}
@@ -2067,7 +4203,7 @@ bool JsonManager::ArrayGetInt64(JsonValue* handle, size_t index, std::variant<in
 			return false;
 		}
 
-		yyjson_val* val = yyjson_arr_get(handle->m_pVal, index);
+		yyjson_val* val = static_cast<yyjson_val*>(ArrayValueAt(handle, index));
 		if (!yyjson_is_int(val)) {
 			return false;
 		}
@@ -2089,7 +4225,7 @@ bool JsonManager::ArrayGetString(JsonValue* handle, size_t index, const char** o
 			return false;
 		}
 
-		yyjson_mut_val* val = yyjson_mut_arr_get(handle->m_pVal_mut, index);
+		yyjson_mut_val* val = static_cast<yyjson_mut_val*>(ArrayValueAt(handle, index));
 		if (!yyjson_mut_is_str(val)) {
 			return false;
 		}
@@ -2105,7 +4241,7 @@ bool JsonManager::ArrayGetString(JsonValue* handle, size_t index, const char** o
 			return false;
 		}
 
-		yyjson_val* val = yyjson_arr_get(handle->m_pVal, index);
+		yyjson_val* val = static_cast<yyjson_val*>(ArrayValueAt(handle, index));
 		if (!yyjson_is_str(val)) {
 			return false;
 		}
@@ -2130,7 +4266,7 @@ bool JsonManager::ArrayIsNull(JsonValue* handle, size_t index)
 			return false;
 		}
 
-		yyjson_mut_val* val = yyjson_mut_arr_get(handle->m_pVal_mut, index);
+		yyjson_mut_val* val = static_cast<yyjson_mut_val*>(ArrayValueAt(handle, index));
 		return yyjson_mut_is_null(val);
 	} else {
 		size_t arr_size = yyjson_arr_size(handle->m_pVal);
@@ -2138,7 +4274,7 @@ bool JsonManager::ArrayIsNull(JsonValue* handle, size_t index)
 			return false;
 		}
 
-		yyjson_val* val = yyjson_arr_get(handle->m_pVal, index);
+		yyjson_val* val = static_cast<yyjson_val*>(ArrayValueAt(handle, index));
 		return yyjson_is_null(val);
 	}
 }
@@ -2149,6 +4285,8 @@ bool JsonManager::ArrayReplace(JsonValue* handle, size_t index, JsonValue* value
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	size_t arr_size = yyjson_mut_arr_size(handle->m_pVal_mut);
 	if (index >= arr_size) {
 		return false;
@@ -2165,7 +4303,7 @@ bool JsonManager::ArrayReplace(JsonValue* handle, size_t index, JsonValue* value
 		return false;
 	}
 
-	return yyjson_mut_arr_replace(handle->m_pVal_mut, index, val_copy) != nullptr;
+	return ArraySetAt(handle, index, val_copy);
 }
 
 bool JsonManager::ArrayReplaceBool(JsonValue* handle, size_t index, bool value)
@@ -2174,12 +4312,14 @@ bool JsonManager::ArrayReplaceBool(JsonValue* handle, size_t index, bool value)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	size_t arr_size = yyjson_mut_arr_size(handle->m_pVal_mut);
 	if (index >= arr_size) {
 		return false;
 	}
 
-	return yyjson_mut_arr_replace(handle->m_pVal_mut, index, yyjson_mut_bool(handle->m_pDocument_mut->get(), value)) != nullptr;
+	return ArraySetAt(handle, index, yyjson_mut_bool(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayReplaceDouble(JsonValue* handle, size_t index, double value)
@@ -2188,12 +4328,14 @@ bool JsonManager::ArrayReplaceDouble(JsonValue* handle, size_t index, double val
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	size_t arr_size = yyjson_mut_arr_size(handle->m_pVal_mut);
 	if (index >= arr_size) {
 		return false;
 	}
 
-	return yyjson_mut_arr_replace(handle->m_pVal_mut, index, yyjson_mut_real(handle->m_pDocument_mut->get(), value)) != nullptr;
+	return ArraySetAt(handle, index, yyjson_mut_real(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayReplaceInt(JsonValue* handle, size_t index, int value)
@@ -2202,12 +4344,14 @@ bool JsonManager::ArrayReplaceInt(JsonValue* handle, size_t index, int value)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	size_t arr_size = yyjson_mut_arr_size(handle->m_pVal_mut);
 	if (index >= arr_size) {
 		return false;
 	}
 
-	return yyjson_mut_arr_replace(handle->m_pVal_mut, index, yyjson_mut_int(handle->m_pDocument_mut->get(), value)) != nullptr;
+	return ArraySetAt(handle, index, yyjson_mut_int(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayReplaceInt64(JsonValue* handle, size_t index, std::variant<int64_t, uint64_t> value)
@@ -2216,15 +4360,17 @@ bool JsonManager::ArrayReplaceInt64(JsonValue* handle, size_t index, std::varian
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	size_t arr_size = yyjson_mut_arr_size(handle->m_pVal_mut);
 	if (index >= arr_size) {
 		return false;
 	}
 
 	if (std::holds_alternative<int64_t>(value)) {
-		return yyjson_mut_arr_replace(handle->m_pVal_mut, index, yyjson_mut_sint(handle->m_pDocument_mut->get(), std::get<int64_t>(value))) != nullptr;
+		return ArraySetAt(handle, index, yyjson_mut_sint(handle->m_pDocument_mut->get(), std::get<int64_t>(value)));
 	} else {
-		return yyjson_mut_arr_replace(handle->m_pVal_mut, index, yyjson_mut_uint(handle->m_pDocument_mut->get(), std::get<uint64_t>(value))) != nullptr;
+		return ArraySetAt(handle, index, yyjson_mut_uint(handle->m_pDocument_mut->get(), std::get<uint64_t>(value)));
 	}
 }
 
@@ -2234,12 +4380,14 @@ bool JsonManager::ArrayReplaceNull(JsonValue* handle, size_t index)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	size_t arr_size = yyjson_mut_arr_size(handle->m_pVal_mut);
 	if (index >= arr_size) {
 		return false;
 	}
 
-	return yyjson_mut_arr_replace(handle->m_pVal_mut, index, yyjson_mut_null(handle->m_pDocument_mut->get())) != nullptr;
+	return ArraySetAt(handle, index, yyjson_mut_null(handle->m_pDocument_mut->get()));
 }
 
 bool JsonManager::ArrayReplaceString(JsonValue* handle, size_t index, const char* value)
@@ -2248,12 +4396,14 @@ bool JsonManager::ArrayReplaceString(JsonValue* handle, size_t index, const char
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	size_t arr_size = yyjson_mut_arr_size(handle->m_pVal_mut);
 	if (index >= arr_size) {
 		return false;
 	}
 
-	return yyjson_mut_arr_replace(handle->m_pVal_mut, index, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value)) != nullptr;
+	return ArraySetAt(handle, index, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayAppend(JsonValue* handle, JsonValue* value)
@@ -2262,6 +4412,8 @@ bool JsonManager::ArrayAppend(JsonValue* handle, JsonValue* value)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	yyjson_mut_val* val_copy;
 	if (value->IsMutable()) {
 		val_copy = yyjson_mut_val_mut_copy(handle->m_pDocument_mut->get(), value->m_pVal_mut);
@@ -2273,7 +4425,7 @@ bool JsonManager::ArrayAppend(JsonValue* handle, JsonValue* value)
 		return false;
 	}
 
-	return yyjson_mut_arr_append(handle->m_pVal_mut, val_copy);
+	return ArrayInsertAt(handle, yyjson_mut_arr_size(handle->m_pVal_mut), val_copy);
 }
 
 bool JsonManager::ArrayAppendBool(JsonValue* handle, bool value)
@@ -2282,7 +4434,9 @@ bool JsonManager::ArrayAppendBool(JsonValue* handle, bool value)
 		return false;
 	}
 
-	return yyjson_mut_arr_append(handle->m_pVal_mut, yyjson_mut_bool(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, yyjson_mut_arr_size(handle->m_pVal_mut), yyjson_mut_bool(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayAppendDouble(JsonValue* handle, double value)
@@ -2291,7 +4445,9 @@ bool JsonManager::ArrayAppendDouble(JsonValue* handle, double value)
 		return false;
 	}
 
-	return yyjson_mut_arr_append(handle->m_pVal_mut, yyjson_mut_real(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, yyjson_mut_arr_size(handle->m_pVal_mut), yyjson_mut_real(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayAppendInt(JsonValue* handle, int value)
@@ -2300,7 +4456,9 @@ bool JsonManager::ArrayAppendInt(JsonValue* handle, int value)
 		return false;
 	}
 
-	return yyjson_mut_arr_append(handle->m_pVal_mut, yyjson_mut_int(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, yyjson_mut_arr_size(handle->m_pVal_mut), yyjson_mut_int(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayAppendInt64(JsonValue* handle, std::variant<int64_t, uint64_t> value)
@@ -2309,10 +4467,12 @@ bool JsonManager::ArrayAppendInt64(JsonValue* handle, std::variant<int64_t, uint
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (std::holds_alternative<int64_t>(value)) {
-		return yyjson_mut_arr_append(handle->m_pVal_mut, yyjson_mut_sint(handle->m_pDocument_mut->get(), std::get<int64_t>(value)));
+		return ArrayInsertAt(handle, yyjson_mut_arr_size(handle->m_pVal_mut), yyjson_mut_sint(handle->m_pDocument_mut->get(), std::get<int64_t>(value)));
 	} else {
-		return yyjson_mut_arr_append(handle->m_pVal_mut, yyjson_mut_uint(handle->m_pDocument_mut->get(), std::get<uint64_t>(value)));
+		return ArrayInsertAt(handle, yyjson_mut_arr_size(handle->m_pVal_mut), yyjson_mut_uint(handle->m_pDocument_mut->get(), std::get<uint64_t>(value)));
 	}
 }
 
@@ -2322,7 +4482,9 @@ bool JsonManager::ArrayAppendNull(JsonValue* handle)
 		return false;
 	}
 
-	return yyjson_mut_arr_append(handle->m_pVal_mut, yyjson_mut_null(handle->m_pDocument_mut->get()));
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, yyjson_mut_arr_size(handle->m_pVal_mut), yyjson_mut_null(handle->m_pDocument_mut->get()));
 }
 
 bool JsonManager::ArrayAppendString(JsonValue* handle, const char* value)
@@ -2331,7 +4493,9 @@ bool JsonManager::ArrayAppendString(JsonValue* handle, const char* value)
 		return false;
 	}
 
-	return yyjson_mut_arr_append(handle->m_pVal_mut, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, yyjson_mut_arr_size(handle->m_pVal_mut), yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayInsert(JsonValue* handle, size_t index, JsonValue* value)
@@ -2340,6 +4504,8 @@ bool JsonManager::ArrayInsert(JsonValue* handle, size_t index, JsonValue* value)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	size_t arr_size = yyjson_mut_arr_size(handle->m_pVal_mut);
 	if (index > arr_size) {
 		return false;
@@ -2356,7 +4522,7 @@ bool JsonManager::ArrayInsert(JsonValue* handle, size_t index, JsonValue* value)
 		return false;
 	}
 
-	return yyjson_mut_arr_insert(handle->m_pVal_mut, val_copy, index);
+	return ArrayInsertAt(handle, index, val_copy);
 }
 
 bool JsonManager::ArrayInsertBool(JsonValue* handle, size_t index, bool value)
@@ -2365,7 +4531,9 @@ bool JsonManager::ArrayInsertBool(JsonValue* handle, size_t index, bool value)
 		return false;
 	}
 
-	return yyjson_mut_arr_insert(handle->m_pVal_mut, yyjson_mut_bool(handle->m_pDocument_mut->get(), value), index);
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, index, yyjson_mut_bool(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayInsertInt(JsonValue* handle, size_t index, int value)
@@ -2374,7 +4542,9 @@ bool JsonManager::ArrayInsertInt(JsonValue* handle, size_t index, int value)
 		return false;
 	}
 
-	return yyjson_mut_arr_insert(handle->m_pVal_mut, yyjson_mut_sint(handle->m_pDocument_mut->get(), value), index);
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, index, yyjson_mut_sint(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayInsertInt64(JsonValue* handle, size_t index, std::variant<int64_t, uint64_t> value)
@@ -2383,6 +4553,8 @@ bool JsonManager::ArrayInsertInt64(JsonValue* handle, size_t index, std::variant
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	yyjson_mut_val* val;
 	if (std::holds_alternative<int64_t>(value)) {
 		val = yyjson_mut_sint(handle->m_pDocument_mut->get(), std::get<int64_t>(value));
@@ -2394,7 +4566,7 @@ bool JsonManager::ArrayInsertInt64(JsonValue* handle, size_t index, std::variant
 		return false;
 	}
 
-	return yyjson_mut_arr_insert(handle->m_pVal_mut, val, index);
+	return ArrayInsertAt(handle, index, val);
 }
 
 bool JsonManager::ArrayInsertDouble(JsonValue* handle, size_t index, double value)
@@ -2403,7 +4575,9 @@ bool JsonManager::ArrayInsertDouble(JsonValue* handle, size_t index, double valu
 		return false;
 	}
 
-	return yyjson_mut_arr_insert(handle->m_pVal_mut, yyjson_mut_real(handle->m_pDocument_mut->get(), value), index);
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, index, yyjson_mut_real(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayInsertString(JsonValue* handle, size_t index, const char* value)
@@ -2412,7 +4586,9 @@ bool JsonManager::ArrayInsertString(JsonValue* handle, size_t index, const char*
 		return false;
 	}
 
-	return yyjson_mut_arr_insert(handle->m_pVal_mut, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value), index);
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, index, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayInsertNull(JsonValue* handle, size_t index)
@@ -2421,7 +4597,9 @@ bool JsonManager::ArrayInsertNull(JsonValue* handle, size_t index)
 		return false;
 	}
 
-	return yyjson_mut_arr_insert(handle->m_pVal_mut, yyjson_mut_null(handle->m_pDocument_mut->get()), index);
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, index, yyjson_mut_null(handle->m_pDocument_mut->get()));
 }
 
 bool JsonManager::ArrayPrepend(JsonValue* handle, JsonValue* value)
@@ -2430,6 +4608,8 @@ bool JsonManager::ArrayPrepend(JsonValue* handle, JsonValue* value)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	yyjson_mut_val* val_copy;
 	if (value->IsMutable()) {
 		val_copy = yyjson_mut_val_mut_copy(handle->m_pDocument_mut->get(), value->m_pVal_mut);
@@ -2441,7 +4621,7 @@ bool JsonManager::ArrayPrepend(JsonValue* handle, JsonValue* value)
 		return false;
 	}
 
-	return yyjson_mut_arr_prepend(handle->m_pVal_mut, val_copy);
+	return ArrayInsertAt(handle, 0, val_copy);
 }
 
 bool JsonManager::ArrayPrependBool(JsonValue* handle, bool value)
@@ -2450,7 +4630,9 @@ bool JsonManager::ArrayPrependBool(JsonValue* handle, bool value)
 		return false;
 	}
 
-	return yyjson_mut_arr_prepend(handle->m_pVal_mut, yyjson_mut_bool(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, 0, yyjson_mut_bool(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayPrependInt(JsonValue* handle, int value)
@@ -2459,7 +4641,9 @@ bool JsonManager::ArrayPrependInt(JsonValue* handle, int value)
 		return false;
 	}
 
-	return yyjson_mut_arr_prepend(handle->m_pVal_mut, yyjson_mut_sint(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, 0, yyjson_mut_sint(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayPrependInt64(JsonValue* handle, std::variant<int64_t, uint64_t> value)
@@ -2468,6 +4652,8 @@ bool JsonManager::ArrayPrependInt64(JsonValue* handle, std::variant<int64_t, uin
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	yyjson_mut_val* val;
 	if (std::holds_alternative<int64_t>(value)) {
 		val = yyjson_mut_sint(handle->m_pDocument_mut->get(), std::get<int64_t>(value));
@@ -2479,7 +4665,7 @@ bool JsonManager::ArrayPrependInt64(JsonValue* handle, std::variant<int64_t, uin
 		return false;
 	}
 
-	return yyjson_mut_arr_prepend(handle->m_pVal_mut, val);
+	return ArrayInsertAt(handle, 0, val);
 }
 
 bool JsonManager::ArrayPrependDouble(JsonValue* handle, double value)
@@ -2488,7 +4674,9 @@ bool JsonManager::ArrayPrependDouble(JsonValue* handle, double value)
 		return false;
 	}
 
-	return yyjson_mut_arr_prepend(handle->m_pVal_mut, yyjson_mut_real(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, 0, yyjson_mut_real(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayPrependString(JsonValue* handle, const char* value)
@@ -2497,7 +4685,9 @@ bool JsonManager::ArrayPrependString(JsonValue* handle, const char* value)
 		return false;
 	}
 
-	return yyjson_mut_arr_prepend(handle->m_pVal_mut, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value));
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, 0, yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value));
 }
 
 bool JsonManager::ArrayPrependNull(JsonValue* handle)
@@ -2506,7 +4696,9 @@ bool JsonManager::ArrayPrependNull(JsonValue* handle)
 		return false;
 	}
 
-	return yyjson_mut_arr_prepend(handle->m_pVal_mut, yyjson_mut_null(handle->m_pDocument_mut->get()));
+	handle->MarkValuesModified();
+
+	return ArrayInsertAt(handle, 0, yyjson_mut_null(handle->m_pDocument_mut->get()));
 }
 
 bool JsonManager::ArrayRemove(JsonValue* handle, size_t index)
@@ -2515,12 +4707,14 @@ bool JsonManager::ArrayRemove(JsonValue* handle, size_t index)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	size_t arr_size = yyjson_mut_arr_size(handle->m_pVal_mut);
 	if (index >= arr_size) {
 		return false;
 	}
 
-	return yyjson_mut_arr_remove(handle->m_pVal_mut, index) != nullptr;
+	return ArrayRemoveAt(handle, index);
 }
 
 bool JsonManager::ArrayRemoveFirst(JsonValue* handle)
@@ -2529,11 +4723,13 @@ bool JsonManager::ArrayRemoveFirst(JsonValue* handle)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (yyjson_mut_arr_size(handle->m_pVal_mut) == 0) {
 		return false;
 	}
 
-	return yyjson_mut_arr_remove_first(handle->m_pVal_mut) != nullptr;
+	return ArrayRemoveAt(handle, 0);
 }
 
 bool JsonManager::ArrayRemoveLast(JsonValue* handle)
@@ -2542,11 +4738,13 @@ bool JsonManager::ArrayRemoveLast(JsonValue* handle)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (yyjson_mut_arr_size(handle->m_pVal_mut) == 0) {
 		return false;
 	}
 
-	return yyjson_mut_arr_remove_last(handle->m_pVal_mut) != nullptr;
+	return ArrayRemoveAt(handle, yyjson_mut_arr_size(handle->m_pVal_mut) - 1);
 }
 
 bool JsonManager::ArrayRemoveRange(JsonValue* handle, size_t start_index, size_t count)
@@ -2555,6 +4753,8 @@ bool JsonManager::ArrayRemoveRange(JsonValue* handle, size_t start_index, size_t
 		return false;
 	}
 
+	handle->MarkModified();
+
 	size_t arr_size = yyjson_mut_arr_size(handle->m_pVal_mut);
 
 	if (start_index >= arr_size) {
@@ -2578,6 +4778,8 @@ bool JsonManager::ArrayClear(JsonValue* handle)
 		return false;
 	}
 
+	handle->MarkModified();
+
 	return yyjson_mut_arr_clear(handle->m_pVal_mut);
 }
 
@@ -2746,6 +4948,8 @@ bool JsonManager::ArraySort(JsonValue* handle, JSON_SORT_ORDER sort_mode)
 		return false;
 	}
 
+	handle->MarkModified();
+
 	if (!yyjson_mut_is_arr(handle->m_pVal_mut)) {
 		return false;
 	}
@@ -2872,6 +5076,8 @@ bool JsonManager::ArrayRotate(JsonValue* handle, size_t idx)
 		return false;
 	}
 
+	handle->MarkModified();
+
 	if (!yyjson_mut_is_arr(handle->m_pVal_mut)) {
 		return false;
 	}
@@ -3791,6 +5997,8 @@ bool JsonManager::PtrSet(JsonValue* handle, const char* path, JsonValue* value,
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val_copy;
 	if (value->IsMutable()) {
 		val_copy = yyjson_mut_val_mut_copy(handle->m_pDocument_mut->get(), value->m_pVal_mut);
@@ -3825,6 +6033,8 @@ bool JsonManager::PtrSetBool(JsonValue* handle, const char* path, bool value, ch
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val = yyjson_mut_bool(handle->m_pDocument_mut->get(), value);
 	if (!val) {
 		if (error && error_size > 0) {
@@ -3853,6 +6063,8 @@ bool JsonManager::PtrSetDouble(JsonValue* handle, const char* path, double value
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val = yyjson_mut_real(handle->m_pDocument_mut->get(), value);
 	if (!val) {
 		if (error && error_size > 0) {
@@ -3881,6 +6093,8 @@ bool JsonManager::PtrSetInt(JsonValue* handle, const char* path, int value, char
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val = yyjson_mut_int(handle->m_pDocument_mut->get(), value);
 	if (!val) {
 		if (error && error_size > 0) {
@@ -3909,6 +6123,8 @@ bool JsonManager::PtrSetInt64(JsonValue* handle, const char* path, std::variant<
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val;
 	if (std::holds_alternative<int64_t>(value)) {
 		val = yyjson_mut_sint(handle->m_pDocument_mut->get(), std::get<int64_t>(value));
@@ -3942,6 +6158,8 @@ bool JsonManager::PtrSetString(JsonValue* handle, const char* path, const char*
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val = yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value);
 	if (!val) {
 		if (error && error_size > 0) {
@@ -3970,6 +6188,8 @@ bool JsonManager::PtrSetNull(JsonValue* handle, const char* path, char* error, s
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val = yyjson_mut_null(handle->m_pDocument_mut->get());
 	if (!val) {
 		if (error && error_size > 0) {
@@ -3998,6 +6218,8 @@ bool JsonManager::PtrAdd(JsonValue* handle, const char* path, JsonValue* value,
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val_copy;
 	if (value->IsMutable()) {
 		val_copy = yyjson_mut_val_mut_copy(handle->m_pDocument_mut->get(), value->m_pVal_mut);
@@ -4032,6 +6254,8 @@ bool JsonManager::PtrAddBool(JsonValue* handle, const char* path, bool value, ch
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val = yyjson_mut_bool(handle->m_pDocument_mut->get(), value);
 	if (!val) {
 		if (error && error_size > 0) {
@@ -4060,6 +6284,8 @@ bool JsonManager::PtrAddDouble(JsonValue* handle, const char* path, double value
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val = yyjson_mut_real(handle->m_pDocument_mut->get(), value);
 	if (!val) {
 		if (error && error_size > 0) {
@@ -4088,6 +6314,8 @@ bool JsonManager::PtrAddInt(JsonValue* handle, const char* path, int value, char
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val = yyjson_mut_int(handle->m_pDocument_mut->get(), value);
 	if (!val) {
 		if (error && error_size > 0) {
@@ -4116,6 +6344,8 @@ bool JsonManager::PtrAddInt64(JsonValue* handle, const char* path, std::variant<
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val;
 	if (std::holds_alternative<int64_t>(value)) {
 		val = yyjson_mut_sint(handle->m_pDocument_mut->get(), std::get<int64_t>(value));
@@ -4149,6 +6379,8 @@ bool JsonManager::PtrAddString(JsonValue* handle, const char* path, const char*
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val = yyjson_mut_strcpy(handle->m_pDocument_mut->get(), value);
 	if (!val) {
 		if (error && error_size > 0) {
@@ -4177,6 +6409,8 @@ bool JsonManager::PtrAddNull(JsonValue* handle, const char* path, char* error, s
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_mut_val* val = yyjson_mut_null(handle->m_pDocument_mut->get());
 	if (!val) {
 		if (error && error_size > 0) {
@@ -4205,6 +6439,8 @@ bool JsonManager::PtrRemove(JsonValue* handle, const char* path, char* error, si
 		return false;
 	}
 
+	handle->MarkModified();
+
 	yyjson_ptr_err ptrRemoveError;
 	bool success = yyjson_mut_doc_ptr_removex(handle->m_pDocument_mut->get(), path, strlen(path), nullptr, &ptrRemoveError) != nullptr;
 
@@ -4755,6 +6991,8 @@ void* JsonManager::ArrIterRemove(JsonArrIter* iter)
 		return nullptr;
 	}
 
+	iter->m_pDocument_mut->touch();
+
 	return yyjson_mut_arr_iter_remove(&iter->m_iterMut);
 }
 
@@ -4933,6 +7171,8 @@ void* JsonManager::ObjIterRemove(JsonObjIter* iter)
 		return nullptr;
 	}
 
+	iter->m_pDocument_mut->touch();
+
 	return yyjson_mut_obj_iter_remove(&iter->m_iterMut);
 }
 
@@ -5011,6 +7251,295 @@ JsonObjIter* JsonManager::GetObjIterFromHandle(IPluginContext* pContext, Handle_
 	return pIter;
 }
 
+JsonCursor* JsonManager::CursorCreate(JsonValue* handle)
+{
+	if (!handle || (!handle->m_pVal_mut && !handle->m_pVal)) {
+		return nullptr;
+	}
+
+	auto cursor = new JsonCursor();
+	cursor->m_current.m_pDocument_mut = handle->m_pDocument_mut;
+	cursor->m_current.m_pDocument = handle->m_pDocument;
+	cursor->m_current.m_pVal_mut = handle->m_pVal_mut;
+	cursor->m_current.m_pVal = handle->m_pVal;
+	cursor->m_start = cursor->GetPosition();
+
+	return cursor;
+}
+
+bool JsonManager::CursorEnter(JsonCursor* cursor, const char* key)
+{
+	if (!cursor || !key) {
+		return false;
+	}
+
+	JsonValue* current = &cursor->m_current;
+	void* val = current->IsMutable() ? static_cast<void*>(ObjectLookupMut(current, key))
+		: static_cast<void*>(ObjectLookup(current, key));
+	if (!val) {
+		return false;
+	}
+
+	cursor->m_path.push_back(cursor->GetPosition());
+	cursor->MoveTo(val);
+	return true;
+}
+
+bool JsonManager::CursorEnterIndex(JsonCursor* cursor, size_t index)
+{
+	if (!cursor) {
+		return false;
+	}
+
+	void* val = ArrayValueAt(&cursor->m_current, index);
+	if (!val) {
+		return false;
+	}
+
+	cursor->m_path.push_back(cursor->GetPosition());
+	cursor->MoveTo(val);
+	return true;
+}
+
+bool JsonManager::CursorPointer(JsonCursor* cursor, const char* path)
+{
+	if (!cursor || !path) {
+		return false;
+	}
+
+	JsonValue* current = &cursor->m_current;
+	void* val = current->IsMutable() ? static_cast<void*>(yyjson_mut_ptr_get(current->m_pVal_mut, path))
+		: static_cast<void*>(yyjson_ptr_get(current->m_pVal, path));
+	if (!val) {
+		return false;
+	}
+
+	cursor->m_path.push_back(cursor->GetPosition());
+	cursor->MoveTo(val);
+	return true;
+}
+
+bool JsonManager::CursorParent(JsonCursor* cursor)
+{
+	if (!cursor || cursor->m_path.empty()) {
+		return false;
+	}
+
+	cursor->MoveTo(cursor->m_path.back());
+	cursor->m_path.pop_back();
+	return true;
+}
+
+void JsonManager::CursorReset(JsonCursor* cursor)
+{
+	if (!cursor) {
+		return;
+	}
+
+	cursor->MoveTo(cursor->m_start);
+	cursor->m_path.clear();
+}
+
+size_t JsonManager::CursorGetDepth(JsonCursor* cursor)
+{
+	return cursor ? cursor->m_path.size() : 0;
+}
+
+JsonValue* JsonManager::CursorGetCurrent(JsonCursor* cursor)
+{
+	return cursor ? &cursor->m_current : nullptr;
+}
+
+JsonValue* JsonManager::CursorGetValue(JsonCursor* cursor)
+{
+	if (!cursor) {
+		return nullptr;
+	}
+
+	auto pJSONValue = CreateWrapper();
+	pJSONValue->m_pDocument_mut = cursor->m_current.m_pDocument_mut;
+	pJSONValue->m_pDocument = cursor->m_current.m_pDocument;
+	pJSONValue->m_pVal_mut = cursor->m_current.m_pVal_mut;
+	pJSONValue->m_pVal = cursor->m_current.m_pVal;
+
+	return pJSONValue.release();
+}
+
+void JsonManager::ReleaseCursor(JsonCursor* cursor)
+{
+	if (cursor) {
+		delete cursor;
+	}
+}
+
+HandleType_t JsonManager::GetCursorHandleType()
+{
+	return g_CursorType;
+}
+
+JsonCursor* JsonManager::GetCursorFromHandle(IPluginContext* pContext, Handle_t handle)
+{
+	HandleError err;
+	HandleSecurity sec(pContext->GetIdentity(), myself->GetIdentity());
+
+	JsonCursor* pCursor;
+	if ((err = handlesys->ReadHandle(handle, g_CursorType, &sec, (void**)&pCursor)) != HandleError_None)
+	{
+		pContext->ReportError("Invalid JSONCursor handle %x (error %d)", handle, err);
+		return nullptr;
+	}
+
+	return pCursor;
+}
+
+yyjson_val* JsonManager::NodeValue(JsonValue* handle, int node)
+{
+	if (!handle || !handle->IsImmutable() || node < 0) {
+		return nullptr;
+	}
+
+	// Every slot from the value up to the one after it holds one of its values
+	yyjson_val* val = handle->m_pVal;
+	if (static_cast<size_t>(node) >= static_cast<size_t>(unsafe_yyjson_get_next(val) - val)) {
+		return nullptr;
+	}
+
+	return val + node;
+}
+
+int JsonManager::NodeOf(JsonValue* handle, yyjson_val* val)
+{
+	if (!val) {
+		return -1;
+	}
+
+	ptrdiff_t node = val - handle->m_pVal;
+	return node <= std::numeric_limits<int>::max() ? static_cast<int>(node) : -1;
+}
+
+bool JsonManager::IsValidNode(JsonValue* handle, int node)
+{
+	return NodeValue(handle, node) != nullptr;
+}
+
+int JsonManager::NodeChild(JsonValue* handle, int node, const char* key)
+{
+	yyjson_val* val = NodeValue(handle, node);
+	if (!val || !key || !yyjson_is_obj(val)) {
+		return -1;
+	}
+
+	return NodeOf(handle, ObjectLookup(*handle->m_pDocument, val, key));
+}
+
+int JsonManager::NodeAt(JsonValue* handle, int node, size_t index)
+{
+	yyjson_val* val = NodeValue(handle, node);
+	if (!val || !yyjson_is_arr(val)) {
+		return -1;
+	}
+
+	return NodeOf(handle, ArrayValueAt(*handle->m_pDocument, val, index));
+}
+
+int JsonManager::NodeFind(JsonValue* handle, int node, const char* path)
+{
+	yyjson_val* val = NodeValue(handle, node);
+	if (!val || !path) {
+		return -1;
+	}
+
+	return NodeOf(handle, yyjson_ptr_get(val, path));
+}
+
+yyjson_type JsonManager::NodeGetType(JsonValue* handle, int node)
+{
+	return yyjson_get_type(NodeValue(handle, node));
+}
+
+size_t JsonManager::NodeGetSize(JsonValue* handle, int node)
+{
+	yyjson_val* val = NodeValue(handle, node);
+	return yyjson_is_ctn(val) ? unsafe_yyjson_get_len(val) : 0;
+}
+
+bool JsonManager::NodeGetBool(JsonValue* handle, int node, bool* out_value)
+{
+	yyjson_val* val = NodeValue(handle, node);
+	if (!out_value || !yyjson_is_bool(val)) {
+		return false;
+	}
+
+	*out_value = unsafe_yyjson_get_bool(val);
+	return true;
+}
+
+bool JsonManager::NodeGetDouble(JsonValue* handle, int node, double* out_value)
+{
+	yyjson_val* val = NodeValue(handle, node);
+	if (!out_value || !yyjson_is_num(val)) {
+		return false;
+	}
+
+	*out_value = yyjson_get_num(val);
+	return true;
+}
+
+bool JsonManager::NodeGetInt(JsonValue* handle, int node, int* out_value)
+{
+	yyjson_val* val = NodeValue(handle, node);
+	if (!out_value || !yyjson_is_int(val)) {
+		return false;
+	}
+
+	*out_value = yyjson_get_int(val);
+	return true;
+}
+
+bool JsonManager::NodeGetInt64(JsonValue* handle, int node, std::variant<int64_t, uint64_t>* out_value)
+{
+	yyjson_val* val = NodeValue(handle, node);
+	if (!out_value || !yyjson_is_int(val)) {
+		return false;
+	}
+
+	ReadInt64FromVal(val, out_value);
+	return true;
+}
+
+bool JsonManager::NodeGetString(JsonValue* handle, int node, const char** out_str, size_t* out_len)
+{
+	yyjson_val* val = NodeValue(handle, node);
+	if (!out_str || !yyjson_is_str(val)) {
+		return false;
+	}
+
+	*out_str = unsafe_yyjson_get_str(val);
+	if (out_len) {
+		*out_len = unsafe_yyjson_get_len(val);
+	}
+	return true;
+}
+
+bool JsonManager::NodeIsNull(JsonValue* handle, int node)
+{
+	return yyjson_is_null(NodeValue(handle, node));
+}
+
+JsonValue* JsonManager::NodeGetValue(JsonValue* handle, int node)
+{
+	yyjson_val* val = NodeValue(handle, node);
+	if (!val) {
+		return nullptr;
+	}
+
+	auto pJSONValue = CreateWrapper();
+	pJSONValue->m_pDocument = handle->m_pDocument;
+	pJSONValue->m_pVal = val;
+
+	return pJSONValue.release();
+}
+
 JsonValue* JsonManager::ReadNumber(const char* dat, uint32_t read_flg, char* error, size_t error_size, size_t* out_consumed)
 {
 	if (!dat) {
@@ -5099,6 +7628,8 @@ bool JsonManager::SetFpToFloat(JsonValue* handle, bool flt)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (handle->IsMutable()) {
 		return yyjson_mut_set_fp_to_float(handle->m_pVal_mut, flt);
 	} else {
@@ -5112,6 +7643,8 @@ bool JsonManager::SetFpToFixed(JsonValue* handle, int prec)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (prec < 1 || prec > 15) {
 		return false;
 	}
@@ -5129,6 +7662,8 @@ bool JsonManager::SetBool(JsonValue* handle, bool value)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (handle->IsMutable()) {
 		return yyjson_mut_set_bool(handle->m_pVal_mut, value);
 	} else {
@@ -5142,6 +7677,8 @@ bool JsonManager::SetInt(JsonValue* handle, int value)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (handle->IsMutable()) {
 		return yyjson_mut_set_int(handle->m_pVal_mut, value);
 	} else {
@@ -5155,6 +7692,8 @@ bool JsonManager::SetInt64(JsonValue* handle, std::variant<int64_t, uint64_t> va
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (handle->IsMutable()) {
 		if (std::holds_alternative<int64_t>(value)) {
 			return yyjson_mut_set_sint(handle->m_pVal_mut, std::get<int64_t>(value));
@@ -5176,6 +7715,8 @@ bool JsonManager::SetDouble(JsonValue* handle, double value)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (handle->IsMutable()) {
 		return yyjson_mut_set_real(handle->m_pVal_mut, value);
 	} else {
@@ -5189,6 +7730,8 @@ bool JsonManager::SetString(JsonValue* handle, const char* value)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (handle->IsMutable()) {
 		return yyjson_mut_set_str(handle->m_pVal_mut, value);
 	} else {
@@ -5202,6 +7745,8 @@ bool JsonManager::SetNull(JsonValue* handle)
 		return false;
 	}
 
+	handle->MarkValuesModified();
+
 	if (handle->IsMutable()) {
 		return yyjson_mut_set_null(handle->m_pVal_mut);
 	} else {
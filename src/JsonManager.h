@@ -3,9 +3,18 @@
 
 #include <IJsonManager.h>
 #include <yyjson.h>
+#include "JsonFile.h"
+#include "JsonLinesWriter.h"
+#include "JsonReadBudget.h"
+#include "JsonKeyIndex.h"
+#include "JsonArrayIndex.h"
+#include <array>
 #include <random>
 #include <memory>
 #include <charconv>
+#include <string>
+#include <unordered_map>
+#include <list>
 
 /**
  * @brief Base class for intrusive reference counting
@@ -129,16 +138,29 @@ template <typename T, typename... Args> RefPtr<T> make_ref(Args &&...args) {
 	return RefPtr<T>(new T(std::forward<Args>(args)...));
 }
 
+/**
+ * @brief Next document generation
+ *
+ * Generations are unique across all documents, so a document allocated at the address of a
+ * released one never matches output cached for the old one.
+ */
+uint64_t NextDocGeneration() noexcept;
+
 /**
  * @brief Wrapper for yyjson_mut_doc with intrusive reference counting
  */
 class RefCountedMutDoc : public RefCounted {
 private:
 	yyjson_mut_doc *doc_;
+	std::unique_ptr<JsonDocStorage> storage_; // released after doc_, which may point into it
+	uint64_t generation_{ NextDocGeneration() };
 
 public:
 	explicit RefCountedMutDoc(yyjson_mut_doc *doc) noexcept : doc_(doc) {}
 
+	RefCountedMutDoc(yyjson_mut_doc *doc, std::unique_ptr<JsonDocStorage> storage) noexcept
+		: doc_(doc), storage_(std::move(storage)) {}
+
 	RefCountedMutDoc(const RefCountedMutDoc &) = delete;
 	RefCountedMutDoc &operator=(const RefCountedMutDoc &) = delete;
 
@@ -149,6 +171,26 @@ public:
 	}
 
 	yyjson_mut_doc *get() const noexcept { return doc_; }
+
+	// Changes whenever a value in the document is modified
+	uint64_t generation() const noexcept { return generation_; }
+	void touch() noexcept { generation_ = layout_ = NextDocGeneration(); }
+
+	// Changes whenever array elements may have been linked in or out other than through their index,
+	// or object keys other than by appending
+	uint64_t layout() const noexcept { return layout_; }
+	void touchValues() noexcept { generation_ = NextDocGeneration(); }
+
+	// Key indexes of large objects in the document, built on their first lookup
+	JsonKeyIndexMap& keyIndexes() noexcept { return keyIndexes_; }
+
+	// Element tables of large arrays in the document, built on their first indexed access
+	JsonArrayIndexMap& arrayIndexes() noexcept { return arrayIndexes_; }
+
+private:
+	uint64_t layout_{ generation_ };
+	JsonKeyIndexMap keyIndexes_;
+	JsonArrayIndexMap arrayIndexes_;
 };
 
 /**
@@ -157,10 +199,15 @@ public:
 class RefCountedImmutableDoc : public RefCounted {
 private:
 	yyjson_doc *doc_;
+	std::unique_ptr<JsonDocStorage> storage_; // released after doc_, which may point into it
+	uint64_t generation_{ NextDocGeneration() };
 
 public:
 	explicit RefCountedImmutableDoc(yyjson_doc *doc) noexcept : doc_(doc) {}
 
+	RefCountedImmutableDoc(yyjson_doc *doc, std::unique_ptr<JsonDocStorage> storage) noexcept
+		: doc_(doc), storage_(std::move(storage)) {}
+
 	RefCountedImmutableDoc(const RefCountedImmutableDoc &) = delete;
 	RefCountedImmutableDoc &operator=(const RefCountedImmutableDoc &) = delete;
 
@@ -171,6 +218,20 @@ public:
 	}
 
 	yyjson_doc *get() const noexcept { return doc_; }
+
+	// Changes whenever a value in the document is modified
+	uint64_t generation() const noexcept { return generation_; }
+	void touch() noexcept { generation_ = NextDocGeneration(); }
+
+	// Key indexes of large objects in the document, built on their first lookup
+	JsonKeyIndexMap& keyIndexes() noexcept { return keyIndexes_; }
+
+	// Element tables of arrays holding containers, built on their first indexed access
+	JsonArrayIndexMap& arrayIndexes() noexcept { return arrayIndexes_; }
+
+private:
+	JsonKeyIndexMap keyIndexes_;
+	JsonArrayIndexMap arrayIndexes_;
 };
 
 /**
@@ -204,6 +265,43 @@ public:
 		return m_pDocument != nullptr;
 	}
 
+	/**
+	 * Record a modification of the underlying document, output cached for it is no longer reused
+	 */
+	void MarkModified() {
+		if (m_pDocument_mut) {
+			m_pDocument_mut->touch();
+		} else if (m_pDocument) {
+			m_pDocument->touch();
+		}
+	}
+
+	/**
+	 * Record a modification that links no array element in or out, so array indexes stay valid
+	 */
+	void MarkValuesModified() {
+		if (m_pDocument_mut) {
+			m_pDocument_mut->touchValues();
+		} else if (m_pDocument) {
+			m_pDocument->touch();
+		}
+	}
+
+	// Changes whenever the underlying document is modified, 0 without a document
+	uint64_t GetDocumentGeneration() const {
+		if (m_pDocument_mut) {
+			return m_pDocument_mut->generation();
+		} else if (m_pDocument) {
+			return m_pDocument->generation();
+		}
+		return 0;
+	}
+
+	// Changes whenever values of the underlying document may have been linked in or out, immutable documents never relink
+	uint64_t GetDocumentLayout() const {
+		return m_pDocument_mut ? m_pDocument_mut->layout() : 0;
+	}
+
 	size_t GetDocumentRefCount() const {
 		if (m_pDocument_mut) {
 			return m_pDocument_mut.use_count();
@@ -229,6 +327,18 @@ public:
 	yyjson_obj_iter m_iterObjImm;
 	yyjson_arr_iter m_iterArrImm;
 
+	// Last object key reached by position, and a table of all keys once access jumps backwards.
+	// Only valid for the object, document layout and object size it was filled at
+	struct KeyPositionCache {
+		void* obj{ nullptr };
+		uint64_t layout{ 0 };
+		size_t size{ 0 };
+		size_t index{ 0 };
+		void* key{ nullptr };
+		std::vector<void*> table;
+	};
+	KeyPositionCache m_keyPos;
+
 	Handle_t m_handle{ BAD_HANDLE };
 	size_t m_arrayIndex{ 0 };
 	size_t m_readSize{ 0 };
@@ -297,6 +407,132 @@ public:
 	bool m_initialized{ false };
 };
 
+/**
+ * @brief Cursor over the values of one document
+ *
+ * The cursor owns a JsonValue for its current position and moves it in place, so walking a document
+ * takes one handle however many values are read. Every move records the value it left, which is
+ * where Parent() returns to.
+ */
+class JsonCursor {
+public:
+	JsonCursor() = default;
+	~JsonCursor() = default;
+
+	JsonCursor(const JsonCursor&) = delete;
+	JsonCursor& operator=(const JsonCursor&) = delete;
+
+	bool IsMutable() const {
+		return m_current.IsMutable();
+	}
+
+	void* GetPosition() const {
+		return m_current.IsMutable() ? static_cast<void*>(m_current.m_pVal_mut) : static_cast<void*>(m_current.m_pVal);
+	}
+
+	// Place the current value, position caches of the previous one no longer apply
+	void MoveTo(void* val) {
+		if (m_current.IsMutable()) {
+			m_current.m_pVal_mut = static_cast<yyjson_mut_val*>(val);
+		} else {
+			m_current.m_pVal = static_cast<yyjson_val*>(val);
+		}
+		m_current.m_keyPos = JsonValue::KeyPositionCache();
+		m_current.ResetArrayIterator();
+	}
+
+	JsonValue m_current;
+	void* m_start{ nullptr };
+	std::vector<void*> m_path;
+
+	Handle_t m_handle{ BAD_HANDLE };
+};
+
+/**
+ * @brief Chunk-fed parser state
+ *
+ * Wraps yyjson_incr_state and the buffer it parses in-situ.
+ * The finished document keeps pointing into m_buf, so the buffer is handed over with it.
+ */
+class JsonStreamParser {
+public:
+	JsonStreamParser() = default;
+	~JsonStreamParser() {
+		Reset();
+	}
+
+	JsonStreamParser(const JsonStreamParser&) = delete;
+	JsonStreamParser& operator=(const JsonStreamParser&) = delete;
+
+	void Reset() {
+		if (m_state) {
+			yyjson_incr_free(m_state);
+			m_state = nullptr;
+		}
+		if (m_doc) {
+			yyjson_doc_free(m_doc);
+			m_doc = nullptr;
+		}
+		free(m_buf);
+		m_buf = nullptr;
+		m_cap = 0;
+		m_len = 0;
+		std::string().swap(m_raw);
+		m_failed = false;
+		m_error[0] = '\0';
+	}
+
+	yyjson_incr_state* m_state{ nullptr };
+	yyjson_doc* m_doc{ nullptr };
+
+	// Parse buffer with YYJSON_PADDING_SIZE bytes after m_cap
+	char* m_buf{ nullptr };
+	size_t m_cap{ 0 };
+	size_t m_len{ 0 };
+
+	// Untouched copy of the input, kept while the total size is unknown so the buffer can be regrown
+	std::string m_raw;
+
+	size_t m_expectedSize{ 0 };
+	yyjson_read_flag m_readFlg{ 0 };
+	bool m_incremental{ true };
+	bool m_failed{ false };
+	char m_error[JSON_ERROR_BUFFER_SIZE]{};
+
+	Handle_t m_handle{ BAD_HANDLE };
+};
+
+/**
+ * @brief JSON Lines file reader state
+ *
+ * Parses one line per document. Byte offsets of every LINES_CHECKPOINT_INTERVAL-th line
+ * are recorded while reading, so seeking back by line number does not restart from the beginning.
+ */
+class JsonLinesReader {
+public:
+	static constexpr size_t LINES_CHECKPOINT_INTERVAL = 4096;
+
+	JsonLinesReader() = default;
+	~JsonLinesReader() = default;
+
+	JsonLinesReader(const JsonLinesReader&) = delete;
+	JsonLinesReader& operator=(const JsonLinesReader&) = delete;
+
+	std::unique_ptr<LineFileReader> m_file;
+	std::vector<uint64_t> m_checkpoints;
+	size_t m_line{ 0 };
+
+	// Pool for immutable documents, reused once the previous document has been released
+	std::shared_ptr<char> m_block;
+	size_t m_blockSize{ 0 };
+
+	yyjson_read_flag m_readFlg{ 0 };
+	bool m_pooled{ false };
+	bool m_eof{ false };
+
+	Handle_t m_handle{ BAD_HANDLE };
+};
+
 class JsonManager : public IJsonManager
 {
 public:
@@ -557,18 +793,278 @@ public:
 	virtual bool ParseInt64Variant(const char* value, std::variant<int64_t, uint64_t>* out_value,
 		char* error = nullptr, size_t error_size = 0) override;
 
+	// ========== Snapshot & Atomic Write Operations ==========
+	virtual JsonValue* CreateSnapshot(JsonValue* handle) override;
+	virtual bool WriteToFileAtomic(JsonValue* handle, const char* path, yyjson_write_flag write_flg,
+		bool sync, char* error, size_t error_size) override;
+
+	// ========== Stream Parser Operations ==========
+	virtual JsonStreamParser* StreamParserCreate(yyjson_read_flag read_flg, size_t expected_size) override;
+	virtual bool StreamParserFeed(JsonStreamParser* parser, const char* data, size_t len,
+		char* error, size_t error_size) override;
+	virtual bool StreamParserIsComplete(JsonStreamParser* parser) override;
+	virtual JsonValue* StreamParserFinish(JsonStreamParser* parser, bool is_mutable,
+		char* error, size_t error_size) override;
+	virtual void ReleaseStreamParser(JsonStreamParser* parser) override;
+	virtual HandleType_t GetStreamParserHandleType() override;
+	virtual JsonStreamParser* GetStreamParserFromHandle(IPluginContext* pContext, Handle_t handle) override;
+
+	// ========== JSON Lines Reader Operations ==========
+	virtual JsonLinesReader* LinesReaderOpen(const char* path, yyjson_read_flag read_flg, size_t buffer_size,
+		bool pooled, char* error, size_t error_size) override;
+	virtual JsonValue* LinesReaderNext(JsonLinesReader* reader, bool is_mutable,
+		char* error, size_t error_size) override;
+	virtual size_t LinesReaderSkip(JsonLinesReader* reader, size_t count) override;
+	virtual bool LinesReaderSeekLine(JsonLinesReader* reader, size_t line) override;
+	virtual bool LinesReaderSeekOffset(JsonLinesReader* reader, uint64_t offset, size_t line) override;
+	virtual size_t LinesReaderGetLine(JsonLinesReader* reader) override;
+	virtual uint64_t LinesReaderGetOffset(JsonLinesReader* reader) override;
+	virtual bool LinesReaderIsEOF(JsonLinesReader* reader) override;
+	virtual void ReleaseLinesReader(JsonLinesReader* reader) override;
+	virtual HandleType_t GetLinesReaderHandleType() override;
+	virtual JsonLinesReader* GetLinesReaderFromHandle(IPluginContext* pContext, Handle_t handle) override;
+
+	// ========== JSON Lines Writer Operations ==========
+	virtual JsonLinesWriter* LinesWriterOpen(const char* path, yyjson_write_flag write_flg, size_t rotate_size,
+		uint32_t rotate_interval, uint32_t flush_interval_ms, size_t buffer_limit,
+		char* error, size_t error_size) override;
+	virtual bool LinesWriterAppend(JsonLinesWriter* writer, JsonValue* handle) override;
+	virtual void LinesWriterFlush(JsonLinesWriter* writer, bool wait) override;
+	virtual uint64_t LinesWriterGetDropped(JsonLinesWriter* writer) override;
+	virtual uint64_t LinesWriterGetWritten(JsonLinesWriter* writer) override;
+	virtual void ReleaseLinesWriter(JsonLinesWriter* writer) override;
+	virtual HandleType_t GetLinesWriterHandleType() override;
+	virtual JsonLinesWriter* GetLinesWriterFromHandle(IPluginContext* pContext, Handle_t handle) override;
+
+	// ========== File Cache Operations ==========
+	virtual void GetFileCacheStats(uint64_t* hits, uint64_t* misses, size_t* entries) override;
+	virtual void ClearFileCache() override;
+
+	// ========== Buffer Write Operations ==========
+	virtual bool WriteToBuffer(JsonValue* handle, char* buffer, size_t buffer_size,
+		uint32_t write_flg, size_t* out_size) override;
+
+	// ========== Write Cache Operations ==========
+	virtual void SetWriteCacheLimit(size_t bytes) override;
+	virtual void GetWriteCacheStats(uint64_t* hits, uint64_t* misses, size_t* entries, size_t* bytes) override;
+	virtual void ClearWriteCache() override;
+
+	// ========== Chunked Write Operations ==========
+	virtual bool WriteChunked(JsonValue* handle, IJsonChunkSink* sink, uint32_t write_flg, size_t chunk_size,
+		char* error, size_t error_size) override;
+	virtual bool WriteToFileChunked(JsonValue* handle, const char* path, uint32_t write_flg, size_t chunk_size,
+		char* error, size_t error_size) override;
+
+	// ========== Binary Format Operations ==========
+	virtual bool WriteBinary(JsonValue* handle, JSON_BINARY_FORMAT format, char* buffer, size_t buffer_size,
+		size_t* out_size, char* error, size_t error_size) override;
+	virtual bool WriteBinaryToFile(JsonValue* handle, JSON_BINARY_FORMAT format, const char* path,
+		char* error, size_t error_size) override;
+	virtual JsonValue* ParseBinary(const void* data, size_t size, JSON_BINARY_FORMAT format, bool is_mutable,
+		char* error, size_t error_size) override;
+	virtual JsonValue* ParseBinaryFile(const char* path, JSON_BINARY_FORMAT format, bool is_mutable,
+		char* error, size_t error_size) override;
+
+	// ========== Snapshot Operations ==========
+	virtual bool SaveSnapshot(JsonValue* handle, const char* path, char* error, size_t error_size) override;
+	virtual JsonValue* LoadSnapshot(const char* path, char* error, size_t error_size) override;
+
+	// ========== Validation Operations ==========
+	virtual bool ValidateJSON(const char* str, uint32_t read_flg, uint8_t* out_type, size_t* out_read_size,
+		size_t* out_error_pos) override;
+
+	// ========== Lazy Pointer Operations ==========
+	virtual JsonValue* PeekPointer(const char* source, bool is_file, const char* pointer, uint32_t read_flg,
+		char* error, size_t error_size) override;
+
+	// ========== Limited Parse Operations ==========
+	virtual JsonValue* ParseJSONLimited(const char* json_str, bool is_file, bool is_mutable, yyjson_read_flag read_flg,
+		const JsonParseLimits& limits, JSON_PARSE_LIMIT* out_exceeded, char* error, size_t error_size) override;
+
+	// ========== Key Index Operations ==========
+	virtual void SetKeyIndexThreshold(size_t min_keys) override;
+	virtual void GetKeyIndexStats(size_t* indexes, size_t* bytes) override;
+
+	// ========== Cursor Operations ==========
+	virtual JsonCursor* CursorCreate(JsonValue* handle) override;
+	virtual bool CursorEnter(JsonCursor* cursor, const char* key) override;
+	virtual bool CursorEnterIndex(JsonCursor* cursor, size_t index) override;
+	virtual bool CursorPointer(JsonCursor* cursor, const char* path) override;
+	virtual bool CursorParent(JsonCursor* cursor) override;
+	virtual void CursorReset(JsonCursor* cursor) override;
+	virtual size_t CursorGetDepth(JsonCursor* cursor) override;
+	virtual JsonValue* CursorGetCurrent(JsonCursor* cursor) override;
+	virtual JsonValue* CursorGetValue(JsonCursor* cursor) override;
+	virtual void ReleaseCursor(JsonCursor* cursor) override;
+	virtual HandleType_t GetCursorHandleType() override;
+	virtual JsonCursor* GetCursorFromHandle(IPluginContext* pContext, Handle_t handle) override;
+
+	// ========== Node Operations ==========
+	virtual bool IsValidNode(JsonValue* handle, int node) override;
+	virtual int NodeChild(JsonValue* handle, int node, const char* key) override;
+	virtual int NodeAt(JsonValue* handle, int node, size_t index) override;
+	virtual int NodeFind(JsonValue* handle, int node, const char* path) override;
+	virtual yyjson_type NodeGetType(JsonValue* handle, int node) override;
+	virtual size_t NodeGetSize(JsonValue* handle, int node) override;
+	virtual bool NodeGetBool(JsonValue* handle, int node, bool* out_value) override;
+	virtual bool NodeGetDouble(JsonValue* handle, int node, double* out_value) override;
+	virtual bool NodeGetInt(JsonValue* handle, int node, int* out_value) override;
+	virtual bool NodeGetInt64(JsonValue* handle, int node, std::variant<int64_t, uint64_t>* out_value) override;
+	virtual bool NodeGetString(JsonValue* handle, int node, const char** out_str, size_t* out_len) override;
+	virtual bool NodeIsNull(JsonValue* handle, int node) override;
+	virtual JsonValue* NodeGetValue(JsonValue* handle, int node) override;
+
 private:
 	std::random_device m_randomDevice;
 	std::mt19937 m_randomGenerator;
 
+	// Scratch allocator for serializing JSON Lines records and buffer writes, game thread only
+	yyjson_alc* m_writeAlc{ nullptr };
+
+	/**
+	 * Serialize a value with the scratch allocator
+	 * @return String to be released with FreeScratch(), or nullptr on error
+	 */
+	char* WriteScratch(JsonValue* handle, yyjson_write_flag write_flg, size_t* len, bool whole_doc = false);
+	void FreeScratch(char* str);
+
+	struct WriteCacheKey {
+		const void* doc;
+		const void* val;
+		uint32_t writeFlg;
+
+		bool operator==(const WriteCacheKey& other) const {
+			return doc == other.doc && val == other.val && writeFlg == other.writeFlg;
+		}
+	};
+
+	struct WriteCacheKeyHash {
+		size_t operator()(const WriteCacheKey& key) const {
+			size_t h = std::hash<const void*>()(key.val);
+			h ^= std::hash<const void*>()(key.doc) + 0x9e3779b9 + (h << 6) + (h >> 2);
+			return h ^ (static_cast<size_t>(key.writeFlg) * 0x9e3779b9);
+		}
+	};
+
+	struct WriteCacheEntry {
+		std::string data;
+		uint64_t generation{ 0 };
+		std::list<WriteCacheKey>::iterator lru;
+	};
+
+	// Serialized output reused until its document generation changes, game thread only
+	std::unordered_map<WriteCacheKey, WriteCacheEntry, WriteCacheKeyHash> m_writeCache;
+	std::list<WriteCacheKey> m_writeCacheLru;
+	std::string m_writeCacheSpill;
+	size_t m_writeCacheBytes{ 0 };
+	size_t m_writeCacheLimit{ 0 };
+	uint64_t m_writeCacheHits{ 0 };
+	uint64_t m_writeCacheMisses{ 0 };
+
+	/**
+	 * Serialize a value through the write cache
+	 * @param whole_doc Serialize the document root instead of the handle value
+	 * @return Serialized output, valid until the next cache call, or nullptr if the cache is disabled or writing failed
+	 */
+	const std::string* WriteCached(JsonValue* handle, yyjson_write_flag write_flg, bool whole_doc = false);
+	void EvictWriteCache(size_t limit);
+
+	// Wrap a decoded binary document, adopted into a mutable document if requested
+	static JsonValue* WrapBinaryDocument(yyjson_doc* idoc, bool is_mutable, char* error, size_t error_size);
+
+	// Write a value, or the whole document it belongs to, gzip compressed
+	static bool WriteGzipFile(const char* realpath, JsonValue* handle, bool whole_doc, uint32_t write_flg,
+		bool sync, char* error, size_t error_size);
+
+	// Scratch blocks for JSON_READ_POOL, one slot per thread, only touched by the owning thread
+	static constexpr size_t POOL_SCRATCH_SLOTS = 64;
+	static constexpr size_t POOL_SCRATCH_MIN = 16 * 1024;
+	static constexpr size_t POOL_SCRATCH_LIMIT = 256 * 1024;
+
+	std::array<ScratchArena, POOL_SCRATCH_SLOTS> m_scratch;
+
+	struct FileCacheEntry {
+		RefPtr<RefCountedImmutableDoc> doc;
+		FileStamp stamp;
+		yyjson_read_flag readFlg{ 0 };
+		uint64_t generation{ 0 }; // of doc when cached, in-place edits no longer match the file
+	};
+
+	// Objects with at least this many keys get a key index once KEY_INDEX_MIN_SCANS lookups scanned them,
+	// 0 disables indexing. Measured on parsed documents: scans of smaller objects stay as fast even for
+	// 100 lookups, and building an index pays off after 10 to 30 lookups whatever the object size
+	static constexpr size_t KEY_INDEX_DEFAULT_THRESHOLD = 64;
+	static constexpr uint32_t KEY_INDEX_MIN_SCANS = 16;
+	size_t m_keyIndexThreshold{ KEY_INDEX_DEFAULT_THRESHOLD };
+
+	// Arrays with at least this many elements get an element table once ARRAY_INDEX_MIN_WALKS accesses past
+	// the first elements walked them. Measured: a table costs 3 to 4 walks to build whatever the array size,
+	// and walks to the first 64 elements take well under the allocation of a table
+	static constexpr size_t ARRAY_INDEX_MIN_SIZE = 64;
+	static constexpr uint32_t ARRAY_INDEX_MIN_WALKS = 4;
+
+	// Key index of a large object, nullptr if the value is not an object or is below the threshold
+	JsonKeyIndex* GetKeyIndex(JsonValue* handle);
+	JsonKeyIndex* GetKeyIndex(RefCountedImmutableDoc& doc, yyjson_val* obj);
+
+	// Key value at a position of an object, through the position cache of the handle
+	static void* ObjectKeyAt(JsonValue* handle, size_t index);
+
+	// Element table of an array, nullptr if the value is not an array or has no current table and
+	// build is false or the array is too small to be worth one
+	static JsonArrayIndex* GetArrayIndex(JsonValue* handle, bool build);
+	static JsonArrayIndex* GetArrayIndex(RefCountedImmutableDoc& doc, yyjson_val* arr, bool build);
+
+	// Array element by position, nullptr if out of range
+	static void* ArrayValueAt(JsonValue* handle, size_t index);
+	static yyjson_val* ArrayValueAt(RefCountedImmutableDoc& doc, yyjson_val* arr, size_t index);
+
+	// Link an element into a mutable array, keeping its index current, handles mark the document
+	// with MarkValuesModified() before calling these
+	static bool ArraySetAt(JsonValue* handle, size_t index, yyjson_mut_val* val);
+	static bool ArrayInsertAt(JsonValue* handle, size_t index, yyjson_mut_val* val);
+	static bool ArrayRemoveAt(JsonValue* handle, size_t index);
+
+	// Value of a node of an immutable handle, nullptr if the node is invalid
+	static yyjson_val* NodeValue(JsonValue* handle, int node);
+
+	// Node of a value below an immutable handle, -1 for nullptr
+	static int NodeOf(JsonValue* handle, yyjson_val* val);
+
+	// Object lookups and updates going through the key index when the object has one
+	yyjson_val* ObjectLookup(JsonValue* handle, const char* key);
+	yyjson_val* ObjectLookup(RefCountedImmutableDoc& doc, yyjson_val* obj, const char* key);
+	yyjson_mut_val* ObjectLookupMut(JsonValue* handle, const char* key);
+	bool ObjectPut(JsonValue* handle, const char* key, yyjson_mut_val* val);
+
+	// Documents shared through JSON_READ_CACHE, keyed by resolved path, game thread only
+	std::unordered_map<std::string, FileCacheEntry> m_fileCache;
+	uint64_t m_fileCacheHits{ 0 };
+	uint64_t m_fileCacheMisses{ 0 };
+
 	// Helper methods
 	static std::unique_ptr<JsonValue> CreateWrapper();
 	static RefPtr<RefCountedMutDoc> WrapDocument(yyjson_mut_doc* doc);
 	static RefPtr<RefCountedMutDoc> CopyDocument(yyjson_doc* doc);
+	static RefPtr<RefCountedMutDoc> AdoptDocument(yyjson_doc* doc, std::unique_ptr<JsonDocStorage> storage);
 	static RefPtr<RefCountedMutDoc> CreateDocument();
-	static RefPtr<RefCountedImmutableDoc> WrapImmutableDocument(yyjson_doc* doc);
+	static RefPtr<RefCountedImmutableDoc> WrapImmutableDocument(yyjson_doc* doc,
+		std::unique_ptr<JsonDocStorage> storage = nullptr);
 	static RefPtr<RefCountedMutDoc> CloneValueToMutable(JsonValue* value);
 
+	// Parse a string, into a pre-sized pool block when JSON_READ_POOL is set
+	yyjson_doc* ReadStringDocument(const char* str, size_t len, yyjson_read_flag read_flg,
+		std::unique_ptr<JsonDocStorage>* out_storage, yyjson_read_err* err, JsonReadBudget* budget = nullptr);
+	ScratchArena* GetScratchArena();
+
+	// Read a file document, shared through m_fileCache when JSON_READ_CACHE is set
+	RefPtr<RefCountedImmutableDoc> ReadFileShared(const char* realpath, yyjson_read_flag read_flg, yyjson_read_err* err,
+		JsonReadBudget* budget = nullptr);
+
+	// ParseJSON with the limits of a budget enforced when it is not null
+	JsonValue* ParseDocument(const char* json_str, bool is_file, bool is_mutable, yyjson_read_flag read_flg,
+		JsonReadBudget* budget, char* error, size_t error_size);
+
 	// Pack helper methods
 	static const char* SkipSeparators(const char* ptr);
 	static yyjson_mut_val* PackImpl(yyjson_mut_doc* doc, const char* format,
@@ -582,6 +1078,13 @@ private:
 		bool success{ false };
 	};
 	static PtrGetValueResult PtrGetValueInternal(JsonValue* handle, const char* path);
+
+	// Stream parser helper methods
+	static bool StreamParserGrow(JsonStreamParser* parser, size_t needed);
+	static bool StreamParserAdvance(JsonStreamParser* parser);
+
+	// JSON Lines reader helper methods
+	static bool LinesReaderReadLine(JsonLinesReader* reader, const char** out_line, size_t* out_len);
 };
 
 #endif // _INCLUDE_JSONMANAGER_H_
\ No newline at end of file
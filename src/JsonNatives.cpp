@@ -1,5 +1,9 @@
 #include "extension.h"
 #include "JsonManager.h"
+#include "JsonAsync.h"
+#include <ICellArray.h>
+#include <algorithm>
+#include <string>
 
 class SourceModPackParamProvider : public IPackParamProvider
 {
@@ -203,7 +207,8 @@ static cell_t json_doc_parse(IPluginContext* pContext, const cell_t* params)
 	uint32_t read_flg = static_cast<uint32_t>(params[4]);
 
 	char error[JSON_ERROR_BUFFER_SIZE];
-	JsonValue* pJSONValue = g_pJsonManager->ParseJSON(str, is_file, is_mutable_doc, read_flg, error, sizeof(error));
+	JsonValue* pJSONValue = g_pJsonManager->ParseJSONLimited(str, is_file, is_mutable_doc, read_flg,
+		g_JsonParseLimits.Get(pContext), nullptr, error, sizeof(error));
 
 	if (!pJSONValue) {
 		return pContext->ThrowNativeError(error);
@@ -212,1194 +217,1355 @@ static cell_t json_doc_parse(IPluginContext* pContext, const cell_t* params)
 	return CreateAndReturnHandle(pContext, pJSONValue, "parsed JSON document");
 }
 
-static cell_t json_doc_equals(IPluginContext* pContext, const cell_t* params)
+/**
+ * Helper function: Read parse limits from four consecutive params
+ * Params: maxBytes, maxDepth, maxValues, maxMemory starting at first_param
+ * @return false with the native error thrown if a limit is negative
+ */
+static bool ReadParseLimits(IPluginContext* pContext, const cell_t* params, int first_param, JsonParseLimits* out)
 {
-	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
-
-	if (!handle1 || !handle2) return 0;
+	for (int i = 0; i < 4; i++) {
+		if (params[first_param + i] < 0) {
+			pContext->ThrowNativeError("Invalid parse limit %d, use 0 for no limit", params[first_param + i]);
+			return false;
+		}
+	}
 
-	return g_pJsonManager->Equals(handle1, handle2);
+	out->maxInputBytes = static_cast<size_t>(params[first_param]);
+	out->maxDepth = static_cast<size_t>(params[first_param + 1]);
+	out->maxValues = static_cast<size_t>(params[first_param + 2]);
+	out->maxMemory = static_cast<size_t>(params[first_param + 3]);
+	return true;
 }
 
-static cell_t json_doc_copy_deep(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_parse_limited(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* targetDoc = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	JsonValue* sourceValue = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
+	char* str;
+	pContext->LocalToString(params[1], &str);
 
-	if (!targetDoc || !sourceValue) return 0;
+	JsonParseLimits limits;
+	if (!ReadParseLimits(pContext, params, 2, &limits)) {
+		return 0;
+	}
 
-	JsonValue* pJSONValue = g_pJsonManager->DeepCopy(targetDoc, sourceValue);
+	bool is_file = params[6];
+	bool is_mutable_doc = params[7];
+	uint32_t read_flg = static_cast<uint32_t>(params[8]);
+
+	JSON_PARSE_LIMIT exceeded;
+	char error[JSON_ERROR_BUFFER_SIZE];
+	JsonValue* pJSONValue = g_pJsonManager->ParseJSONLimited(str, is_file, is_mutable_doc, read_flg,
+		limits, &exceeded, error, sizeof(error));
+
+	cell_t* exceededAddr;
+	pContext->LocalToPhysAddr(params[9], &exceededAddr);
+	*exceededAddr = static_cast<cell_t>(exceeded);
 
+	// Exceeding a limit is an expected outcome for untrusted input, so only invalid JSON throws
 	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Failed to copy JSON value");
+		return exceeded != JSON_LIMIT_NONE ? 0 : pContext->ThrowNativeError(error);
 	}
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "copied JSON value");
+	return CreateAndReturnHandle(pContext, pJSONValue, "parsed JSON document");
 }
 
-static cell_t json_get_type_desc(IPluginContext* pContext, const cell_t* params)
+static cell_t json_set_parse_limits(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonParseLimits limits;
+	if (!ReadParseLimits(pContext, params, 1, &limits)) {
+		return 0;
+	}
 
-	if (!handle) return 0;
+	g_JsonParseLimits.Set(pContext, limits);
+	return 1;
+}
 
-	const char* type_desc = g_pJsonManager->GetTypeDesc(handle);
-	pContext->StringToLocalUTF8(params[2], params[3], type_desc, nullptr);
+/**
+ * Helper function: Parse JSON text or a file with limits and check the type of the root
+ * Used by the FromString and FromFile natives of plugins that set parse limits
+ */
+static JsonValue* ParseRootLimited(const char* str, bool is_file, uint32_t read_flg, const JsonParseLimits& limits,
+	uint8_t type, char* error, size_t error_size)
+{
+	JsonValue* pJSONValue = g_pJsonManager->ParseJSONLimited(str, is_file, false, read_flg, limits, nullptr, error, error_size);
+	if (!pJSONValue || g_pJsonManager->GetType(pJSONValue) == type) {
+		return pJSONValue;
+	}
 
-	return 1;
+	snprintf(error, error_size, "Root value is not %s (got %s)", type == YYJSON_TYPE_OBJ ? "an object" : "an array",
+		g_pJsonManager->GetTypeDesc(pJSONValue));
+	g_pJsonManager->Release(pJSONValue);
+	return nullptr;
 }
 
-static cell_t json_obj_parse_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_validate(IPluginContext* pContext, const cell_t* params)
 {
 	char* str;
 	pContext->LocalToString(params[1], &str);
 	uint32_t read_flg = static_cast<uint32_t>(params[2]);
 
-	char error[JSON_ERROR_BUFFER_SIZE];
-	JsonValue* pJSONValue = g_pJsonManager->ObjectParseString(str, read_flg, error, sizeof(error));
+	uint8_t type;
+	size_t error_pos;
+	size_t read_size;
+	bool is_valid = g_pJsonManager->ValidateJSON(str, read_flg, &type, &read_size, &error_pos);
 
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError(error);
-	}
+	cell_t* typeAddr;
+	cell_t* errorPosAddr;
+	cell_t* readSizeAddr;
+	pContext->LocalToPhysAddr(params[3], &typeAddr);
+	pContext->LocalToPhysAddr(params[4], &errorPosAddr);
+	pContext->LocalToPhysAddr(params[5], &readSizeAddr);
+	*typeAddr = static_cast<cell_t>(type);
+	*errorPosAddr = static_cast<cell_t>(error_pos);
+	*readSizeAddr = static_cast<cell_t>(read_size);
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object from string");
+	return is_valid;
 }
 
-static cell_t json_obj_parse_file(IPluginContext* pContext, const cell_t* params)
+/**
+ * Helper function: Read the value at a pointer from the plugin's JSON text or file
+ * Params: source, is_file, pointer, then the read flags at flag_param
+ * @return Value to be released by the caller, or nullptr with the native error thrown
+ */
+static JsonValue* PeekPointerFromPlugin(IPluginContext* pContext, const cell_t* params, int flag_param)
 {
-	char* path;
-	pContext->LocalToString(params[1], &path);
-	uint32_t read_flg = static_cast<uint32_t>(params[2]);
+	char* source;
+	char* pointer;
+	pContext->LocalToString(params[1], &source);
+	pContext->LocalToString(params[3], &pointer);
+
+	bool is_file = params[2];
+	uint32_t read_flg = static_cast<uint32_t>(params[flag_param]);
 
 	char error[JSON_ERROR_BUFFER_SIZE];
-	JsonValue* pJSONValue = g_pJsonManager->ObjectParseFile(path, read_flg, error, sizeof(error));
+	JsonValue* pJSONValue = g_pJsonManager->PeekPointer(source, is_file, pointer, read_flg, error, sizeof(error));
 
 	if (!pJSONValue) {
-		return pContext->ThrowNativeError(error);
+		pContext->ThrowNativeError("%s", error);
 	}
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object from file");
+	return pJSONValue;
 }
 
-static cell_t json_arr_parse_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_peek_pointer(IPluginContext* pContext, const cell_t* params)
 {
-	char* str;
-	pContext->LocalToString(params[1], &str);
-	uint32_t read_flg = static_cast<uint32_t>(params[2]);
-
-	char error[JSON_ERROR_BUFFER_SIZE];
-	JsonValue* pJSONValue = g_pJsonManager->ArrayParseString(str, read_flg, error, sizeof(error));
+	JsonValue* pJSONValue = PeekPointerFromPlugin(pContext, params, 4);
 
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError(error);
-	}
+	if (!pJSONValue) return 0;
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from string");
+	return CreateAndReturnHandle(pContext, pJSONValue, "peeked JSON value");
 }
 
-static cell_t json_arr_parse_file(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_peek_pointer_bool(IPluginContext* pContext, const cell_t* params)
 {
-	char* path;
-	pContext->LocalToString(params[1], &path);
-	uint32_t read_flg = static_cast<uint32_t>(params[2]);
+	JsonValue* pJSONValue = PeekPointerFromPlugin(pContext, params, 4);
 
-	char error[JSON_ERROR_BUFFER_SIZE];
-	JsonValue* pJSONValue = g_pJsonManager->ArrayParseFile(path, read_flg, error, sizeof(error));
+	if (!pJSONValue) return 0;
 
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError(error);
+	bool value;
+	bool is_success = g_pJsonManager->GetBool(pJSONValue, &value);
+	const char* type_desc = g_pJsonManager->GetTypeDesc(pJSONValue);
+	g_pJsonManager->Release(pJSONValue);
+
+	if (!is_success) {
+		return pContext->ThrowNativeError("Type mismatch: expected boolean value, got %s", type_desc);
 	}
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from file");
+	return value;
 }
 
-static cell_t json_arr_index_of_bool(IPluginContext *pContext, const cell_t *params)
+static cell_t json_doc_peek_pointer_float(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue *handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* pJSONValue = PeekPointerFromPlugin(pContext, params, 4);
 
-	if (!handle) return 0;
-
-	bool searchValue = params[2];
-	return g_pJsonManager->ArrayIndexOfBool(handle, searchValue);
-}
-
-static cell_t json_arr_index_of_str(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!pJSONValue) return 0;
 
-	if (!handle) return 0;
+	double value;
+	bool is_success = g_pJsonManager->GetDouble(pJSONValue, &value);
+	const char* type_desc = g_pJsonManager->GetTypeDesc(pJSONValue);
+	g_pJsonManager->Release(pJSONValue);
 
-	char* searchStr;
-	pContext->LocalToString(params[2], &searchStr);
+	if (!is_success) {
+		return pContext->ThrowNativeError("Type mismatch: expected float value, got %s", type_desc);
+	}
 
-	return g_pJsonManager->ArrayIndexOfString(handle, searchStr);
+	return sp_ftoc(static_cast<float>(value));
 }
 
-static cell_t json_arr_index_of_int(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_peek_pointer_int(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* pJSONValue = PeekPointerFromPlugin(pContext, params, 4);
 
-	if (!handle) return 0;
+	if (!pJSONValue) return 0;
 
-	int searchValue = params[2];
-	return g_pJsonManager->ArrayIndexOfInt(handle, searchValue);
+	int value;
+	bool is_success = g_pJsonManager->GetInt(pJSONValue, &value);
+	const char* type_desc = g_pJsonManager->GetTypeDesc(pJSONValue);
+	g_pJsonManager->Release(pJSONValue);
+
+	if (!is_success) {
+		return pContext->ThrowNativeError("Type mismatch: expected integer value, got %s", type_desc);
+	}
+
+	return value;
 }
 
-static cell_t json_arr_index_of_integer64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_peek_pointer_integer64(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* pJSONValue = PeekPointerFromPlugin(pContext, params, 6);
 
-	if (!handle) return 0;
+	if (!pJSONValue) return 0;
 
-	char* searchStr;
-	pContext->LocalToString(params[2], &searchStr);
+	std::variant<int64_t, uint64_t> value;
+	bool is_success = g_pJsonManager->GetInt64(pJSONValue, &value);
+	const char* type_desc = g_pJsonManager->GetTypeDesc(pJSONValue);
+	g_pJsonManager->Release(pJSONValue);
 
-	std::variant<int64_t, uint64_t> variant_value;
-	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!is_success) {
+		return pContext->ThrowNativeError("Type mismatch: expected integer64 value, got %s", type_desc);
+	}
 
-	if (!g_pJsonManager->ParseInt64Variant(searchStr, &variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	char result[JSON_INT64_BUFFER_SIZE];
+	if (!Int64VariantToString(value, result, sizeof(result))) {
+		return pContext->ThrowNativeError("Failed to convert integer64 to string");
 	}
+	pContext->StringToLocalUTF8(params[4], params[5], result, nullptr);
 
-	return g_pJsonManager->ArrayIndexOfInt64(handle, variant_value);
+	return 1;
 }
 
-static cell_t json_arr_index_of_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_peek_pointer_str(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* pJSONValue = PeekPointerFromPlugin(pContext, params, 6);
 
-	if (!handle) return 0;
+	if (!pJSONValue) return 0;
 
-	return g_pJsonManager->ArrayIndexOfDouble(handle, sp_ctof(params[2]));
-}
+	const char* str;
+	size_t len;
+	if (!g_pJsonManager->GetString(pJSONValue, &str, &len)) {
+		const char* type_desc = g_pJsonManager->GetTypeDesc(pJSONValue);
+		g_pJsonManager->Release(pJSONValue);
+		return pContext->ThrowNativeError("Type mismatch: expected string value, got %s", type_desc);
+	}
 
-static cell_t json_get_type(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	size_t maxlen = static_cast<size_t>(params[5]);
+	if (len + 1 > maxlen) {
+		g_pJsonManager->Release(pJSONValue);
+		return pContext->ThrowNativeError("Buffer is too small (need %d, have %d)", len + 1, maxlen);
+	}
 
-	if (!handle) return 0;
+	pContext->StringToLocalUTF8(params[4], maxlen, str, nullptr);
+	g_pJsonManager->Release(pJSONValue);
 
-	return g_pJsonManager->GetType(handle);
+	return 1;
 }
 
-static cell_t json_get_subtype(IPluginContext* pContext, const cell_t* params)
+/**
+ * Helper function: Hand a document produced by an async task over to the plugin
+ * @return Handle, or BAD_HANDLE with the error set. The document is released by the caller on failure
+ */
+static Handle_t CreateAsyncResultHandle(IPluginContext* pContext, JsonValue*& pJSONValue, const char* error_context, char* error, size_t error_size)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!pJSONValue) {
+		return BAD_HANDLE;
+	}
 
-	if (!handle) return 0;
+	HandleError err;
+	HandleSecurity sec(pContext->GetIdentity(), myself->GetIdentity());
+	Handle_t handle = handlesys->CreateHandleEx(g_JsonType, pJSONValue, &sec, nullptr, &err);
 
-	return g_pJsonManager->GetSubtype(handle);
+	if (!handle) {
+		snprintf(error, error_size, "Failed to create handle for %s (error code: %d)", error_context, err);
+		return BAD_HANDLE;
+	}
+
+	pJSONValue->m_handle = handle;
+	pJSONValue = nullptr;
+	return handle;
 }
 
-static cell_t json_is_array(IPluginContext* pContext, const cell_t* params)
+/**
+ * Async task: parse a JSON file on the worker thread and pass the document to a plugin callback
+ */
+class JsonParseFileTask : public JsonAsyncTask
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+public:
+	// The file cache is not thread-safe, so worker threads always read the file
+	JsonParseFileTask(const char* path, uint32_t read_flg, bool is_mutable, const JsonParseLimits& limits,
+		funcid_t callback, cell_t data)
+		: m_path(path), m_readFlg(read_flg & ~JSON_READ_CACHE), m_isMutable(is_mutable), m_limits(limits),
+		  m_callback(callback), m_data(data) {}
+
+	~JsonParseFileTask() override
+	{
+		if (m_pJSONValue) {
+			g_pJsonManager->Release(m_pJSONValue);
+		}
+	}
 
-	if (!handle) return 0;
+	void Run() override
+	{
+		m_pJSONValue = g_pJsonManager->ParseJSONLimited(m_path.c_str(), true, m_isMutable, m_readFlg, m_limits,
+			nullptr, m_error, sizeof(m_error));
+	}
 
-	return g_pJsonManager->IsArray(handle);
-}
+	void Complete(IPluginContext* pContext) override
+	{
+		IPluginFunction* callback = pContext->GetFunctionById(m_callback);
+		if (!callback) {
+			return;
+		}
 
-static cell_t json_is_object(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+		Handle_t handle = CreateAsyncResultHandle(pContext, m_pJSONValue, "parsed JSON document", m_error, sizeof(m_error));
 
-	if (!handle) return 0;
+		callback->PushCell(handle);
+		callback->PushString(m_error);
+		callback->PushCell(m_data);
+		callback->Execute(nullptr);
+	}
 
-	return g_pJsonManager->IsObject(handle);
-}
+private:
+	std::string m_path;
+	uint32_t m_readFlg;
+	bool m_isMutable;
+	JsonParseLimits m_limits;  // Copied on the game thread, the registry is not thread-safe
+	funcid_t m_callback;
+	cell_t m_data;
+	JsonValue* m_pJSONValue{ nullptr };
+	char m_error[JSON_ERROR_BUFFER_SIZE]{};
+};
 
-static cell_t json_is_int(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_parse_file_async(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	char* path;
+	pContext->LocalToString(params[1], &path);
 
-	if (!handle) return 0;
+	if (!pContext->GetFunctionById(params[2])) {
+		return pContext->ThrowNativeError("Invalid parse callback function %x", params[2]);
+	}
 
-	return g_pJsonManager->IsInt(handle);
-}
+	uint32_t read_flg = static_cast<uint32_t>(params[3]);
+	bool is_mutable_doc = params[4];
 
-static cell_t json_is_uint(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	auto task = std::make_unique<JsonParseFileTask>(path, read_flg, is_mutable_doc, g_JsonParseLimits.Get(pContext),
+		params[2], params[5]);
+	task->m_pContext = pContext;
 
-	if (!handle) return 0;
+	if (!g_JsonAsync.Submit(std::move(task))) {
+		return pContext->ThrowNativeError("Failed to queue async parse for JSON file: %s", path);
+	}
 
-	return g_pJsonManager->IsUint(handle);
+	return true;
 }
 
-static cell_t json_is_sint(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+/**
+ * Shared state of one LoadManyAsync or LoadDirectoryAsync call
+ *
+ * Each file is parsed by its own unordered task on a worker thread. The last task delivered builds
+ * the result objects on the game thread, which owns the manager state they use, and calls the plugin callback.
+ */
+struct JsonBulkLoad
+{
+	struct Entry
+	{
+		std::string key;   // Path reported to the plugin
+		std::string path;  // Path passed to ParseJSON
+		JsonValue* value{ nullptr };
+		bool failed{ false };
+		char error[JSON_ERROR_BUFFER_SIZE]{};
+	};
+
+	~JsonBulkLoad()
+	{
+		for (auto& entry : entries) {
+			if (entry.value) {
+				g_pJsonManager->Release(entry.value);
+			}
+		}
+		if (results) {
+			g_pJsonManager->Release(results);
+		}
+		if (errors) {
+			g_pJsonManager->Release(errors);
+		}
+	}
 
-	if (!handle) return 0;
+	// Collect the parsed documents into one object keyed by path, and the failures into another
+	void Merge()
+	{
+		errors = g_pJsonManager->ObjectInit();
+		if (fileCallback == nullptr) {
+			results = g_pJsonManager->ObjectInit();
+		}
 
-	return g_pJsonManager->IsSint(handle);
-}
+		for (auto& entry : entries) {
+			if (entry.failed) {
+				if (errors) {
+					g_pJsonManager->ObjectSetString(errors, entry.key.c_str(), entry.error);
+				}
+			} else if (results) {
+				g_pJsonManager->ObjectSet(results, entry.key.c_str(), entry.value);
+				g_pJsonManager->Release(entry.value);
+				entry.value = nullptr;
+			}
+		}
 
-static cell_t json_is_num(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+		if (results && !isMutable) {
+			JsonValue* immutable = g_pJsonManager->ToImmutable(results);
+			if (immutable) {
+				g_pJsonManager->Release(results);
+				results = immutable;
+			}
+		}
+	}
 
-	if (!handle) return 0;
+	std::vector<Entry> entries;
+	uint32_t readFlg{ 0 };
+	bool isMutable{ false };
+	JsonParseLimits limits;
+	IPluginFunction* fileCallback{ nullptr };
+	funcid_t callback{ 0 };
+	cell_t data{ 0 };
 
-	return g_pJsonManager->IsNum(handle);
-}
+	size_t remainingDeliveries{ 0 };  // Game thread only
+	JsonValue* results{ nullptr };
+	JsonValue* errors{ nullptr };
+};
 
-static cell_t json_is_bool(IPluginContext* pContext, const cell_t* params)
+/**
+ * Async task: parse one file of a bulk load on any worker thread
+ */
+class JsonBulkLoadTask : public JsonAsyncTask
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+public:
+	JsonBulkLoadTask(std::shared_ptr<JsonBulkLoad> batch, size_t index)
+		: m_batch(std::move(batch)), m_index(index)
+	{
+		m_ordered = false;
+	}
+
+	void Run() override
+	{
+		JsonBulkLoad& batch = *m_batch;
+
+		// A load without files still runs one task, so the callback is always invoked
+		if (m_index < batch.entries.size()) {
+			JsonBulkLoad::Entry& entry = batch.entries[m_index];
+			// Documents that are merged into the result object are copied anyway, so they are parsed immutable
+			bool is_mutable = batch.fileCallback && batch.isMutable;
+			entry.value = g_pJsonManager->ParseJSONLimited(entry.path.c_str(), true, is_mutable, batch.readFlg, batch.limits,
+				nullptr, entry.error, sizeof(entry.error));
+			entry.failed = !entry.value;
+		}
+	}
 
-	if (!handle) return 0;
+	void Complete(IPluginContext* pContext) override
+	{
+		JsonBulkLoad& batch = *m_batch;
 
-	return g_pJsonManager->IsBool(handle);
-}
+		if (batch.fileCallback && m_index < batch.entries.size()) {
+			JsonBulkLoad::Entry& entry = batch.entries[m_index];
+			Handle_t handle = CreateAsyncResultHandle(pContext, entry.value, "loaded JSON document", entry.error, sizeof(entry.error));
 
-static cell_t json_is_true(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+			batch.fileCallback->PushString(entry.key.c_str());
+			batch.fileCallback->PushCell(handle);
+			batch.fileCallback->PushString(entry.error);
+			batch.fileCallback->PushCell(batch.data);
+			batch.fileCallback->Execute(nullptr);
+		}
 
-	if (!handle) return 0;
+		if (--batch.remainingDeliveries > 0) {
+			return;
+		}
 
-	return g_pJsonManager->IsTrue(handle);
-}
+		IPluginFunction* callback = pContext->GetFunctionById(batch.callback);
+		if (!callback) {
+			return;
+		}
 
-static cell_t json_is_false(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+		// Every file has been parsed and delivered by now
+		batch.Merge();
 
-	if (!handle) return 0;
+		char error[JSON_ERROR_BUFFER_SIZE];
+		Handle_t results = CreateAsyncResultHandle(pContext, batch.results, "bulk load results", error, sizeof(error));
+		Handle_t errors = CreateAsyncResultHandle(pContext, batch.errors, "bulk load errors", error, sizeof(error));
 
-	return g_pJsonManager->IsFalse(handle);
-}
+		callback->PushCell(results);
+		callback->PushCell(errors);
+		callback->PushCell(batch.data);
+		callback->Execute(nullptr);
+	}
 
-static cell_t json_is_float(IPluginContext* pContext, const cell_t* params)
+private:
+	std::shared_ptr<JsonBulkLoad> m_batch;
+	size_t m_index;
+};
+
+/**
+ * Helper function: Validate the callbacks of a bulk load and queue one task per file
+ */
+static cell_t SubmitBulkLoad(IPluginContext* pContext, std::shared_ptr<JsonBulkLoad> batch,
+	cell_t callback, cell_t file_callback, uint32_t read_flg, bool is_mutable_doc, cell_t data)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	IPluginFunction* fileCallback = pContext->GetFunctionById(file_callback);
 
-	if (!handle) return 0;
+	if (!pContext->GetFunctionById(callback) && !fileCallback) {
+		return pContext->ThrowNativeError("Invalid load callback function %x", callback);
+	}
 
-	return g_pJsonManager->IsFloat(handle);
-}
+	batch->readFlg = read_flg & ~JSON_READ_CACHE;  // The file cache is game thread only
+	batch->isMutable = is_mutable_doc;
+	batch->limits = g_JsonParseLimits.Get(pContext);
+	batch->fileCallback = fileCallback;
+	batch->callback = callback;
+	batch->data = data;
 
-static cell_t json_is_str(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	size_t count = std::max<size_t>(batch->entries.size(), 1);
+	batch->remainingDeliveries = count;
 
-	if (!handle) return 0;
+	for (size_t i = 0; i < count; i++) {
+		auto task = std::make_unique<JsonBulkLoadTask>(batch, i);
+		task->m_pContext = pContext;
 
-	return g_pJsonManager->IsStr(handle);
+		if (!g_JsonAsync.Submit(std::move(task))) {
+			return pContext->ThrowNativeError("Failed to queue async load of %zu JSON files", batch->entries.size());
+		}
+	}
+
+	return static_cast<cell_t>(batch->entries.size());
 }
 
-static cell_t json_is_null(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_load_many_async(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
-	if (!handle) return 0;
+	if (!g_CellArrayType) {
+		return pContext->ThrowNativeError("ArrayList handle type is not available");
+	}
 
-	return g_pJsonManager->IsNull(handle);
-}
+	ICellArray* array;
+	HandleError err;
+	HandleSecurity sec(pContext->GetIdentity(), myself->GetIdentity());
+	if ((err = handlesys->ReadHandle(params[1], g_CellArrayType, &sec, (void**)&array)) != HandleError_None) {
+		return pContext->ThrowNativeError("Invalid ArrayList handle %x (error %d)", params[1], err);
+	}
 
-static cell_t json_is_ctn(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	auto batch = std::make_shared<JsonBulkLoad>();
+	size_t max_len = array->blocksize() * sizeof(cell_t);
+	batch->entries.resize(array->size());
 
-	if (!handle) return 0;
+	for (size_t i = 0; i < array->size(); i++) {
+		const char* path = reinterpret_cast<const char*>(array->at(i));
+		batch->entries[i].key.assign(path, strnlen(path, max_len));
+		batch->entries[i].path = batch->entries[i].key;
+	}
 
-	return g_pJsonManager->IsCtn(handle);
+	return SubmitBulkLoad(pContext, std::move(batch), params[2], params[6], static_cast<uint32_t>(params[3]), params[4], params[5]);
 }
 
-static cell_t json_is_mutable(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+/**
+ * Helper function: Match a file name against a pattern with * and ? wildcards
+ */
+static bool MatchWildcard(const char* pattern, const char* name)
+{
+	const char* star = nullptr;
+	const char* resume = nullptr;
+
+	while (*name) {
+		if (*pattern == '*') {
+			star = pattern++;
+			resume = name;
+		} else if (*pattern == '?' || *pattern == *name) {
+			pattern++;
+			name++;
+		} else if (star) {
+			pattern = star + 1;
+			name = ++resume;
+		} else {
+			return false;
+		}
+	}
 
-	if (!handle) return 0;
+	while (*pattern == '*') {
+		pattern++;
+	}
 
-	return g_pJsonManager->IsMutable(handle);
+	return *pattern == '\0';
 }
 
-static cell_t json_is_immutable(IPluginContext* pContext, const cell_t* params)
+/**
+ * Helper function: Add the files of a directory matching a pattern, relative to the load root
+ */
+static bool CollectDirectoryFiles(const char* root, const std::string& relative, const char* pattern, bool recursive, std::vector<JsonBulkLoad::Entry>& entries)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	char realpath[PLATFORM_MAX_PATH];
+	smutils->BuildPath(Path_Game, realpath, sizeof(realpath), "%s/%s", root, relative.c_str());
 
-	if (!handle) return 0;
+	IDirectory* dir = libsys->OpenDirectory(realpath);
+	if (!dir) {
+		return false;
+	}
 
-	return g_pJsonManager->IsImmutable(handle);
-}
+	std::vector<std::string> subdirs;
+	for (; dir->MoreFiles(); dir->NextEntry()) {
+		const char* name = dir->GetEntryName();
+		if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0) {
+			continue;
+		}
 
-static cell_t json_obj_init(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* pJSONValue = g_pJsonManager->ObjectInit();
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object");
+		std::string key = relative.empty() ? name : relative + "/" + name;
+		if (dir->IsEntryDirectory()) {
+			if (recursive) {
+				subdirs.push_back(std::move(key));
+			}
+		} else if (dir->IsEntryFile() && MatchWildcard(pattern, name)) {
+			JsonBulkLoad::Entry entry;
+			entry.path = std::string(root) + "/" + key;
+			entry.key = std::move(key);
+			entries.push_back(std::move(entry));
+		}
+	}
+	libsys->CloseDirectory(dir);
+
+	for (const auto& subdir : subdirs) {
+		CollectDirectoryFiles(root, subdir, pattern, recursive, entries);
+	}
+
+	return true;
 }
 
-static cell_t json_obj_init_with_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_load_directory_async(IPluginContext* pContext, const cell_t* params)
 {
-	cell_t* addr;
-	pContext->LocalToPhysAddr(params[1], &addr);
-	cell_t array_size = params[2];
+	char* dir;
+	char* pattern;
+	pContext->LocalToString(params[1], &dir);
+	pContext->LocalToString(params[2], &pattern);
 
-	if (array_size < 2) {
-		return pContext->ThrowNativeError("Array must contain at least one key-value pair");
+	std::string root(dir);
+	while (!root.empty() && (root.back() == '/' || root.back() == '\\')) {
+		root.pop_back();
 	}
-	if (array_size % 2 != 0) {
-		return pContext->ThrowNativeError("Array must contain an even number of strings (got %d)", array_size);
+
+	auto batch = std::make_shared<JsonBulkLoad>();
+	if (!CollectDirectoryFiles(root.c_str(), std::string(), pattern[0] ? pattern : "*", params[8], batch->entries)) {
+		return pContext->ThrowNativeError("Failed to open directory: %s", dir);
 	}
 
-	std::vector<const char*> kv_pairs;
-	kv_pairs.reserve(array_size);
+	return SubmitBulkLoad(pContext, std::move(batch), params[3], params[7], static_cast<uint32_t>(params[4]), params[5], params[6]);
+}
 
-	for (cell_t i = 0; i < array_size; i += 2) {
-		char* key;
-		char* value;
+static cell_t json_doc_equals(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
 
-		if (pContext->LocalToString(addr[i], &key) != SP_ERROR_NONE) {
-			return pContext->ThrowNativeError("Failed to read key at index %d", i);
-		}
-		if (!key || !key[0]) {
-			return pContext->ThrowNativeError("Empty key at index %d", i);
-		}
+	if (!handle1 || !handle2) return 0;
 
-		if (pContext->LocalToString(addr[i + 1], &value) != SP_ERROR_NONE) {
-			return pContext->ThrowNativeError("Failed to read value at index %d", i + 1);
-		}
-		if (!value) {
-			return pContext->ThrowNativeError("Invalid value at index %d", i + 1);
-		}
+	return g_pJsonManager->Equals(handle1, handle2);
+}
 
-		kv_pairs.push_back(key);
-		kv_pairs.push_back(value);
-	}
+static cell_t json_doc_copy_deep(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* targetDoc = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* sourceValue = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
 
-	JsonValue* pJSONValue = g_pJsonManager->ObjectInitWithStrings(kv_pairs.data(), array_size / 2);
+	if (!targetDoc || !sourceValue) return 0;
+
+	JsonValue* pJSONValue = g_pJsonManager->DeepCopy(targetDoc, sourceValue);
 
 	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Failed to create JSON object from key-value pairs");
+		return pContext->ThrowNativeError("Failed to copy JSON value");
 	}
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object from key-value pairs");
+	return CreateAndReturnHandle(pContext, pJSONValue, "copied JSON value");
 }
 
-static cell_t json_create_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_get_type_desc(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* pJSONValue = g_pJsonManager->CreateBool(params[1]);
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON boolean value");
-}
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
-static cell_t json_create_float(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* pJSONValue = g_pJsonManager->CreateDouble(sp_ctof(params[1]));
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON float value");
-}
+	if (!handle) return 0;
 
-static cell_t json_create_int(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* pJSONValue = g_pJsonManager->CreateInt(params[1]);
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON integer value");
+	const char* type_desc = g_pJsonManager->GetTypeDesc(handle);
+	pContext->StringToLocalUTF8(params[2], params[3], type_desc, nullptr);
+
+	return 1;
 }
 
-static cell_t json_create_integer64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_parse_str(IPluginContext* pContext, const cell_t* params)
 {
-	char* value;
-	pContext->LocalToString(params[1], &value);
+	char* str;
+	pContext->LocalToString(params[1], &str);
+	uint32_t read_flg = static_cast<uint32_t>(params[2]);
 
-	std::variant<int64_t, uint64_t> variant_value;
 	char error[JSON_ERROR_BUFFER_SIZE];
+	const JsonParseLimits& limits = g_JsonParseLimits.Get(pContext);
+	JsonValue* pJSONValue = limits.IsUnlimited()
+		? g_pJsonManager->ObjectParseString(str, read_flg, error, sizeof(error))
+		: ParseRootLimited(str, false, read_flg, limits, YYJSON_TYPE_OBJ, error, sizeof(error));
 
-	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError(error);
 	}
 
-	JsonValue* pJSONValue = g_pJsonManager->CreateInt64(variant_value);
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object from string");
+}
+
+static cell_t json_obj_parse_file(IPluginContext* pContext, const cell_t* params)
+{
+	char* path;
+	pContext->LocalToString(params[1], &path);
+	uint32_t read_flg = static_cast<uint32_t>(params[2]);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	const JsonParseLimits& limits = g_JsonParseLimits.Get(pContext);
+	JsonValue* pJSONValue = limits.IsUnlimited()
+		? g_pJsonManager->ObjectParseFile(path, read_flg, error, sizeof(error))
+		: ParseRootLimited(path, true, read_flg, limits, YYJSON_TYPE_OBJ, error, sizeof(error));
 
 	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Failed to create JSON integer64 value");
+		return pContext->ThrowNativeError(error);
 	}
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON integer64 value");
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object from file");
 }
 
-static cell_t json_create_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_parse_str(IPluginContext* pContext, const cell_t* params)
 {
 	char* str;
 	pContext->LocalToString(params[1], &str);
+	uint32_t read_flg = static_cast<uint32_t>(params[2]);
 
-	JsonValue* pJSONValue = g_pJsonManager->CreateString(str);
+	char error[JSON_ERROR_BUFFER_SIZE];
+	const JsonParseLimits& limits = g_JsonParseLimits.Get(pContext);
+	JsonValue* pJSONValue = limits.IsUnlimited()
+		? g_pJsonManager->ArrayParseString(str, read_flg, error, sizeof(error))
+		: ParseRootLimited(str, false, read_flg, limits, YYJSON_TYPE_ARR, error, sizeof(error));
 
 	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Failed to create JSON string value");
+		return pContext->ThrowNativeError(error);
 	}
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON string value");
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from string");
 }
 
-static cell_t json_get_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_parse_file(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	char* path;
+	pContext->LocalToString(params[1], &path);
+	uint32_t read_flg = static_cast<uint32_t>(params[2]);
 
-	if (!handle) return 0;
+	char error[JSON_ERROR_BUFFER_SIZE];
+	const JsonParseLimits& limits = g_JsonParseLimits.Get(pContext);
+	JsonValue* pJSONValue = limits.IsUnlimited()
+		? g_pJsonManager->ArrayParseFile(path, read_flg, error, sizeof(error))
+		: ParseRootLimited(path, true, read_flg, limits, YYJSON_TYPE_ARR, error, sizeof(error));
 
-	bool value;
-	if (!g_pJsonManager->GetBool(handle, &value)) {
-		return pContext->ThrowNativeError("Type mismatch: expected boolean value");
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError(error);
 	}
 
-	return value;
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from file");
 }
 
-static cell_t json_get_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_index_of_bool(IPluginContext *pContext, const cell_t *params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue *handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	double value;
-	if (!g_pJsonManager->GetDouble(handle, &value)) {
-		return pContext->ThrowNativeError("Type mismatch: expected float value");
-	}
-
-	return sp_ftoc(static_cast<float>(value));
+	bool searchValue = params[2];
+	return g_pJsonManager->ArrayIndexOfBool(handle, searchValue);
 }
 
-static cell_t json_get_int(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_index_of_str(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	int value;
-	if (!g_pJsonManager->GetInt(handle, &value)) {
-		return pContext->ThrowNativeError("Type mismatch: expected integer value");
-	}
+	char* searchStr;
+	pContext->LocalToString(params[2], &searchStr);
 
-	return value;
+	return g_pJsonManager->ArrayIndexOfString(handle, searchStr);
 }
 
-static cell_t json_get_integer64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_index_of_int(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	std::variant<int64_t, uint64_t> value;
-	if (!g_pJsonManager->GetInt64(handle, &value)) {
-		return pContext->ThrowNativeError("Type mismatch: expected integer64 value");
-	}
-
-	char result[JSON_INT64_BUFFER_SIZE];
-	if (!Int64VariantToString(value, result, sizeof(result))) {
-		return pContext->ThrowNativeError("Failed to convert integer64 to string");
-	}
-	pContext->StringToLocalUTF8(params[2], params[3], result, nullptr);
-
-	return 1;
+	int searchValue = params[2];
+	return g_pJsonManager->ArrayIndexOfInt(handle, searchValue);
 }
 
-static cell_t json_get_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_index_of_integer64(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	const char* str;
-	size_t len;
-
-	if (!g_pJsonManager->GetString(handle, &str, &len)) {
-		return pContext->ThrowNativeError("Type mismatch: expected string value");
-	}
+	char* searchStr;
+	pContext->LocalToString(params[2], &searchStr);
 
-	size_t maxlen = static_cast<size_t>(params[3]);
+	std::variant<int64_t, uint64_t> variant_value;
+	char error[JSON_ERROR_BUFFER_SIZE];
 
-	if (len + 1 > maxlen) {
-		return pContext->ThrowNativeError("Buffer is too small (need %d, have %d)", len + 1, maxlen);
+	if (!g_pJsonManager->ParseInt64Variant(searchStr, &variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
 	}
 
-	pContext->StringToLocalUTF8(params[2], maxlen, str, nullptr);
-
-	return 1;
+	return g_pJsonManager->ArrayIndexOfInt64(handle, variant_value);
 }
 
-static cell_t json_equals_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_index_of_float(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
 
-	char* str;
-	pContext->LocalToString(params[2], &str);
+	if (!handle) return 0;
 
-	return g_pJsonManager->EqualsStr(handle, str);
+	return g_pJsonManager->ArrayIndexOfDouble(handle, sp_ctof(params[2]));
 }
 
-static cell_t json_get_serialized_size(IPluginContext* pContext, const cell_t* params)
+static cell_t json_get_type(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	uint32_t write_flg = static_cast<uint32_t>(params[2]);
-	size_t size = g_pJsonManager->GetSerializedSize(handle, write_flg);
-
-	return static_cast<cell_t>(size);
+	return g_pJsonManager->GetType(handle);
 }
 
-static cell_t json_get_read_size(IPluginContext* pContext, const cell_t* params)
+static cell_t json_get_subtype(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	size_t size = g_pJsonManager->GetReadSize(handle);
-	if (size == 0) return 0;
-
-	return static_cast<cell_t>(size);
+	return g_pJsonManager->GetSubtype(handle);
 }
 
-static cell_t json_get_ref_count(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_array(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	return g_pJsonManager->GetRefCount(handle);
+	return g_pJsonManager->IsArray(handle);
 }
 
-static cell_t json_get_val_count(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_object(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	return g_pJsonManager->GetValCount(handle);
-}
-
-static cell_t json_create_null(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* pJSONValue = g_pJsonManager->CreateNull();
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON null value");
-}
-
-static cell_t json_arr_init(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* pJSONValue = g_pJsonManager->ArrayInit();
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array");
+	return g_pJsonManager->IsObject(handle);
 }
 
-static cell_t json_arr_init_with_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_int(IPluginContext* pContext, const cell_t* params)
 {
-	cell_t* addr;
-	pContext->LocalToPhysAddr(params[1], &addr);
-	cell_t array_size = params[2];
-
-	std::vector<const char*> strs;
-	strs.reserve(array_size);
-
-	for (cell_t i = 0; i < array_size; i++) {
-		char* str;
-		pContext->LocalToString(addr[i], &str);
-		strs.push_back(str);
-	}
-
-	JsonValue* pJSONValue = g_pJsonManager->ArrayInitWithStrings(strs.data(), strs.size());
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Failed to create JSON array from strings");
-	}
+	if (!handle) return 0;
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from strings");
+	return g_pJsonManager->IsInt(handle);
 }
 
-static cell_t json_arr_init_with_int32(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_uint(IPluginContext* pContext, const cell_t* params)
 {
-	cell_t* addr;
-	pContext->LocalToPhysAddr(params[1], &addr);
-	cell_t array_size = params[2];
-
-	std::vector<int32_t> values;
-	values.reserve(array_size);
-
-	for (cell_t i = 0; i < array_size; i++) {
-		values.push_back(static_cast<int32_t>(addr[i]));
-	}
-
-	JsonValue* pJSONValue = g_pJsonManager->ArrayInitWithInt32(values.data(), values.size());
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Failed to create JSON array from int32 values");
-	}
+	if (!handle) return 0;
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from int32 values");
+	return g_pJsonManager->IsUint(handle);
 }
 
-static cell_t json_arr_init_with_int64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_sint(IPluginContext* pContext, const cell_t* params)
 {
-	cell_t* addr;
-	pContext->LocalToPhysAddr(params[1], &addr);
-	cell_t array_size = params[2];
-
-	std::vector<const char*> strs;
-	strs.reserve(array_size);
-
-	for (cell_t i = 0; i < array_size; i++) {
-		char* str;
-		pContext->LocalToString(addr[i], &str);
-		strs.push_back(str);
-	}
-
-	char error[JSON_ERROR_BUFFER_SIZE];
-	JsonValue* pJSONValue = g_pJsonManager->ArrayInitWithInt64(strs.data(), strs.size(), error, sizeof(error));
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Failed to create JSON array from int64 values: %s", error);
-	}
+	if (!handle) return 0;
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from int64 values");
+	return g_pJsonManager->IsSint(handle);
 }
 
-static cell_t json_arr_init_with_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_num(IPluginContext* pContext, const cell_t* params)
 {
-	cell_t* addr;
-	pContext->LocalToPhysAddr(params[1], &addr);
-	cell_t array_size = params[2];
-
-	// std::vector<bool> is specialized and doesn't work with .data() so we use a unique_ptr
-	auto values = std::make_unique<bool[]>(array_size);
-
-	for (cell_t i = 0; i < array_size; i++) {
-		values[i] = (addr[i] != 0);
-	}
-
-	JsonValue* pJSONValue = g_pJsonManager->ArrayInitWithBool(values.get(), array_size);
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Failed to create JSON array from bool values");
-	}
+	if (!handle) return 0;
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from bool values");
+	return g_pJsonManager->IsNum(handle);
 }
 
-static cell_t json_arr_init_with_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_bool(IPluginContext* pContext, const cell_t* params)
 {
-	cell_t* addr;
-	pContext->LocalToPhysAddr(params[1], &addr);
-	cell_t array_size = params[2];
-
-	std::vector<double> values;
-	values.reserve(array_size);
-
-	for (cell_t i = 0; i < array_size; i++) {
-		values.push_back(sp_ctof(addr[i]));
-	}
-
-	JsonValue* pJSONValue = g_pJsonManager->ArrayInitWithDouble(values.data(), values.size());
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Failed to create JSON array from float values");
-	}
+	if (!handle) return 0;
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from float values");
+	return g_pJsonManager->IsBool(handle);
 }
 
-static cell_t json_arr_get_size(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_true(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	size_t size = g_pJsonManager->ArrayGetSize(handle);
-	return static_cast<cell_t>(size);
+	return g_pJsonManager->IsTrue(handle);
 }
 
-static cell_t json_arr_get_val(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_false(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
-	}
-	size_t index = static_cast<size_t>(index_param);
-
-	JsonValue* pJSONValue = g_pJsonManager->ArrayGet(handle, index);
-
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Index %d is out of bounds", index);
-	}
-
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array value");
+	return g_pJsonManager->IsFalse(handle);
 }
 
-static cell_t json_arr_get_first(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_float(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	JsonValue* pJSONValue = g_pJsonManager->ArrayGetFirst(handle);
-
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Array is empty");
-	}
-
-	return CreateAndReturnHandle(pContext, pJSONValue, "first JSON array value");
+	return g_pJsonManager->IsFloat(handle);
 }
 
-static cell_t json_arr_get_last(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_str(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	JsonValue* pJSONValue = g_pJsonManager->ArrayGetLast(handle);
-
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Array is empty");
-	}
-
-	return CreateAndReturnHandle(pContext, pJSONValue, "last JSON array value");
+	return g_pJsonManager->IsStr(handle);
 }
 
-static cell_t json_arr_get_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_null(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
-	}
-	size_t index = static_cast<size_t>(index_param);
-
-	bool value;
-	if (!g_pJsonManager->ArrayGetBool(handle, index, &value)) {
-		return pContext->ThrowNativeError("Failed to get boolean at index %d", index);
-	}
-
-	return value;
+	return g_pJsonManager->IsNull(handle);
 }
 
-static cell_t json_arr_get_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_ctn(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
-	}
-	size_t index = static_cast<size_t>(index_param);
-
-	double value;
-	if (!g_pJsonManager->ArrayGetDouble(handle, index, &value)) {
-		return pContext->ThrowNativeError("Failed to get float at index %d", index);
-	}
-
-	return sp_ftoc(static_cast<float>(value));
+	return g_pJsonManager->IsCtn(handle);
 }
 
-static cell_t json_arr_get_integer(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_mutable(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
-	}
-	size_t index = static_cast<size_t>(index_param);
-
-	int value;
-	if (!g_pJsonManager->ArrayGetInt(handle, index, &value)) {
-		return pContext->ThrowNativeError("Failed to get integer at index %d", index);
-	}
-
-	return value;
+	return g_pJsonManager->IsMutable(handle);
 }
 
-static cell_t json_arr_get_integer64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_is_immutable(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
-	}
-	size_t index = static_cast<size_t>(index_param);
-
-	std::variant<int64_t, uint64_t> value;
-	if (!g_pJsonManager->ArrayGetInt64(handle, index, &value)) {
-		return pContext->ThrowNativeError("Failed to get integer64 at index %d", index);
-	}
-
-	char result[JSON_INT64_BUFFER_SIZE];
-	if (!Int64VariantToString(value, result, sizeof(result))) {
-		return pContext->ThrowNativeError("Failed to convert integer64 to string");
-	}
-	pContext->StringToLocalUTF8(params[3], params[4], result, nullptr);
-
-	return 1;
+	return g_pJsonManager->IsImmutable(handle);
 }
 
-static cell_t json_arr_get_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_init(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* pJSONValue = g_pJsonManager->ObjectInit();
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object");
+}
 
-	if (!handle) return 0;
+static cell_t json_obj_init_with_str(IPluginContext* pContext, const cell_t* params)
+{
+	cell_t* addr;
+	pContext->LocalToPhysAddr(params[1], &addr);
+	cell_t array_size = params[2];
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	if (array_size < 2) {
+		return pContext->ThrowNativeError("Array must contain at least one key-value pair");
+	}
+	if (array_size % 2 != 0) {
+		return pContext->ThrowNativeError("Array must contain an even number of strings (got %d)", array_size);
 	}
-	size_t index = static_cast<size_t>(index_param);
 
-	const char* str;
-	size_t len;
-	if (!g_pJsonManager->ArrayGetString(handle, index, &str, &len)) {
-		return pContext->ThrowNativeError("Failed to get string at index %d", index);
-	}
+	std::vector<const char*> kv_pairs;
+	kv_pairs.reserve(array_size);
 
-	size_t maxlen = static_cast<size_t>(params[4]);
-	if (len + 1 > maxlen) {
-		return pContext->ThrowNativeError("Buffer is too small (need %d, have %d)", len + 1, maxlen);
-	}
+	for (cell_t i = 0; i < array_size; i += 2) {
+		char* key;
+		char* value;
 
-	pContext->StringToLocalUTF8(params[3], maxlen, str, nullptr);
+		if (pContext->LocalToString(addr[i], &key) != SP_ERROR_NONE) {
+			return pContext->ThrowNativeError("Failed to read key at index %d", i);
+		}
+		if (!key || !key[0]) {
+			return pContext->ThrowNativeError("Empty key at index %d", i);
+		}
 
-	return 1;
-}
+		if (pContext->LocalToString(addr[i + 1], &value) != SP_ERROR_NONE) {
+			return pContext->ThrowNativeError("Failed to read value at index %d", i + 1);
+		}
+		if (!value) {
+			return pContext->ThrowNativeError("Invalid value at index %d", i + 1);
+		}
 
-static cell_t json_arr_is_null(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+		kv_pairs.push_back(key);
+		kv_pairs.push_back(value);
+	}
 
-	if (!handle) return 0;
+	JsonValue* pJSONValue = g_pJsonManager->ObjectInitWithStrings(kv_pairs.data(), array_size / 2);
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Failed to create JSON object from key-value pairs");
 	}
-	size_t index = static_cast<size_t>(index_param);
 
-	return g_pJsonManager->ArrayIsNull(handle, index);
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object from key-value pairs");
 }
 
-static cell_t json_arr_replace_val(IPluginContext* pContext, const cell_t* params)
+static cell_t json_create_bool(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[3]);
-
-	if (!handle1 || !handle2) return 0;
-
-	if (!handle1->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
-	}
+	JsonValue* pJSONValue = g_pJsonManager->CreateBool(params[1]);
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON boolean value");
+}
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
-	}
-	size_t index = static_cast<size_t>(index_param);
+static cell_t json_create_float(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* pJSONValue = g_pJsonManager->CreateDouble(sp_ctof(params[1]));
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON float value");
+}
 
-	return g_pJsonManager->ArrayReplace(handle1, index, handle2);
+static cell_t json_create_int(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* pJSONValue = g_pJsonManager->CreateInt(params[1]);
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON integer value");
 }
 
-static cell_t json_arr_replace_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_create_integer64(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	char* value;
+	pContext->LocalToString(params[1], &value);
 
-	if (!handle) return 0;
+	std::variant<int64_t, uint64_t> variant_value;
+	char error[JSON_ERROR_BUFFER_SIZE];
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
+	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
 	}
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	JsonValue* pJSONValue = g_pJsonManager->CreateInt64(variant_value);
+
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Failed to create JSON integer64 value");
 	}
-	size_t index = static_cast<size_t>(index_param);
 
-	return g_pJsonManager->ArrayReplaceBool(handle, index, params[3]);
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON integer64 value");
 }
 
-static cell_t json_arr_replace_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_create_str(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
-	if (!handle) return 0;
+	char* str;
+	pContext->LocalToString(params[1], &str);
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
-	}
+	JsonValue* pJSONValue = g_pJsonManager->CreateString(str);
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Failed to create JSON string value");
 	}
-	size_t index = static_cast<size_t>(index_param);
 
-	return g_pJsonManager->ArrayReplaceDouble(handle, index, sp_ctof(params[3]));
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON string value");
 }
 
-static cell_t json_arr_replace_integer(IPluginContext* pContext, const cell_t* params)
+static cell_t json_get_bool(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
-	}
-
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	bool value;
+	if (!g_pJsonManager->GetBool(handle, &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected boolean value");
 	}
-	size_t index = static_cast<size_t>(index_param);
 
-	return g_pJsonManager->ArrayReplaceInt(handle, index, params[3]);
+	return value;
 }
 
-static cell_t json_arr_replace_integer64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_get_float(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
+	double value;
+	if (!g_pJsonManager->GetDouble(handle, &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected float value");
 	}
 
-	char* value;
-	pContext->LocalToString(params[3], &value);
+	return sp_ftoc(static_cast<float>(value));
+}
 
-	std::variant<int64_t, uint64_t> variant_value;
-	char error[JSON_ERROR_BUFFER_SIZE];
+static cell_t json_get_int(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
-	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
-	}
+	if (!handle) return 0;
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	int value;
+	if (!g_pJsonManager->GetInt(handle, &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected integer value");
 	}
-	size_t index = static_cast<size_t>(index_param);
 
-	return g_pJsonManager->ArrayReplaceInt64(handle, index, variant_value);
+	return value;
 }
 
-static cell_t json_arr_replace_null(IPluginContext* pContext, const cell_t* params)
+static cell_t json_get_integer64(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
+	std::variant<int64_t, uint64_t> value;
+	if (!g_pJsonManager->GetInt64(handle, &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected integer64 value");
 	}
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	char result[JSON_INT64_BUFFER_SIZE];
+	if (!Int64VariantToString(value, result, sizeof(result))) {
+		return pContext->ThrowNativeError("Failed to convert integer64 to string");
 	}
-	size_t index = static_cast<size_t>(index_param);
+	pContext->StringToLocalUTF8(params[2], params[3], result, nullptr);
 
-	return g_pJsonManager->ArrayReplaceNull(handle, index);
+	return 1;
 }
 
-static cell_t json_arr_replace_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_get_str(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
-	}
-
-	char* val;
-	pContext->LocalToString(params[3], &val);
+	const char* str;
+	size_t len;
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	if (!g_pJsonManager->GetString(handle, &str, &len)) {
+		return pContext->ThrowNativeError("Type mismatch: expected string value");
 	}
-	size_t index = static_cast<size_t>(index_param);
-
-	return g_pJsonManager->ArrayReplaceString(handle, index, val);
-}
 
-static cell_t json_arr_append_val(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
-
-	if (!handle1 || !handle2) return 0;
+	size_t maxlen = static_cast<size_t>(params[3]);
 
-	if (!handle1->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
+	if (len + 1 > maxlen) {
+		return pContext->ThrowNativeError("Buffer is too small (need %d, have %d)", len + 1, maxlen);
 	}
 
-	return g_pJsonManager->ArrayAppend(handle1, handle2);
+	pContext->StringToLocalUTF8(params[2], maxlen, str, nullptr);
+
+	return 1;
 }
 
-static cell_t json_arr_append_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_equals_str(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
-	}
+	char* str;
+	pContext->LocalToString(params[2], &str);
 
-	return g_pJsonManager->ArrayAppendBool(handle, params[2]);
+	return g_pJsonManager->EqualsStr(handle, str);
 }
 
-static cell_t json_arr_append_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_get_serialized_size(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
-	}
+	uint32_t write_flg = static_cast<uint32_t>(params[2]);
+	size_t size = g_pJsonManager->GetSerializedSize(handle, write_flg);
 
-	return g_pJsonManager->ArrayAppendDouble(handle, sp_ctof(params[2]));
+	return static_cast<cell_t>(size);
 }
 
-static cell_t json_arr_append_int(IPluginContext* pContext, const cell_t* params)
+static cell_t json_get_read_size(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
-	}
+	size_t size = g_pJsonManager->GetReadSize(handle);
+	if (size == 0) return 0;
 
-	return g_pJsonManager->ArrayAppendInt(handle, params[2]);
+	return static_cast<cell_t>(size);
 }
 
-static cell_t json_arr_append_integer64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_get_ref_count(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
-	}
-
-	char* value;
-	pContext->LocalToString(params[2], &value);
-
-	std::variant<int64_t, uint64_t> variant_value;
-	char error[JSON_ERROR_BUFFER_SIZE];
-
-	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
-	}
-
-	return g_pJsonManager->ArrayAppendInt64(handle, variant_value);
+	return g_pJsonManager->GetRefCount(handle);
 }
 
-static cell_t json_arr_append_null(IPluginContext* pContext, const cell_t* params)
+static cell_t json_get_val_count(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
-	}
+	return g_pJsonManager->GetValCount(handle);
+}
 
-	return g_pJsonManager->ArrayAppendNull(handle);
+static cell_t json_create_null(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* pJSONValue = g_pJsonManager->CreateNull();
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON null value");
 }
 
-static cell_t json_arr_append_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_init(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* pJSONValue = g_pJsonManager->ArrayInit();
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array");
+}
 
-	if (!handle) return 0;
+static cell_t json_arr_init_with_str(IPluginContext* pContext, const cell_t* params)
+{
+	cell_t* addr;
+	pContext->LocalToPhysAddr(params[1], &addr);
+	cell_t array_size = params[2];
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
+	std::vector<const char*> strs;
+	strs.reserve(array_size);
+
+	for (cell_t i = 0; i < array_size; i++) {
+		char* str;
+		pContext->LocalToString(addr[i], &str);
+		strs.push_back(str);
 	}
 
-	char* str;
-	pContext->LocalToString(params[2], &str);
+	JsonValue* pJSONValue = g_pJsonManager->ArrayInitWithStrings(strs.data(), strs.size());
 
-	return g_pJsonManager->ArrayAppendString(handle, str);
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Failed to create JSON array from strings");
+	}
+
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from strings");
 }
 
-static cell_t json_arr_insert(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_init_with_int32(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
+	cell_t* addr;
+	pContext->LocalToPhysAddr(params[1], &addr);
+	cell_t array_size = params[2];
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
+	std::vector<int32_t> values;
+	values.reserve(array_size);
+
+	for (cell_t i = 0; i < array_size; i++) {
+		values.push_back(static_cast<int32_t>(addr[i]));
 	}
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	JsonValue* pJSONValue = g_pJsonManager->ArrayInitWithInt32(values.data(), values.size());
+
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Failed to create JSON array from int32 values");
 	}
-	size_t index = static_cast<size_t>(index_param);
 
-	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
-	if (index > arr_size) {
-		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from int32 values");
+}
+
+static cell_t json_arr_init_with_int64(IPluginContext* pContext, const cell_t* params)
+{
+	cell_t* addr;
+	pContext->LocalToPhysAddr(params[1], &addr);
+	cell_t array_size = params[2];
+
+	std::vector<const char*> strs;
+	strs.reserve(array_size);
+
+	for (cell_t i = 0; i < array_size; i++) {
+		char* str;
+		pContext->LocalToString(addr[i], &str);
+		strs.push_back(str);
 	}
 
-	JsonValue* value = g_pJsonManager->GetValueFromHandle(pContext, params[3]);
-	if (!value) return 0;
+	char error[JSON_ERROR_BUFFER_SIZE];
+	JsonValue* pJSONValue = g_pJsonManager->ArrayInitWithInt64(strs.data(), strs.size(), error, sizeof(error));
 
-	return g_pJsonManager->ArrayInsert(handle, index, value);
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Failed to create JSON array from int64 values: %s", error);
+	}
+
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from int64 values");
 }
 
-static cell_t json_arr_insert_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_init_with_bool(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
+	cell_t* addr;
+	pContext->LocalToPhysAddr(params[1], &addr);
+	cell_t array_size = params[2];
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
+	// std::vector<bool> is specialized and doesn't work with .data() so we use a unique_ptr
+	auto values = std::make_unique<bool[]>(array_size);
+
+	for (cell_t i = 0; i < array_size; i++) {
+		values[i] = (addr[i] != 0);
 	}
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	JsonValue* pJSONValue = g_pJsonManager->ArrayInitWithBool(values.get(), array_size);
+
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Failed to create JSON array from bool values");
 	}
-	size_t index = static_cast<size_t>(index_param);
 
-	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
-	if (index > arr_size) {
-		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from bool values");
+}
+
+static cell_t json_arr_init_with_float(IPluginContext* pContext, const cell_t* params)
+{
+	cell_t* addr;
+	pContext->LocalToPhysAddr(params[1], &addr);
+	cell_t array_size = params[2];
+
+	std::vector<double> values;
+	values.reserve(array_size);
+
+	for (cell_t i = 0; i < array_size; i++) {
+		values.push_back(sp_ctof(addr[i]));
 	}
 
-	bool value = params[3] != 0;
+	JsonValue* pJSONValue = g_pJsonManager->ArrayInitWithDouble(values.data(), values.size());
 
-	return g_pJsonManager->ArrayInsertBool(handle, index, value);
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Failed to create JSON array from float values");
+	}
+
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array from float values");
 }
 
-static cell_t json_arr_insert_int(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_get_size(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
-	}
+	size_t size = g_pJsonManager->ArrayGetSize(handle);
+	return static_cast<cell_t>(size);
+}
+
+static cell_t json_arr_get_val(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
 
 	cell_t index_param = params[2];
 	if (index_param < 0) {
@@ -1407,57 +1573,50 @@ static cell_t json_arr_insert_int(IPluginContext* pContext, const cell_t* params
 	}
 	size_t index = static_cast<size_t>(index_param);
 
-	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
-	if (index > arr_size) {
-		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
-	}
+	JsonValue* pJSONValue = g_pJsonManager->ArrayGet(handle, index);
 
-	int value = params[3];
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Index %d is out of bounds", index);
+	}
 
-	return g_pJsonManager->ArrayInsertInt(handle, index, value);
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON array value");
 }
 
-static cell_t json_arr_insert_int64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_get_first(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
-	}
+	JsonValue* pJSONValue = g_pJsonManager->ArrayGetFirst(handle);
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Array is empty");
 	}
-	size_t index = static_cast<size_t>(index_param);
 
-	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
-	if (index > arr_size) {
-		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
-	}
+	return CreateAndReturnHandle(pContext, pJSONValue, "first JSON array value");
+}
 
-	char* value;
-	pContext->LocalToString(params[3], &value);
+static cell_t json_arr_get_last(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
-	std::variant<int64_t, uint64_t> variant_value;
-	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!handle) return 0;
 
-	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	JsonValue* pJSONValue = g_pJsonManager->ArrayGetLast(handle);
+
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Array is empty");
 	}
 
-	return g_pJsonManager->ArrayInsertInt64(handle, index, variant_value);
+	return CreateAndReturnHandle(pContext, pJSONValue, "last JSON array value");
 }
 
-static cell_t json_arr_insert_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_get_bool(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
-	}
+	if (!handle) return 0;
 
 	cell_t index_param = params[2];
 	if (index_param < 0) {
@@ -1465,22 +1624,19 @@ static cell_t json_arr_insert_float(IPluginContext* pContext, const cell_t* para
 	}
 	size_t index = static_cast<size_t>(index_param);
 
-	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
-	if (index > arr_size) {
-		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
+	bool value;
+	if (!g_pJsonManager->ArrayGetBool(handle, index, &value)) {
+		return pContext->ThrowNativeError("Failed to get boolean at index %d", index);
 	}
 
-	return g_pJsonManager->ArrayInsertDouble(handle, index, sp_ctof(params[3]));
+	return value;
 }
 
-static cell_t json_arr_insert_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_get_float(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
-	}
+	if (!handle) return 0;
 
 	cell_t index_param = params[2];
 	if (index_param < 0) {
@@ -1488,25 +1644,19 @@ static cell_t json_arr_insert_str(IPluginContext* pContext, const cell_t* params
 	}
 	size_t index = static_cast<size_t>(index_param);
 
-	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
-	if (index > arr_size) {
-		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
+	double value;
+	if (!g_pJsonManager->ArrayGetDouble(handle, index, &value)) {
+		return pContext->ThrowNativeError("Failed to get float at index %d", index);
 	}
 
-	char* str;
-	pContext->LocalToString(params[3], &str);
-
-	return g_pJsonManager->ArrayInsertString(handle, index, str);
+	return sp_ftoc(static_cast<float>(value));
 }
 
-static cell_t json_arr_insert_null(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_get_integer(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
-	}
+	if (!handle) return 0;
 
 	cell_t index_param = params[2];
 	if (index_param < 0) {
@@ -1514,126 +1664,197 @@ static cell_t json_arr_insert_null(IPluginContext* pContext, const cell_t* param
 	}
 	size_t index = static_cast<size_t>(index_param);
 
-	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
-	if (index > arr_size) {
-		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
+	int value;
+	if (!g_pJsonManager->ArrayGetInt(handle, index, &value)) {
+		return pContext->ThrowNativeError("Failed to get integer at index %d", index);
 	}
 
-	return g_pJsonManager->ArrayInsertNull(handle, index);
+	return value;
 }
 
-static cell_t json_arr_prepend(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_get_integer64(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
 	}
+	size_t index = static_cast<size_t>(index_param);
 
-	JsonValue* value = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
-	if (!value) return 0;
+	std::variant<int64_t, uint64_t> value;
+	if (!g_pJsonManager->ArrayGetInt64(handle, index, &value)) {
+		return pContext->ThrowNativeError("Failed to get integer64 at index %d", index);
+	}
 
-	return g_pJsonManager->ArrayPrepend(handle, value);
+	char result[JSON_INT64_BUFFER_SIZE];
+	if (!Int64VariantToString(value, result, sizeof(result))) {
+		return pContext->ThrowNativeError("Failed to convert integer64 to string");
+	}
+	pContext->StringToLocalUTF8(params[3], params[4], result, nullptr);
+
+	return 1;
 }
 
-static cell_t json_arr_prepend_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_get_str(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
 	}
+	size_t index = static_cast<size_t>(index_param);
 
-	bool value = params[2] != 0;
+	const char* str;
+	size_t len;
+	if (!g_pJsonManager->ArrayGetString(handle, index, &str, &len)) {
+		return pContext->ThrowNativeError("Failed to get string at index %d", index);
+	}
 
-	return g_pJsonManager->ArrayPrependBool(handle, value);
+	size_t maxlen = static_cast<size_t>(params[4]);
+	if (len + 1 > maxlen) {
+		return pContext->ThrowNativeError("Buffer is too small (need %d, have %d)", len + 1, maxlen);
+	}
+
+	pContext->StringToLocalUTF8(params[3], maxlen, str, nullptr);
+
+	return 1;
 }
 
-static cell_t json_arr_prepend_int(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_is_null(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
 	}
+	size_t index = static_cast<size_t>(index_param);
 
-	int value = params[2];
+	return g_pJsonManager->ArrayIsNull(handle, index);
+}
 
-	return g_pJsonManager->ArrayPrependInt(handle, value);
+static cell_t json_arr_replace_val(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[3]);
+
+	if (!handle1 || !handle2) return 0;
+
+	if (!handle1->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
+	}
+
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	}
+	size_t index = static_cast<size_t>(index_param);
+
+	return g_pJsonManager->ArrayReplace(handle1, index, handle2);
 }
 
-static cell_t json_arr_prepend_int64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_replace_bool(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
+		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
 	}
 
-	char* value;
-	pContext->LocalToString(params[2], &value);
-
-	std::variant<int64_t, uint64_t> variant_value;
-	char error[JSON_ERROR_BUFFER_SIZE];
-
-	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
 	}
+	size_t index = static_cast<size_t>(index_param);
 
-	return g_pJsonManager->ArrayPrependInt64(handle, variant_value);
+	return g_pJsonManager->ArrayReplaceBool(handle, index, params[3]);
 }
 
-static cell_t json_arr_prepend_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_replace_float(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
+		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
 	}
 
-	return g_pJsonManager->ArrayPrependDouble(handle, sp_ctof(params[2]));
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	}
+	size_t index = static_cast<size_t>(index_param);
+
+	return g_pJsonManager->ArrayReplaceDouble(handle, index, sp_ctof(params[3]));
 }
 
-static cell_t json_arr_prepend_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_replace_integer(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
+		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
 	}
 
-	char* str;
-	pContext->LocalToString(params[2], &str);
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	}
+	size_t index = static_cast<size_t>(index_param);
 
-	return g_pJsonManager->ArrayPrependString(handle, str);
+	return g_pJsonManager->ArrayReplaceInt(handle, index, params[3]);
 }
 
-static cell_t json_arr_prepend_null(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_replace_integer64(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
+		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
 	}
 
-	return g_pJsonManager->ArrayPrependNull(handle);
+	char* value;
+	pContext->LocalToString(params[3], &value);
+
+	std::variant<int64_t, uint64_t> variant_value;
+	char error[JSON_ERROR_BUFFER_SIZE];
+
+	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	}
+	size_t index = static_cast<size_t>(index_param);
+
+	return g_pJsonManager->ArrayReplaceInt64(handle, index, variant_value);
 }
 
-static cell_t json_arr_remove(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_replace_null(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON array");
+		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
 	}
 
 	cell_t index_param = params[2];
@@ -1642,531 +1863,528 @@ static cell_t json_arr_remove(IPluginContext* pContext, const cell_t* params)
 	}
 	size_t index = static_cast<size_t>(index_param);
 
-	return g_pJsonManager->ArrayRemove(handle, index);
+	return g_pJsonManager->ArrayReplaceNull(handle, index);
 }
 
-static cell_t json_arr_remove_first(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_replace_str(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON array");
+		return pContext->ThrowNativeError("Cannot replace value in an immutable JSON array");
 	}
 
-	return g_pJsonManager->ArrayRemoveFirst(handle);
+	char* val;
+	pContext->LocalToString(params[3], &val);
+
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	}
+	size_t index = static_cast<size_t>(index_param);
+
+	return g_pJsonManager->ArrayReplaceString(handle, index, val);
 }
 
-static cell_t json_arr_remove_last(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_append_val(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
 
-	if (!handle) return 0;
+	if (!handle1 || !handle2) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON array");
+	if (!handle1->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
 	}
 
-	return g_pJsonManager->ArrayRemoveLast(handle);
+	return g_pJsonManager->ArrayAppend(handle1, handle2);
 }
 
-static cell_t json_arr_remove_range(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_append_bool(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON array");
-	}
-
-	cell_t start_index_param = params[2];
-	cell_t count_param = params[3];
-	if (start_index_param < 0) {
-		return pContext->ThrowNativeError("Start index must be >= 0 (got %d)", start_index_param);
-	}
-	if (count_param < 0) {
-		return pContext->ThrowNativeError("Count must be >= 0 (got %d)", count_param);
+		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
 	}
 
-	size_t start_index = static_cast<size_t>(start_index_param);
-	size_t count = static_cast<size_t>(count_param);
-	return g_pJsonManager->ArrayRemoveRange(handle, start_index, count);
+	return g_pJsonManager->ArrayAppendBool(handle, params[2]);
 }
 
-static cell_t json_arr_clear(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_append_float(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot clear an immutable JSON array");
+		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
 	}
 
-	return g_pJsonManager->ArrayClear(handle);
+	return g_pJsonManager->ArrayAppendDouble(handle, sp_ctof(params[2]));
 }
 
-static cell_t json_doc_write_to_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_append_int(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	size_t buffer_size = static_cast<size_t>(params[3]);
-	uint32_t write_flg = static_cast<uint32_t>(params[4]);
-
-	size_t json_size;
-	char* json_str = g_pJsonManager->WriteToStringPtr(handle, write_flg, &json_size);
-
-	if (!json_str) {
-		return pContext->ThrowNativeError("Failed to serialize JSON");
-	}
-
-	if (json_size > buffer_size) {
-		free(json_str);
-		return pContext->ThrowNativeError("Buffer too small (need %d, have %d)", json_size, buffer_size);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
 	}
 
-	pContext->StringToLocalUTF8(params[2], buffer_size, json_str, nullptr);
-	free(json_str);
-
-	return static_cast<cell_t>(json_size);
+	return g_pJsonManager->ArrayAppendInt(handle, params[2]);
 }
 
-static cell_t json_doc_write_to_file(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_append_integer64(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
-	uint32_t write_flg = static_cast<uint32_t>(params[3]);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
+	}
 
+	char* value;
+	pContext->LocalToString(params[2], &value);
+
+	std::variant<int64_t, uint64_t> variant_value;
 	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->WriteToFile(handle, path, write_flg, error, sizeof(error))) {
-		return pContext->ThrowNativeError(error);
+
+	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
 	}
 
-	return true;
+	return g_pJsonManager->ArrayAppendInt64(handle, variant_value);
 }
 
-static cell_t json_obj_get_size(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_append_null(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	size_t size = g_pJsonManager->ObjectGetSize(handle);
-	return static_cast<cell_t>(size);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
+	}
+
+	return g_pJsonManager->ArrayAppendNull(handle);
 }
 
-static cell_t json_obj_get_key(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_append_str(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	cell_t index_param = params[2];
-	if (index_param < 0) {
-		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot append value to an immutable JSON array");
 	}
-	size_t index = static_cast<size_t>(index_param);
-	const char* key;
 
-	if (!g_pJsonManager->ObjectGetKey(handle, index, &key)) {
-		return pContext->ThrowNativeError("Index %d is out of bounds", index);
-	}
+	char* str;
+	pContext->LocalToString(params[2], &str);
 
-	pContext->StringToLocalUTF8(params[3], params[4], key, nullptr);
-	return 1;
+	return g_pJsonManager->ArrayAppendString(handle, str);
 }
 
-static cell_t json_obj_get_val_at(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_insert(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
+	}
+
 	cell_t index_param = params[2];
 	if (index_param < 0) {
 		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
 	}
 	size_t index = static_cast<size_t>(index_param);
 
-	JsonValue* pJSONValue = g_pJsonManager->ObjectGetValueAt(handle, index);
-
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Index %d is out of bounds", index);
+	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
+	if (index > arr_size) {
+		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
 	}
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object value");
+	JsonValue* value = g_pJsonManager->GetValueFromHandle(pContext, params[3]);
+	if (!value) return 0;
+
+	return g_pJsonManager->ArrayInsert(handle, index, value);
 }
 
-static cell_t json_obj_get_val(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_insert_bool(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
+	}
 
-	JsonValue* pJSONValue = g_pJsonManager->ObjectGet(handle, key);
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	}
+	size_t index = static_cast<size_t>(index_param);
 
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Key not found: %s", key);
+	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
+	if (index > arr_size) {
+		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
 	}
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object value");
+	bool value = params[3] != 0;
+
+	return g_pJsonManager->ArrayInsertBool(handle, index, value);
 }
 
-static cell_t json_obj_get_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_insert_int(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
+	}
 
-	bool value;
-	if (!g_pJsonManager->ObjectGetBool(handle, key, &value)) {
-		return pContext->ThrowNativeError("Failed to get boolean for key '%s'", key);
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
 	}
+	size_t index = static_cast<size_t>(index_param);
 
-	return value;
+	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
+	if (index > arr_size) {
+		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
+	}
+
+	int value = params[3];
+
+	return g_pJsonManager->ArrayInsertInt(handle, index, value);
 }
 
-static cell_t json_obj_get_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_insert_int64(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
-
-	double value;
-	if (!g_pJsonManager->ObjectGetDouble(handle, key, &value)) {
-		return pContext->ThrowNativeError("Failed to get float for key '%s'", key);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
 	}
 
-	return sp_ftoc(static_cast<float>(value));
-}
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	}
+	size_t index = static_cast<size_t>(index_param);
 
-static cell_t json_obj_get_int(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
+	if (index > arr_size) {
+		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
+	}
 
-	if (!handle) return 0;
+	char* value;
+	pContext->LocalToString(params[3], &value);
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
+	std::variant<int64_t, uint64_t> variant_value;
+	char error[JSON_ERROR_BUFFER_SIZE];
 
-	int value;
-	if (!g_pJsonManager->ObjectGetInt(handle, key, &value)) {
-		return pContext->ThrowNativeError("Failed to get integer for key '%s'", key);
+	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
 	}
 
-	return value;
+	return g_pJsonManager->ArrayInsertInt64(handle, index, variant_value);
 }
 
-static cell_t json_obj_get_integer64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_insert_float(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
+	}
 
-	std::variant<int64_t, uint64_t> value;
-	if (!g_pJsonManager->ObjectGetInt64(handle, key, &value)) {
-		return pContext->ThrowNativeError("Failed to get integer64 for key '%s'", key);
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
 	}
+	size_t index = static_cast<size_t>(index_param);
 
-	char result[JSON_INT64_BUFFER_SIZE];
-	if (!Int64VariantToString(value, result, sizeof(result))) {
-		return pContext->ThrowNativeError("Failed to convert integer64 to string");
+	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
+	if (index > arr_size) {
+		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
 	}
-	pContext->StringToLocalUTF8(params[3], params[4], result, nullptr);
 
-	return 1;
+	return g_pJsonManager->ArrayInsertDouble(handle, index, sp_ctof(params[3]));
 }
 
-static cell_t json_obj_get_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_insert_str(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
+	}
 
-	const char* str;
-	size_t len;
-	if (!g_pJsonManager->ObjectGetString(handle, key, &str, &len)) {
-		return pContext->ThrowNativeError("Failed to get string for key '%s'", key);
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
 	}
+	size_t index = static_cast<size_t>(index_param);
 
-	size_t maxlen = static_cast<size_t>(params[4]);
-	if (len + 1 > maxlen) {
-		return pContext->ThrowNativeError("Buffer is too small (need %d, have %d)", len + 1, maxlen);
+	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
+	if (index > arr_size) {
+		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
 	}
 
-	pContext->StringToLocalUTF8(params[3], maxlen, str, nullptr);
+	char* str;
+	pContext->LocalToString(params[3], &str);
 
-	return 1;
+	return g_pJsonManager->ArrayInsertString(handle, index, str);
 }
 
-static cell_t json_obj_clear(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_insert_null(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot clear an immutable JSON object");
+		return pContext->ThrowNativeError("Cannot insert value into an immutable JSON array");
 	}
 
-	return g_pJsonManager->ObjectClear(handle);
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
+	}
+	size_t index = static_cast<size_t>(index_param);
+
+	size_t arr_size = g_pJsonManager->ArrayGetSize(handle);
+	if (index > arr_size) {
+		return pContext->ThrowNativeError("Index is out of bounds (got %d, max %zu)", index, arr_size);
+	}
+
+	return g_pJsonManager->ArrayInsertNull(handle, index);
 }
 
-static cell_t json_obj_is_null(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_prepend(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
-
-	bool is_null;
-	if (!g_pJsonManager->ObjectIsNull(handle, key, &is_null)) {
-		return pContext->ThrowNativeError("Key not found: %s", key);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
 	}
 
-	return is_null;
+	JsonValue* value = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
+	if (!value) return 0;
+
+	return g_pJsonManager->ArrayPrepend(handle, value);
 }
 
-static cell_t json_obj_has_key(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_prepend_bool(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
+	}
 
-	bool ptr_use = params[3];
+	bool value = params[2] != 0;
 
-	return g_pJsonManager->ObjectHasKey(handle, key, ptr_use);
+	return g_pJsonManager->ArrayPrependBool(handle, value);
 }
 
-static cell_t json_obj_rename_key(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_prepend_int(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot rename key in an immutable JSON object");
+		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
 	}
 
-	char* old_key;
-	pContext->LocalToString(params[2], &old_key);
+	int value = params[2];
 
-	char* new_key;
-	pContext->LocalToString(params[3], &new_key);
+	return g_pJsonManager->ArrayPrependInt(handle, value);
+}
 
-	bool allow_duplicate = params[4];
+static cell_t json_arr_prepend_int64(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
 
-	if (!g_pJsonManager->ObjectRenameKey(handle, old_key, new_key, allow_duplicate)) {
-		return pContext->ThrowNativeError("Failed to rename key from '%s' to '%s'", old_key, new_key);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
 	}
 
-	return true;
-}
-
-static cell_t json_obj_set_val(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[3]);
+	char* value;
+	pContext->LocalToString(params[2], &value);
 
-	if (!handle1 || !handle2) return 0;
+	std::variant<int64_t, uint64_t> variant_value;
+	char error[JSON_ERROR_BUFFER_SIZE];
 
-	if (!handle1->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
 	}
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
-
-	return g_pJsonManager->ObjectSet(handle1, key, handle2);
+	return g_pJsonManager->ArrayPrependInt64(handle, variant_value);
 }
 
-static cell_t json_obj_set_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_prepend_float(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
 	}
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
-
-	return g_pJsonManager->ObjectSetBool(handle, key, params[3]);
+	return g_pJsonManager->ArrayPrependDouble(handle, sp_ctof(params[2]));
 }
 
-static cell_t json_obj_set_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_prepend_str(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
 	}
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
+	char* str;
+	pContext->LocalToString(params[2], &str);
 
-	return g_pJsonManager->ObjectSetDouble(handle, key, sp_ctof(params[3]));
+	return g_pJsonManager->ArrayPrependString(handle, str);
 }
 
-static cell_t json_obj_set_int(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_prepend_null(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+		return pContext->ThrowNativeError("Cannot prepend value to an immutable JSON array");
 	}
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
-
-	return g_pJsonManager->ObjectSetInt(handle, key, params[3]);
+	return g_pJsonManager->ArrayPrependNull(handle);
 }
 
-static cell_t json_obj_set_integer64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_remove(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON array");
 	}
 
-	char* key, * value;
-	pContext->LocalToString(params[2], &key);
-	pContext->LocalToString(params[3], &value);
-
-	std::variant<int64_t, uint64_t> variant_value;
-	char error[JSON_ERROR_BUFFER_SIZE];
-
-	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
 	}
+	size_t index = static_cast<size_t>(index_param);
 
-	return g_pJsonManager->ObjectSetInt64(handle, key, variant_value);
+	return g_pJsonManager->ArrayRemove(handle, index);
 }
 
-static cell_t json_obj_set_null(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_remove_first(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON array");
 	}
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
-
-	return g_pJsonManager->ObjectSetNull(handle, key);
+	return g_pJsonManager->ArrayRemoveFirst(handle);
 }
 
-static cell_t json_obj_set_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_remove_last(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON array");
 	}
 
-	char* key, * value;
-	pContext->LocalToString(params[2], &key);
-	pContext->LocalToString(params[3], &value);
-
-	return g_pJsonManager->ObjectSetString(handle, key, value);
+	return g_pJsonManager->ArrayRemoveLast(handle);
 }
 
-static cell_t json_obj_remove(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_remove_range(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
 	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON object");
+		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON array");
 	}
 
-	char* key;
-	pContext->LocalToString(params[2], &key);
+	cell_t start_index_param = params[2];
+	cell_t count_param = params[3];
+	if (start_index_param < 0) {
+		return pContext->ThrowNativeError("Start index must be >= 0 (got %d)", start_index_param);
+	}
+	if (count_param < 0) {
+		return pContext->ThrowNativeError("Count must be >= 0 (got %d)", count_param);
+	}
 
-	return g_pJsonManager->ObjectRemove(handle, key);
+	size_t start_index = static_cast<size_t>(start_index_param);
+	size_t count = static_cast<size_t>(count_param);
+	return g_pJsonManager->ArrayRemoveRange(handle, start_index, count);
 }
 
-static cell_t json_ptr_get_val(IPluginContext* pContext, const cell_t* params)
+static cell_t json_arr_clear(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
-
-	char error[JSON_ERROR_BUFFER_SIZE];
-	JsonValue* pJSONValue = g_pJsonManager->PtrGet(handle, path, error, sizeof(error));
-
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("%s", error);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot clear an immutable JSON array");
 	}
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "JSON pointer value");
+	return g_pJsonManager->ArrayClear(handle);
 }
 
-static cell_t json_ptr_get_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_write_to_str(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
+	size_t buffer_size = static_cast<size_t>(params[3]);
+	uint32_t write_flg = static_cast<uint32_t>(params[4]);
 
-	bool value;
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrGetBool(handle, path, &value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	char* buffer;
+	pContext->LocalToString(params[2], &buffer);
+
+	// Serialize straight into the plugin buffer, the manager only falls back to its scratch buffer when needed
+	size_t json_size = 0;
+	if (!g_pJsonManager->WriteToBuffer(handle, buffer, buffer_size, write_flg, &json_size)) {
+		if (json_size == 0) {
+			return pContext->ThrowNativeError("Failed to serialize JSON");
+		}
+		return pContext->ThrowNativeError("Buffer too small (need %d, have %d)", json_size, buffer_size);
 	}
 
-	return value;
+	return static_cast<cell_t>(json_size);
 }
 
-static cell_t json_ptr_get_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_write_to_file(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
@@ -2174,85 +2392,139 @@ static cell_t json_ptr_get_float(IPluginContext* pContext, const cell_t* params)
 
 	char* path;
 	pContext->LocalToString(params[2], &path);
+	uint32_t write_flg = static_cast<uint32_t>(params[3]);
 
-	double value;
 	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrGetDouble(handle, path, &value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	if (!g_pJsonManager->WriteToFile(handle, path, write_flg, error, sizeof(error))) {
+		return pContext->ThrowNativeError(error);
 	}
 
-	return sp_ftoc(static_cast<float>(value));
+	return true;
 }
 
-static cell_t json_ptr_get_int(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_get_file_cache_stats(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	uint64_t hits, misses;
+	size_t entries;
+	g_pJsonManager->GetFileCacheStats(&hits, &misses, &entries);
 
-	if (!handle) return 0;
+	cell_t* hitsAddr;
+	cell_t* missesAddr;
+	pContext->LocalToPhysAddr(params[1], &hitsAddr);
+	pContext->LocalToPhysAddr(params[2], &missesAddr);
+	*hitsAddr = static_cast<cell_t>(hits > INT32_MAX ? INT32_MAX : hits);
+	*missesAddr = static_cast<cell_t>(misses > INT32_MAX ? INT32_MAX : misses);
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
+	return static_cast<cell_t>(entries);
+}
 
-	int value;
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrGetInt(handle, path, &value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+static cell_t json_doc_clear_file_cache(IPluginContext* pContext, const cell_t* params)
+{
+	g_pJsonManager->ClearFileCache();
+	return 1;
+}
+
+static cell_t json_doc_set_write_cache_limit(IPluginContext* pContext, const cell_t* params)
+{
+	if (params[1] < 0) {
+		return pContext->ThrowNativeError("Invalid write cache limit: %d", params[1]);
 	}
 
-	return value;
+	g_pJsonManager->SetWriteCacheLimit(static_cast<size_t>(params[1]));
+	return 1;
 }
 
-static cell_t json_ptr_get_integer64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_get_write_cache_stats(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	uint64_t hits, misses;
+	size_t entries, bytes;
+	g_pJsonManager->GetWriteCacheStats(&hits, &misses, &entries, &bytes);
 
-	if (!handle) return 0;
+	cell_t* hitsAddr;
+	cell_t* missesAddr;
+	cell_t* bytesAddr;
+	pContext->LocalToPhysAddr(params[1], &hitsAddr);
+	pContext->LocalToPhysAddr(params[2], &missesAddr);
+	pContext->LocalToPhysAddr(params[3], &bytesAddr);
+	*hitsAddr = static_cast<cell_t>(hits > INT32_MAX ? INT32_MAX : hits);
+	*missesAddr = static_cast<cell_t>(misses > INT32_MAX ? INT32_MAX : misses);
+	*bytesAddr = static_cast<cell_t>(bytes > INT32_MAX ? INT32_MAX : bytes);
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
+	return static_cast<cell_t>(entries);
+}
 
-	std::variant<int64_t, uint64_t> value;
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrGetInt64(handle, path, &value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
-	}
+static cell_t json_doc_clear_write_cache(IPluginContext* pContext, const cell_t* params)
+{
+	g_pJsonManager->ClearWriteCache();
+	return 1;
+}
 
-	char result[JSON_INT64_BUFFER_SIZE];
-	if (!Int64VariantToString(value, result, sizeof(result))) {
-		return pContext->ThrowNativeError("Failed to convert integer64 to string");
+static cell_t json_doc_set_key_index_threshold(IPluginContext* pContext, const cell_t* params)
+{
+	if (params[1] < 0) {
+		return pContext->ThrowNativeError("Invalid key index threshold: %d", params[1]);
 	}
-	pContext->StringToLocalUTF8(params[3], params[4], result, nullptr);
 
+	g_pJsonManager->SetKeyIndexThreshold(static_cast<size_t>(params[1]));
 	return 1;
 }
 
-static cell_t json_ptr_get_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_get_key_index_stats(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	size_t indexes, bytes;
+	g_pJsonManager->GetKeyIndexStats(&indexes, &bytes);
 
-	if (!handle) return 0;
+	cell_t* bytesAddr;
+	pContext->LocalToPhysAddr(params[1], &bytesAddr);
+	*bytesAddr = static_cast<cell_t>(bytes > INT32_MAX ? INT32_MAX : bytes);
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
+	return static_cast<cell_t>(indexes > INT32_MAX ? INT32_MAX : indexes);
+}
 
-	const char* str;
-	size_t len;
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrGetString(handle, path, &str, &len, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+/**
+ * Async task: write a document snapshot to file on the worker thread and report the result to a plugin callback
+ */
+class JsonWriteFileTask : public JsonAsyncTask
+{
+public:
+	JsonWriteFileTask(JsonValue* snapshot, const char* path, uint32_t write_flg, bool sync, funcid_t callback, cell_t data)
+		: m_pSnapshot(snapshot), m_path(path), m_writeFlg(write_flg), m_sync(sync), m_callback(callback), m_data(data) {}
+
+	~JsonWriteFileTask() override
+	{
+		g_pJsonManager->Release(m_pSnapshot);
 	}
 
-	size_t maxlen = static_cast<size_t>(params[4]);
-	if (len + 1 > maxlen) {
-		return pContext->ThrowNativeError("Buffer is too small (need %d, have %d)", len + 1, maxlen);
+	void Run() override
+	{
+		m_success = g_pJsonManager->WriteToFileAtomic(m_pSnapshot, m_path.c_str(), m_writeFlg, m_sync, m_error, sizeof(m_error));
 	}
 
-	pContext->StringToLocalUTF8(params[3], maxlen, str, nullptr);
+	void Complete(IPluginContext* pContext) override
+	{
+		IPluginFunction* callback = pContext->GetFunctionById(m_callback);
+		if (!callback) {
+			return;
+		}
 
-	return 1;
-}
+		callback->PushCell(m_success);
+		callback->PushString(m_error);
+		callback->PushCell(m_data);
+		callback->Execute(nullptr);
+	}
 
-static cell_t json_ptr_get_is_null(IPluginContext* pContext, const cell_t* params)
+private:
+	JsonValue* m_pSnapshot;
+	std::string m_path;
+	uint32_t m_writeFlg;
+	bool m_sync;
+	funcid_t m_callback;
+	cell_t m_data;
+	bool m_success{ false };
+	char m_error[JSON_ERROR_BUFFER_SIZE]{};
+};
+
+static cell_t json_doc_write_to_file_async(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
@@ -2260,17 +2532,26 @@ static cell_t json_ptr_get_is_null(IPluginContext* pContext, const cell_t* param
 
 	char* path;
 	pContext->LocalToString(params[2], &path);
+	uint32_t write_flg = static_cast<uint32_t>(params[3]);
+	bool sync = params[6];
 
-	bool is_null;
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrGetIsNull(handle, path, &is_null, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	JsonValue* snapshot = g_pJsonManager->CreateSnapshot(handle);
+	if (!snapshot) {
+		return pContext->ThrowNativeError("Failed to snapshot JSON document");
 	}
 
-	return is_null;
+	// INVALID_FUNCTION resolves to no callback, the write still happens
+	auto task = std::make_unique<JsonWriteFileTask>(snapshot, path, write_flg, sync, params[4], params[5]);
+	task->m_pContext = pContext;
+
+	if (!g_JsonAsync.Submit(std::move(task))) {
+		return pContext->ThrowNativeError("Failed to queue async write for JSON file: %s", path);
+	}
+
+	return true;
 }
 
-static cell_t json_ptr_get_length(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_write_to_file_chunked(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
@@ -2278,1064 +2559,2540 @@ static cell_t json_ptr_get_length(IPluginContext* pContext, const cell_t* params
 
 	char* path;
 	pContext->LocalToString(params[2], &path);
+	uint32_t write_flg = static_cast<uint32_t>(params[3]);
+
+	if (params[4] <= 0) {
+		return pContext->ThrowNativeError("Invalid chunk size: %d", params[4]);
+	}
 
-	size_t len;
 	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrGetLength(handle, path, &len, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	if (!g_pJsonManager->WriteToFileChunked(handle, path, write_flg, static_cast<size_t>(params[4]), error, sizeof(error))) {
+		return pContext->ThrowNativeError(error);
 	}
 
-	return static_cast<cell_t>(len);
+	return true;
 }
 
-static cell_t json_ptr_set_val(IPluginContext* pContext, const cell_t* params)
+/**
+ * Chunk sink: hand every chunk to a plugin callback, which can stop the write by returning false
+ */
+class PluginChunkSink : public IJsonChunkSink
 {
-	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[3]);
-
-	if (!handle1 || !handle2) return 0;
-
-	if (!handle1->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+public:
+	PluginChunkSink(IPluginFunction* callback, cell_t data) : m_callback(callback), m_data(data) {}
+
+	bool WriteChunk(const char* data, size_t len) override
+	{
+		cell_t result = 0;
+		m_callback->PushString(data);
+		m_callback->PushCell(static_cast<cell_t>(len));
+		m_callback->PushCell(m_data);
+		if (m_callback->Execute(&result) != SP_ERROR_NONE || !result) {
+			m_stopped = true;
+			return false;
+		}
+		return true;
 	}
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
-
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrSet(handle1, path, handle2, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
-	}
+	bool Stopped() const { return m_stopped; }
 
-	return true;
-}
+private:
+	IPluginFunction* m_callback;
+	cell_t m_data;
+	bool m_stopped{ false };
+};
 
-static cell_t json_ptr_set_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_write_chunks(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+	IPluginFunction* callback = pContext->GetFunctionById(params[2]);
+	if (!callback) {
+		return pContext->ThrowNativeError("Invalid chunk callback function %x", params[2]);
 	}
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
+	uint32_t write_flg = static_cast<uint32_t>(params[3]);
+	if (params[4] <= 0) {
+		return pContext->ThrowNativeError("Invalid chunk size: %d", params[4]);
+	}
 
+	PluginChunkSink sink(callback, params[5]);
 	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrSetBool(handle, path, params[3], error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	if (!g_pJsonManager->WriteChunked(handle, &sink, write_flg, static_cast<size_t>(params[4]), error, sizeof(error))) {
+		if (sink.Stopped()) {
+			return false;
+		}
+		return pContext->ThrowNativeError(error);
 	}
 
 	return true;
 }
 
-static cell_t json_ptr_set_float(IPluginContext* pContext, const cell_t* params)
+/**
+ * Helper function: Encode a value into a plugin buffer as MessagePack or CBOR
+ * @return Number of bytes written, throws native error when the buffer is too small
+ */
+static cell_t WriteBinaryToPluginBuffer(IPluginContext* pContext, const cell_t* params, JSON_BINARY_FORMAT format)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+	if (params[3] < 0) {
+		return pContext->ThrowNativeError("Invalid buffer size: %d", params[3]);
 	}
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
+	char* buffer;
+	pContext->LocalToString(params[2], &buffer);
 
 	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrSetDouble(handle, path, sp_ctof(params[3]), error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	size_t size = 0;
+	if (!g_pJsonManager->WriteBinary(handle, format, buffer, static_cast<size_t>(params[3]), &size, error, sizeof(error))) {
+		return pContext->ThrowNativeError(error);
 	}
 
-	return true;
+	return static_cast<cell_t>(size);
 }
 
-static cell_t json_ptr_set_int(IPluginContext* pContext, const cell_t* params)
+static cell_t WriteBinaryToPluginFile(IPluginContext* pContext, const cell_t* params, JSON_BINARY_FORMAT format)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
-	}
-
 	char* path;
 	pContext->LocalToString(params[2], &path);
 
 	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrSetInt(handle, path, params[3], error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	if (!g_pJsonManager->WriteBinaryToFile(handle, format, path, error, sizeof(error))) {
+		return pContext->ThrowNativeError(error);
 	}
 
 	return true;
 }
 
-static cell_t json_ptr_set_integer64(IPluginContext* pContext, const cell_t* params)
+/**
+ * Helper function: Decode MessagePack or CBOR data from a plugin buffer
+ */
+static cell_t ParseBinaryFromPluginBuffer(IPluginContext* pContext, const cell_t* params, JSON_BINARY_FORMAT format)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
-	if (!handle) return 0;
-
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+	if (params[2] < 0) {
+		return pContext->ThrowNativeError("Invalid data length: %d", params[2]);
 	}
 
-	char* path, * value;
-	pContext->LocalToString(params[2], &path);
-	pContext->LocalToString(params[3], &value);
+	char* data;
+	pContext->LocalToString(params[1], &data);
+	bool is_mutable_doc = params[3];
 
-	std::variant<int64_t, uint64_t> variant_value;
 	char error[JSON_ERROR_BUFFER_SIZE];
+	JsonValue* pJSONValue = g_pJsonManager->ParseBinary(data, static_cast<size_t>(params[2]), format, is_mutable_doc, error, sizeof(error));
 
-	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
-	}
-
-	if (!g_pJsonManager->PtrSetInt64(handle, path, variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError(error);
 	}
 
-	return true;
+	return CreateAndReturnHandle(pContext, pJSONValue, "decoded JSON document");
 }
 
-static cell_t json_ptr_set_str(IPluginContext* pContext, const cell_t* params)
+static cell_t ParseBinaryFromPluginFile(IPluginContext* pContext, const cell_t* params, JSON_BINARY_FORMAT format)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	char* path;
+	pContext->LocalToString(params[1], &path);
+	bool is_mutable_doc = params[2];
 
-	if (!handle) return 0;
+	char error[JSON_ERROR_BUFFER_SIZE];
+	JsonValue* pJSONValue = g_pJsonManager->ParseBinaryFile(path, format, is_mutable_doc, error, sizeof(error));
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError(error);
 	}
 
-	char* path, * str;
-	pContext->LocalToString(params[2], &path);
-	pContext->LocalToString(params[3], &str);
-
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrSetString(handle, path, str, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
-	}
+	return CreateAndReturnHandle(pContext, pJSONValue, "decoded JSON document");
+}
 
-	return true;
+static cell_t json_doc_to_msgpack(IPluginContext* pContext, const cell_t* params)
+{
+	return WriteBinaryToPluginBuffer(pContext, params, JSON_BINARY_MSGPACK);
 }
 
-static cell_t json_ptr_set_null(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_to_msgpack_file(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	return WriteBinaryToPluginFile(pContext, params, JSON_BINARY_MSGPACK);
+}
 
-	if (!handle) return 0;
+static cell_t json_doc_from_msgpack(IPluginContext* pContext, const cell_t* params)
+{
+	return ParseBinaryFromPluginBuffer(pContext, params, JSON_BINARY_MSGPACK);
+}
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
-	}
+static cell_t json_doc_from_msgpack_file(IPluginContext* pContext, const cell_t* params)
+{
+	return ParseBinaryFromPluginFile(pContext, params, JSON_BINARY_MSGPACK);
+}
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
+static cell_t json_doc_to_cbor(IPluginContext* pContext, const cell_t* params)
+{
+	return WriteBinaryToPluginBuffer(pContext, params, JSON_BINARY_CBOR);
+}
 
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrSetNull(handle, path, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
-	}
+static cell_t json_doc_to_cbor_file(IPluginContext* pContext, const cell_t* params)
+{
+	return WriteBinaryToPluginFile(pContext, params, JSON_BINARY_CBOR);
+}
 
-	return true;
+static cell_t json_doc_from_cbor(IPluginContext* pContext, const cell_t* params)
+{
+	return ParseBinaryFromPluginBuffer(pContext, params, JSON_BINARY_CBOR);
 }
 
-static cell_t json_ptr_add_val(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_from_cbor_file(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[3]);
+	return ParseBinaryFromPluginFile(pContext, params, JSON_BINARY_CBOR);
+}
 
-	if (!handle1 || !handle2) return 0;
+static cell_t json_doc_save_snapshot(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
-	if (!handle1->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
-	}
+	if (!handle) return 0;
 
 	char* path;
 	pContext->LocalToString(params[2], &path);
 
 	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrAdd(handle1, path, handle2, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	if (!g_pJsonManager->SaveSnapshot(handle, path, error, sizeof(error))) {
+		return pContext->ThrowNativeError(error);
 	}
 
 	return true;
 }
 
-static cell_t json_ptr_add_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_doc_load_snapshot(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
-	if (!handle) return 0;
-
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
-	}
-
 	char* path;
-	pContext->LocalToString(params[2], &path);
+	pContext->LocalToString(params[1], &path);
 
 	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrAddBool(handle, path, params[3], error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	JsonValue* pJSONValue = g_pJsonManager->LoadSnapshot(path, error, sizeof(error));
+
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError(error);
 	}
 
-	return true;
+	return CreateAndReturnHandle(pContext, pJSONValue, "snapshot JSON document");
 }
 
-static cell_t json_ptr_add_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_get_size(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
-	}
-
-	char* path;
-	pContext->LocalToString(params[2], &path);
-
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrAddDouble(handle, path, sp_ctof(params[3]), error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
-	}
-
-	return true;
+	size_t size = g_pJsonManager->ObjectGetSize(handle);
+	return static_cast<cell_t>(size);
 }
 
-static cell_t json_ptr_add_int(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_get_key(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
 	}
+	size_t index = static_cast<size_t>(index_param);
+	const char* key;
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
-
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrAddInt(handle, path, params[3], error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	if (!g_pJsonManager->ObjectGetKey(handle, index, &key)) {
+		return pContext->ThrowNativeError("Index %d is out of bounds", index);
 	}
 
-	return true;
+	pContext->StringToLocalUTF8(params[3], params[4], key, nullptr);
+	return 1;
 }
 
-static cell_t json_ptr_add_integer64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_get_val_at(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
+	cell_t index_param = params[2];
+	if (index_param < 0) {
+		return pContext->ThrowNativeError("Index must be >= 0 (got %d)", index_param);
 	}
+	size_t index = static_cast<size_t>(index_param);
 
-	char* path, * value;
-	pContext->LocalToString(params[2], &path);
-	pContext->LocalToString(params[3], &value);
-
-	std::variant<int64_t, uint64_t> variant_value;
-	char error[JSON_ERROR_BUFFER_SIZE];
-
-	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
-	}
+	JsonValue* pJSONValue = g_pJsonManager->ObjectGetValueAt(handle, index);
 
-	if (!g_pJsonManager->PtrAddInt64(handle, path, variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Index %d is out of bounds", index);
 	}
 
-	return true;
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object value");
 }
 
-static cell_t json_ptr_add_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_get_val(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
-	}
+	char* key;
+	pContext->LocalToString(params[2], &key);
 
-	char* path, * str;
-	pContext->LocalToString(params[2], &path);
-	pContext->LocalToString(params[3], &str);
+	JsonValue* pJSONValue = g_pJsonManager->ObjectGet(handle, key);
 
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrAddString(handle, path, str, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Key not found: %s", key);
 	}
 
-	return true;
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON object value");
 }
 
-static cell_t json_ptr_add_null(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_get_bool(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
-	}
-
-	char* path;
-	pContext->LocalToString(params[2], &path);
+	char* key;
+	pContext->LocalToString(params[2], &key);
 
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrAddNull(handle, path, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	bool value;
+	if (!g_pJsonManager->ObjectGetBool(handle, key, &value)) {
+		return pContext->ThrowNativeError("Failed to get boolean for key '%s'", key);
 	}
 
-	return true;
+	return value;
 }
 
-static cell_t json_ptr_remove_val(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_get_float(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON document using pointer");
-	}
-
-	char* path;
-	pContext->LocalToString(params[2], &path);
+	char* key;
+	pContext->LocalToString(params[2], &key);
 
-	char error[JSON_ERROR_BUFFER_SIZE];
-	if (!g_pJsonManager->PtrRemove(handle, path, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	double value;
+	if (!g_pJsonManager->ObjectGetDouble(handle, key, &value)) {
+		return pContext->ThrowNativeError("Failed to get float for key '%s'", key);
 	}
 
-	return true;
+	return sp_ftoc(static_cast<float>(value));
 }
 
-static cell_t json_ptr_try_get_val(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_get_int(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 
 	if (!handle) return 0;
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
-
-	JsonValue* pJSONValue = g_pJsonManager->PtrTryGet(handle, path);
+	char* key;
+	pContext->LocalToString(params[2], &key);
 
-	if (!pJSONValue) {
-		return 0;
+	int value;
+	if (!g_pJsonManager->ObjectGetInt(handle, key, &value)) {
+		return pContext->ThrowNativeError("Failed to get integer for key '%s'", key);
 	}
 
-	return CreateAndAssignHandle(pContext, pJSONValue, params[3], "JSON pointer value");
+	return value;
 }
 
-static cell_t json_ptr_try_get_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_get_integer64(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
+	char* key;
+	pContext->LocalToString(params[2], &key);
 
-	bool value;
-	if (!g_pJsonManager->PtrTryGetBool(handle, path, &value)) {
-		return 0;
+	std::variant<int64_t, uint64_t> value;
+	if (!g_pJsonManager->ObjectGetInt64(handle, key, &value)) {
+		return pContext->ThrowNativeError("Failed to get integer64 for key '%s'", key);
 	}
 
-	cell_t* addr;
-	pContext->LocalToPhysAddr(params[3], &addr);
-	*addr = value;
+	char result[JSON_INT64_BUFFER_SIZE];
+	if (!Int64VariantToString(value, result, sizeof(result))) {
+		return pContext->ThrowNativeError("Failed to convert integer64 to string");
+	}
+	pContext->StringToLocalUTF8(params[3], params[4], result, nullptr);
 
 	return 1;
 }
 
-static cell_t json_ptr_try_get_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_get_str(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
+	char* key;
+	pContext->LocalToString(params[2], &key);
 
-	double value;
-	if (!g_pJsonManager->PtrTryGetDouble(handle, path, &value)) {
-		return 0;
+	const char* str;
+	size_t len;
+	if (!g_pJsonManager->ObjectGetString(handle, key, &str, &len)) {
+		return pContext->ThrowNativeError("Failed to get string for key '%s'", key);
 	}
 
-	cell_t* addr;
-	pContext->LocalToPhysAddr(params[3], &addr);
-	*addr = sp_ftoc(static_cast<float>(value));
+	size_t maxlen = static_cast<size_t>(params[4]);
+	if (len + 1 > maxlen) {
+		return pContext->ThrowNativeError("Buffer is too small (need %d, have %d)", len + 1, maxlen);
+	}
+
+	pContext->StringToLocalUTF8(params[3], maxlen, str, nullptr);
 
 	return 1;
 }
 
-static cell_t json_ptr_try_get_int(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_clear(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
-	char* path;
-	pContext->LocalToString(params[2], &path);
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot clear an immutable JSON object");
+	}
 
-	int value;
-	if (!g_pJsonManager->PtrTryGetInt(handle, path, &value)) {
-		return 0;
+	return g_pJsonManager->ObjectClear(handle);
+}
+
+static cell_t json_obj_is_null(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	char* key;
+	pContext->LocalToString(params[2], &key);
+
+	bool is_null;
+	if (!g_pJsonManager->ObjectIsNull(handle, key, &is_null)) {
+		return pContext->ThrowNativeError("Key not found: %s", key);
 	}
 
-	cell_t* addr;
-	pContext->LocalToPhysAddr(params[3], &addr);
-	*addr = value;
+	return is_null;
+}
 
-	return 1;
+static cell_t json_obj_has_key(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	char* key;
+	pContext->LocalToString(params[2], &key);
+
+	bool ptr_use = params[3];
+
+	return g_pJsonManager->ObjectHasKey(handle, key, ptr_use);
 }
 
-static cell_t json_ptr_try_get_integer64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_obj_rename_key(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot rename key in an immutable JSON object");
+	}
+
+	char* old_key;
+	pContext->LocalToString(params[2], &old_key);
+
+	char* new_key;
+	pContext->LocalToString(params[3], &new_key);
+
+	bool allow_duplicate = params[4];
+
+	if (!g_pJsonManager->ObjectRenameKey(handle, old_key, new_key, allow_duplicate)) {
+		return pContext->ThrowNativeError("Failed to rename key from '%s' to '%s'", old_key, new_key);
+	}
+
+	return true;
+}
+
+static cell_t json_obj_set_val(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[3]);
+
+	if (!handle1 || !handle2) return 0;
+
+	if (!handle1->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+	}
+
+	char* key;
+	pContext->LocalToString(params[2], &key);
+
+	return g_pJsonManager->ObjectSet(handle1, key, handle2);
+}
+
+static cell_t json_obj_set_bool(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+	}
+
+	char* key;
+	pContext->LocalToString(params[2], &key);
+
+	return g_pJsonManager->ObjectSetBool(handle, key, params[3]);
+}
+
+static cell_t json_obj_set_float(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+	}
+
+	char* key;
+	pContext->LocalToString(params[2], &key);
+
+	return g_pJsonManager->ObjectSetDouble(handle, key, sp_ctof(params[3]));
+}
+
+static cell_t json_obj_set_int(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+	}
+
+	char* key;
+	pContext->LocalToString(params[2], &key);
+
+	return g_pJsonManager->ObjectSetInt(handle, key, params[3]);
+}
+
+static cell_t json_obj_set_integer64(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+	}
+
+	char* key, * value;
+	pContext->LocalToString(params[2], &key);
+	pContext->LocalToString(params[3], &value);
+
+	std::variant<int64_t, uint64_t> variant_value;
+	char error[JSON_ERROR_BUFFER_SIZE];
+
+	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return g_pJsonManager->ObjectSetInt64(handle, key, variant_value);
+}
+
+static cell_t json_obj_set_null(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+	}
+
+	char* key;
+	pContext->LocalToString(params[2], &key);
+
+	return g_pJsonManager->ObjectSetNull(handle, key);
+}
+
+static cell_t json_obj_set_str(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON object");
+	}
+
+	char* key, * value;
+	pContext->LocalToString(params[2], &key);
+	pContext->LocalToString(params[3], &value);
+
+	return g_pJsonManager->ObjectSetString(handle, key, value);
+}
+
+static cell_t json_obj_remove(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON object");
+	}
+
+	char* key;
+	pContext->LocalToString(params[2], &key);
+
+	return g_pJsonManager->ObjectRemove(handle, key);
+}
+
+static cell_t json_ptr_get_val(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
 	char* path;
 	pContext->LocalToString(params[2], &path);
 
-	std::variant<int64_t, uint64_t> value;
-	if (!g_pJsonManager->PtrTryGetInt64(handle, path, &value)) {
-		return 0;
-	}
+	char error[JSON_ERROR_BUFFER_SIZE];
+	JsonValue* pJSONValue = g_pJsonManager->PtrGet(handle, path, error, sizeof(error));
 
-	size_t maxlen = static_cast<size_t>(params[4]);
-	char result[JSON_INT64_BUFFER_SIZE];
-	if (!Int64VariantToString(value, result, sizeof(result))) {
-		return 0;
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("%s", error);
 	}
-	pContext->StringToLocalUTF8(params[3], maxlen, result, nullptr);
-	return 1;
+
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON pointer value");
 }
 
-static cell_t json_ptr_try_get_str(IPluginContext* pContext, const cell_t* params)
+static cell_t json_ptr_get_bool(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
 	if (!handle) return 0;
 
 	char* path;
 	pContext->LocalToString(params[2], &path);
 
-	const char* str;
-	size_t len;
+	bool value;
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrGetBool(handle, path, &value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return value;
+}
+
+static cell_t json_ptr_get_float(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	double value;
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrGetDouble(handle, path, &value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return sp_ftoc(static_cast<float>(value));
+}
+
+static cell_t json_ptr_get_int(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	int value;
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrGetInt(handle, path, &value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return value;
+}
+
+static cell_t json_ptr_get_integer64(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	std::variant<int64_t, uint64_t> value;
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrGetInt64(handle, path, &value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	char result[JSON_INT64_BUFFER_SIZE];
+	if (!Int64VariantToString(value, result, sizeof(result))) {
+		return pContext->ThrowNativeError("Failed to convert integer64 to string");
+	}
+	pContext->StringToLocalUTF8(params[3], params[4], result, nullptr);
+
+	return 1;
+}
+
+static cell_t json_ptr_get_str(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	const char* str;
+	size_t len;
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrGetString(handle, path, &str, &len, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	size_t maxlen = static_cast<size_t>(params[4]);
+	if (len + 1 > maxlen) {
+		return pContext->ThrowNativeError("Buffer is too small (need %d, have %d)", len + 1, maxlen);
+	}
+
+	pContext->StringToLocalUTF8(params[3], maxlen, str, nullptr);
+
+	return 1;
+}
+
+static cell_t json_ptr_get_is_null(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	bool is_null;
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrGetIsNull(handle, path, &is_null, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return is_null;
+}
+
+static cell_t json_ptr_get_length(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	size_t len;
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrGetLength(handle, path, &len, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return static_cast<cell_t>(len);
+}
+
+static cell_t json_ptr_set_val(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[3]);
+
+	if (!handle1 || !handle2) return 0;
+
+	if (!handle1->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+	}
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrSet(handle1, path, handle2, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_set_bool(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+	}
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrSetBool(handle, path, params[3], error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_set_float(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+	}
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrSetDouble(handle, path, sp_ctof(params[3]), error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_set_int(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+	}
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrSetInt(handle, path, params[3], error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_set_integer64(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+	}
+
+	char* path, * value;
+	pContext->LocalToString(params[2], &path);
+	pContext->LocalToString(params[3], &value);
+
+	std::variant<int64_t, uint64_t> variant_value;
+	char error[JSON_ERROR_BUFFER_SIZE];
+
+	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	if (!g_pJsonManager->PtrSetInt64(handle, path, variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_set_str(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+	}
+
+	char* path, * str;
+	pContext->LocalToString(params[2], &path);
+	pContext->LocalToString(params[3], &str);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrSetString(handle, path, str, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_set_null(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot set value in an immutable JSON document using pointer");
+	}
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrSetNull(handle, path, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_add_val(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle1 = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* handle2 = g_pJsonManager->GetValueFromHandle(pContext, params[3]);
+
+	if (!handle1 || !handle2) return 0;
+
+	if (!handle1->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
+	}
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrAdd(handle1, path, handle2, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_add_bool(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
+	}
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrAddBool(handle, path, params[3], error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_add_float(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
+	}
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrAddDouble(handle, path, sp_ctof(params[3]), error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_add_int(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
+	}
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrAddInt(handle, path, params[3], error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_add_integer64(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
+	}
+
+	char* path, * value;
+	pContext->LocalToString(params[2], &path);
+	pContext->LocalToString(params[3], &value);
+
+	std::variant<int64_t, uint64_t> variant_value;
+	char error[JSON_ERROR_BUFFER_SIZE];
+
+	if (!g_pJsonManager->ParseInt64Variant(value, &variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	if (!g_pJsonManager->PtrAddInt64(handle, path, variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_add_str(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
+	}
+
+	char* path, * str;
+	pContext->LocalToString(params[2], &path);
+	pContext->LocalToString(params[3], &str);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrAddString(handle, path, str, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_add_null(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot add value to an immutable JSON document using pointer");
+	}
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrAddNull(handle, path, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_remove_val(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot remove value from an immutable JSON document using pointer");
+	}
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->PtrRemove(handle, path, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	return true;
+}
+
+static cell_t json_ptr_try_get_val(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	JsonValue* pJSONValue = g_pJsonManager->PtrTryGet(handle, path);
+
+	if (!pJSONValue) {
+		return 0;
+	}
+
+	return CreateAndAssignHandle(pContext, pJSONValue, params[3], "JSON pointer value");
+}
+
+static cell_t json_ptr_try_get_bool(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	bool value;
+	if (!g_pJsonManager->PtrTryGetBool(handle, path, &value)) {
+		return 0;
+	}
+
+	cell_t* addr;
+	pContext->LocalToPhysAddr(params[3], &addr);
+	*addr = value;
+
+	return 1;
+}
+
+static cell_t json_ptr_try_get_float(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	double value;
+	if (!g_pJsonManager->PtrTryGetDouble(handle, path, &value)) {
+		return 0;
+	}
+
+	cell_t* addr;
+	pContext->LocalToPhysAddr(params[3], &addr);
+	*addr = sp_ftoc(static_cast<float>(value));
+
+	return 1;
+}
+
+static cell_t json_ptr_try_get_int(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	int value;
+	if (!g_pJsonManager->PtrTryGetInt(handle, path, &value)) {
+		return 0;
+	}
+
+	cell_t* addr;
+	pContext->LocalToPhysAddr(params[3], &addr);
+	*addr = value;
+
+	return 1;
+}
+
+static cell_t json_ptr_try_get_integer64(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	std::variant<int64_t, uint64_t> value;
+	if (!g_pJsonManager->PtrTryGetInt64(handle, path, &value)) {
+		return 0;
+	}
+
+	size_t maxlen = static_cast<size_t>(params[4]);
+	char result[JSON_INT64_BUFFER_SIZE];
+	if (!Int64VariantToString(value, result, sizeof(result))) {
+		return 0;
+	}
+	pContext->StringToLocalUTF8(params[3], maxlen, result, nullptr);
+	return 1;
+}
+
+static cell_t json_ptr_try_get_str(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[2], &path);
+
+	const char* str;
+	size_t len;
+
+	if (!g_pJsonManager->PtrTryGetString(handle, path, &str, &len)) {
+		return 0;
+	}
+
+	size_t maxlen = static_cast<size_t>(params[4]);
+	if (len + 1 > maxlen) {
+		return 0;
+	}
+
+	pContext->StringToLocalUTF8(params[3], maxlen, str, nullptr);
+
+	return 1;
+}
+
+/**
+ * Helper function: Read the JSON handle of a node native and check the node
+ *
+ * @param pContext      Plugin context
+ * @param params        Native parameters, the handle and the node first
+ * @return JsonValue pointer, or nullptr on error (throws native error)
+ */
+static JsonValue* GetNodeHandle(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return nullptr;
+
+	if (!g_pJsonManager->IsImmutable(handle)) {
+		pContext->ThrowNativeError("Nodes are only available on immutable documents");
+		return nullptr;
+	}
+
+	if (!g_pJsonManager->IsValidNode(handle, params[2])) {
+		pContext->ThrowNativeError("Invalid node %d", params[2]);
+		return nullptr;
+	}
+
+	return handle;
+}
+
+static cell_t json_node_child(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	char* key;
+	pContext->LocalToString(params[3], &key);
+
+	return g_pJsonManager->NodeChild(handle, params[2], key);
+}
+
+static cell_t json_node_at(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	if (params[3] < 0) {
+		return -1;
+	}
+
+	return g_pJsonManager->NodeAt(handle, params[2], static_cast<size_t>(params[3]));
+}
+
+static cell_t json_node_find(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	char* path;
+	pContext->LocalToString(params[3], &path);
+
+	return g_pJsonManager->NodeFind(handle, params[2], path);
+}
+
+static cell_t json_node_get_type(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	return g_pJsonManager->NodeGetType(handle, params[2]);
+}
+
+static cell_t json_node_get_size(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	return static_cast<cell_t>(g_pJsonManager->NodeGetSize(handle, params[2]));
+}
+
+static cell_t json_node_get_bool(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	bool value;
+	if (!g_pJsonManager->NodeGetBool(handle, params[2], &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected boolean value");
+	}
+
+	return value;
+}
+
+static cell_t json_node_get_float(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	double value;
+	if (!g_pJsonManager->NodeGetDouble(handle, params[2], &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected float value");
+	}
+
+	return sp_ftoc(static_cast<float>(value));
+}
+
+static cell_t json_node_get_int(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	int value;
+	if (!g_pJsonManager->NodeGetInt(handle, params[2], &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected integer value");
+	}
+
+	return value;
+}
+
+static cell_t json_node_get_integer64(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	std::variant<int64_t, uint64_t> value;
+	if (!g_pJsonManager->NodeGetInt64(handle, params[2], &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected integer64 value");
+	}
+
+	char result[JSON_INT64_BUFFER_SIZE];
+	if (!Int64VariantToString(value, result, sizeof(result))) {
+		return pContext->ThrowNativeError("Failed to convert integer64 to string");
+	}
+	pContext->StringToLocalUTF8(params[3], params[4], result, nullptr);
+
+	return 1;
+}
+
+static cell_t json_node_get_str(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	const char* str;
+	size_t len;
+	if (!g_pJsonManager->NodeGetString(handle, params[2], &str, &len)) {
+		return pContext->ThrowNativeError("Type mismatch: expected string value");
+	}
+
+	size_t maxlen = static_cast<size_t>(params[4]);
+	if (len + 1 > maxlen) {
+		return pContext->ThrowNativeError("Buffer is too small (need %d, have %d)", len + 1, maxlen);
+	}
+
+	pContext->StringToLocalUTF8(params[3], maxlen, str, nullptr);
+
+	return 1;
+}
+
+static cell_t json_node_is_null(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	return g_pJsonManager->NodeIsNull(handle, params[2]);
+}
+
+static cell_t json_node_get_value(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = GetNodeHandle(pContext, params);
+	if (!handle) return 0;
+
+	return CreateAndReturnHandle(pContext, g_pJsonManager->NodeGetValue(handle, params[2]), "node value");
+}
+
+static cell_t json_obj_foreach(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	const char* key;
+	JsonValue* pJSONValue;
+
+	if (!g_pJsonManager->ObjectForeachNext(handle, &key, nullptr, &pJSONValue)) {
+		return false;
+	}
+
+	pContext->StringToLocalUTF8(params[2], params[3], key, nullptr);
+
+	return CreateAndAssignHandle(pContext, pJSONValue, params[4], "JSON object value");
+}
+
+static cell_t json_arr_foreach(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	size_t index;
+	JsonValue* pJSONValue;
+
+	if (!g_pJsonManager->ArrayForeachNext(handle, &index, &pJSONValue)) {
+		return false;
+	}
+
+	cell_t* indexPtr;
+	pContext->LocalToPhysAddr(params[2], &indexPtr);
+	*indexPtr = static_cast<cell_t>(index);
+
+	return CreateAndAssignHandle(pContext, pJSONValue, params[3], "JSON array value");
+}
+
+static cell_t json_obj_foreach_key(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	const char* key;
+
+	if (!g_pJsonManager->ObjectForeachKeyNext(handle, &key, nullptr)) {
+		return false;
+	}
+
+	pContext->StringToLocalUTF8(params[2], params[3], key, nullptr);
+
+	return true;
+}
+
+static cell_t json_arr_foreach_index(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	size_t index;
+
+	if (!g_pJsonManager->ArrayForeachIndexNext(handle, &index)) {
+		return false;
+	}
+
+	cell_t* indexPtr;
+	pContext->LocalToPhysAddr(params[2], &indexPtr);
+	*indexPtr = static_cast<cell_t>(index);
+
+	return true;
+}
+
+static cell_t json_arr_sort(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot sort an immutable JSON array");
+	}
+
+	JSON_SORT_ORDER sort_mode = static_cast<JSON_SORT_ORDER>(params[2]);
+	if (sort_mode < JSON_SORT_ASC || sort_mode > JSON_SORT_RANDOM) {
+		return pContext->ThrowNativeError("Invalid sort mode: %d (expected 0=ascending, 1=descending, 2=random)", sort_mode);
+	}
+
+	return g_pJsonManager->ArraySort(handle, sort_mode);
+}
+
+static cell_t json_arr_rotate(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot rotate an immutable JSON array");
+	}
+
+	size_t idx = static_cast<size_t>(params[2]);
+	return g_pJsonManager->ArrayRotate(handle, idx);
+}
+
+static cell_t json_obj_sort(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot sort an immutable JSON object");
+	}
+
+	JSON_SORT_ORDER sort_mode = static_cast<JSON_SORT_ORDER>(params[2]);
+	if (sort_mode < JSON_SORT_ASC || sort_mode > JSON_SORT_RANDOM) {
+		return pContext->ThrowNativeError("Invalid sort mode: %d (expected 0=ascending, 1=descending, 2=random)", sort_mode);
+	}
+
+	return g_pJsonManager->ObjectSort(handle, sort_mode);
+}
+
+static cell_t json_obj_rotate(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot rotate an immutable JSON object");
+	}
+
+	size_t idx = static_cast<size_t>(params[2]);
+	return g_pJsonManager->ObjectRotate(handle, idx);
+}
+
+static cell_t json_doc_to_mutable(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (handle->IsMutable()) {
+		return pContext->ThrowNativeError("Document is already mutable");
+	}
+
+	JsonValue* pJSONValue = g_pJsonManager->ToMutable(handle);
+
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Failed to convert to mutable document");
+	}
+
+	return CreateAndReturnHandle(pContext, pJSONValue, "mutable JSON document");
+}
+
+static cell_t json_doc_to_immutable(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+
+	if (!handle) return 0;
+
+	if (!handle->IsMutable()) {
+		return pContext->ThrowNativeError("Document is already immutable");
+	}
+
+	JsonValue* pJSONValue = g_pJsonManager->ToImmutable(handle);
+
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Failed to convert to immutable document");
+	}
+
+	return CreateAndReturnHandle(pContext, pJSONValue, "immutable JSON document");
+}
+
+static cell_t json_apply_json_patch(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* target = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* patch = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
+
+	if (!target || !patch) return 0;
+
+	bool resultMutable = params[3] != 0;
+	char error[JSON_ERROR_BUFFER_SIZE] = {0};
+
+	JsonValue* result = g_pJsonManager->ApplyJsonPatch(target, patch, resultMutable, error, sizeof(error));
+	if (!result) {
+		if (error[0] != '\0') {
+			return pContext->ThrowNativeError("%s", error);
+		}
+		return pContext->ThrowNativeError("Failed to apply JSON Patch");
+	}
+
+	return CreateAndReturnHandle(pContext, result, "JSON patch result");
+}
+
+static cell_t json_json_patch_in_place(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* target = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* patch = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
+
+	if (!target || !patch) return 0;
+
+	char error[JSON_ERROR_BUFFER_SIZE] = {0};
+	if (!g_pJsonManager->JsonPatchInPlace(target, patch, error, sizeof(error))) {
+		if (error[0] != '\0') {
+			return pContext->ThrowNativeError("%s", error);
+		}
+		return pContext->ThrowNativeError("Failed to apply JSON Patch in place");
+	}
+
+	return 1;
+}
+
+static cell_t json_apply_merge_patch(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* target = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* patch = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
+
+	if (!target || !patch) return 0;
+
+	bool resultMutable = params[3] != 0;
+	char error[JSON_ERROR_BUFFER_SIZE] = {0};
+
+	JsonValue* result = g_pJsonManager->ApplyMergePatch(target, patch, resultMutable, error, sizeof(error));
+	if (!result) {
+		if (error[0] != '\0') {
+			return pContext->ThrowNativeError("%s", error);
+		}
+		return pContext->ThrowNativeError("Failed to apply JSON Merge Patch");
+	}
+
+	return CreateAndReturnHandle(pContext, result, "JSON merge patch result");
+}
+
+static cell_t json_merge_patch_in_place(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* target = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* patch = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
+
+	if (!target || !patch) return 0;
+
+	char error[JSON_ERROR_BUFFER_SIZE] = {0};
+	if (!g_pJsonManager->MergePatchInPlace(target, patch, error, sizeof(error))) {
+		if (error[0] != '\0') {
+			return pContext->ThrowNativeError("%s", error);
+		}
+		return pContext->ThrowNativeError("Failed to apply JSON Merge Patch in place");
+	}
+
+	return 1;
+}
+
+static cell_t json_arr_iter_init(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	JsonArrIter* iter = g_pJsonManager->ArrIterWith(handle);
+	return CreateAndReturnArrIterHandle(pContext, iter, "array iterator");
+}
+
+static cell_t json_arr_iter_next(IPluginContext* pContext, const cell_t* params)
+{
+	JsonArrIter* iter = g_pJsonManager->GetArrIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	JsonValue* val = g_pJsonManager->ArrIterNext(iter);
+	if (!val) return 0;
+
+	return CreateAndReturnHandle(pContext, val, "array iterator value");
+}
+
+static cell_t json_arr_iter_has_next(IPluginContext* pContext, const cell_t* params)
+{
+	JsonArrIter* iter = g_pJsonManager->GetArrIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	return g_pJsonManager->ArrIterHasNext(iter);
+}
+
+static cell_t json_arr_iter_get_index(IPluginContext* pContext, const cell_t* params)
+{
+	JsonArrIter* iter = g_pJsonManager->GetArrIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	size_t index = g_pJsonManager->ArrIterGetIndex(iter);
+	if (index == SIZE_MAX) {
+		return -1;
+	}
+
+	return static_cast<cell_t>(index);
+}
+
+static cell_t json_arr_iter_remove(IPluginContext* pContext, const cell_t* params)
+{
+	JsonArrIter* iter = g_pJsonManager->GetArrIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	if (!iter->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot remove from immutable array iterator");
+	}
+
+	void* removed = g_pJsonManager->ArrIterRemove(iter);
+	return removed != nullptr;
+}
+
+static cell_t json_arr_iter_reset(IPluginContext* pContext, const cell_t* params)
+{
+	JsonArrIter* iter = g_pJsonManager->GetArrIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	return g_pJsonManager->ArrIterReset(iter);
+}
+
+static cell_t json_obj_iter_init(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	JsonObjIter* iter = g_pJsonManager->ObjIterWith(handle);
+	return CreateAndReturnObjIterHandle(pContext, iter, "object iterator");
+}
+
+static cell_t json_obj_iter_next(IPluginContext* pContext, const cell_t* params)
+{
+	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	void* key = g_pJsonManager->ObjIterNext(iter);
+	if (!key) return 0;
+
+	const char* key_str = nullptr;
+	if (!g_pJsonManager->ObjIterGetKeyString(iter, key, &key_str)) {
+		return 0;
+	}
+
+	pContext->StringToLocalUTF8(params[2], params[3], key_str ? key_str : "", nullptr);
+	return 1;
+}
+
+static cell_t json_obj_iter_has_next(IPluginContext* pContext, const cell_t* params)
+{
+	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	return g_pJsonManager->ObjIterHasNext(iter);
+}
+
+static cell_t json_obj_iter_get_val(IPluginContext* pContext, const cell_t* params)
+{
+	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	void* key = iter->m_currentKey;
+	if (!key) {
+		return pContext->ThrowNativeError("Iterator not positioned at a valid key (call Next() first)");
+	}
+
+	JsonValue* val = g_pJsonManager->ObjIterGetVal(iter, key);
+	if (!val) {
+		return pContext->ThrowNativeError("Failed to get value from iterator");
+	}
+
+	return CreateAndReturnHandle(pContext, val, "object iterator value");
+}
+
+static cell_t json_obj_iter_get(IPluginContext* pContext, const cell_t* params)
+{
+	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	char* key;
+	pContext->LocalToString(params[2], &key);
+
+	JsonValue* val = g_pJsonManager->ObjIterGet(iter, key);
+	if (!val) {
+		return pContext->ThrowNativeError("Failed to get value from iterator");
+	}
+
+	return CreateAndReturnHandle(pContext, val, "object iterator value");
+}
+
+static cell_t json_obj_iter_get_index(IPluginContext* pContext, const cell_t* params)
+{
+	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	size_t index = g_pJsonManager->ObjIterGetIndex(iter);
+	if (index == SIZE_MAX) {
+		return -1;
+	}
+
+	return static_cast<cell_t>(index);
+}
+
+static cell_t json_obj_iter_remove(IPluginContext* pContext, const cell_t* params)
+{
+	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	if (!iter->IsMutable()) {
+		return pContext->ThrowNativeError("Cannot remove from immutable object iterator");
+	}
+
+	void* removed = g_pJsonManager->ObjIterRemove(iter);
+	return removed != nullptr;
+}
+
+static cell_t json_obj_iter_reset(IPluginContext* pContext, const cell_t* params)
+{
+	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
+	if (!iter) return 0;
+
+	return g_pJsonManager->ObjIterReset(iter);
+}
+
+static cell_t json_read_number(IPluginContext* pContext, const cell_t* params)
+{
+	char* dat;
+	pContext->LocalToString(params[1], &dat);
+	uint32_t read_flg = static_cast<uint32_t>(params[2]);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	size_t consumed;
+	JsonValue* pJSONValue = g_pJsonManager->ReadNumber(dat, read_flg, error, sizeof(error), &consumed);
+
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("%s", error);
+	}
+
+	cell_t* consumedPtr = nullptr;
+	if (params[4] != 0) {
+		pContext->LocalToPhysAddr(params[4], &consumedPtr);
+		if (consumedPtr) {
+			*consumedPtr = static_cast<cell_t>(consumed);
+		}
+	}
+
+	return CreateAndReturnHandle(pContext, pJSONValue, "read number");
+}
+
+static cell_t json_write_number(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	cell_t buffer_size_param = params[3];
+	if (buffer_size_param <= 0) {
+		return pContext->ThrowNativeError("Buffer size must be > 0 (got %d)", buffer_size_param);
+	}
+
+	size_t buffer_size = static_cast<size_t>(buffer_size_param);
+	char* temp_buffer = (char*)malloc(buffer_size);
+	if (!temp_buffer) {
+		return pContext->ThrowNativeError("Failed to allocate buffer");
+	}
+
+	size_t written = 0;
+	if (!g_pJsonManager->WriteNumber(handle, temp_buffer, buffer_size, &written)) {
+		free(temp_buffer);
+		return pContext->ThrowNativeError("Failed to write number or buffer too small");
+	}
+
+	pContext->StringToLocalUTF8(params[2], buffer_size, temp_buffer, nullptr);
+	free(temp_buffer);
+
+	cell_t* writtenPtr = nullptr;
+	if (params[4] != 0) {
+		pContext->LocalToPhysAddr(params[4], &writtenPtr);
+		if (writtenPtr) {
+			*writtenPtr = static_cast<cell_t>(written);
+		}
+	}
+
+	return 1;
+}
+
+static cell_t json_set_fp_to_float(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
+
+	bool flt = params[2] != 0;
+	if (!g_pJsonManager->SetFpToFloat(handle, flt)) {
+		return pContext->ThrowNativeError("Failed to set floating-point format to float (value is not a floating-point number)");
+	}
+
+	return 1;
+}
+
+static cell_t json_set_fp_to_fixed(IPluginContext* pContext, const cell_t* params)
+{
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
 
-	if (!g_pJsonManager->PtrTryGetString(handle, path, &str, &len)) {
-		return 0;
+	int prec = params[2];
+	if (prec < 1 || prec > 7) {
+		return pContext->ThrowNativeError("Precision out of range (1-7)");
 	}
 
-	size_t maxlen = static_cast<size_t>(params[4]);
-	if (len + 1 > maxlen) {
-		return 0;
+	if (!g_pJsonManager->SetFpToFixed(handle, prec)) {
+		return pContext->ThrowNativeError("Failed to set floating-point format to fixed (value is not a floating-point number or precision out of range 1-7)");
 	}
 
-	pContext->StringToLocalUTF8(params[3], maxlen, str, nullptr);
-
 	return 1;
 }
 
-static cell_t json_obj_foreach(IPluginContext* pContext, const cell_t* params)
+static cell_t json_set_bool(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 	if (!handle) return 0;
 
-	const char* key;
-	JsonValue* pJSONValue;
-
-	if (!g_pJsonManager->ObjectForeachNext(handle, &key, nullptr, &pJSONValue)) {
-		return false;
+	bool value = params[2] != 0;
+	if (!g_pJsonManager->SetBool(handle, value)) {
+		return pContext->ThrowNativeError("Failed to set value to boolean (value is object or array)");
 	}
 
-	pContext->StringToLocalUTF8(params[2], params[3], key, nullptr);
-
-	return CreateAndAssignHandle(pContext, pJSONValue, params[4], "JSON object value");
+	return 1;
 }
 
-static cell_t json_arr_foreach(IPluginContext* pContext, const cell_t* params)
+static cell_t json_set_int(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 	if (!handle) return 0;
 
-	size_t index;
-	JsonValue* pJSONValue;
-
-	if (!g_pJsonManager->ArrayForeachNext(handle, &index, &pJSONValue)) {
-		return false;
+	int value = params[2];
+	if (!g_pJsonManager->SetInt(handle, value)) {
+		return pContext->ThrowNativeError("Failed to set value to integer (value is object or array)");
 	}
 
-	cell_t* indexPtr;
-	pContext->LocalToPhysAddr(params[2], &indexPtr);
-	*indexPtr = static_cast<cell_t>(index);
-
-	return CreateAndAssignHandle(pContext, pJSONValue, params[3], "JSON array value");
+	return 1;
 }
 
-static cell_t json_obj_foreach_key(IPluginContext* pContext, const cell_t* params)
+static cell_t json_set_int64(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 	if (!handle) return 0;
 
-	const char* key;
+	char* str;
+	pContext->LocalToString(params[2], &str);
 
-	if (!g_pJsonManager->ObjectForeachKeyNext(handle, &key, nullptr)) {
-		return false;
+	std::variant<int64_t, uint64_t> variant_value;
+	char error[JSON_ERROR_BUFFER_SIZE];
+
+	if (!g_pJsonManager->ParseInt64Variant(str, &variant_value, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
 	}
 
-	pContext->StringToLocalUTF8(params[2], params[3], key, nullptr);
+	if (!g_pJsonManager->SetInt64(handle, variant_value)) {
+		return pContext->ThrowNativeError("Failed to set value to int64 (value is object or array)");
+	}
 
-	return true;
+	return 1;
 }
 
-static cell_t json_arr_foreach_index(IPluginContext* pContext, const cell_t* params)
+static cell_t json_set_float(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
 	if (!handle) return 0;
 
-	size_t index;
-
-	if (!g_pJsonManager->ArrayForeachIndexNext(handle, &index)) {
-		return false;
+	if (!g_pJsonManager->SetDouble(handle, sp_ctof(params[2]))) {
+		return pContext->ThrowNativeError("Failed to set value to float (value is object or array)");
 	}
 
-	cell_t* indexPtr;
-	pContext->LocalToPhysAddr(params[2], &indexPtr);
-	*indexPtr = static_cast<cell_t>(index);
-
-	return true;
+	return 1;
 }
 
-static cell_t json_arr_sort(IPluginContext* pContext, const cell_t* params)
+static cell_t json_set_string(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot sort an immutable JSON array");
-	}
+	char* value;
+	pContext->LocalToString(params[2], &value);
 
-	JSON_SORT_ORDER sort_mode = static_cast<JSON_SORT_ORDER>(params[2]);
-	if (sort_mode < JSON_SORT_ASC || sort_mode > JSON_SORT_RANDOM) {
-		return pContext->ThrowNativeError("Invalid sort mode: %d (expected 0=ascending, 1=descending, 2=random)", sort_mode);
+	if (!g_pJsonManager->SetString(handle, value)) {
+		return pContext->ThrowNativeError("Failed to set value to string (value is object or array)");
 	}
 
-	return g_pJsonManager->ArraySort(handle, sort_mode);
+	return 1;
 }
 
-static cell_t json_arr_rotate(IPluginContext* pContext, const cell_t* params)
+static cell_t json_set_null(IPluginContext* pContext, const cell_t* params)
 {
 	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
 	if (!handle) return 0;
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot rotate an immutable JSON array");
+	if (!g_pJsonManager->SetNull(handle)) {
+		return pContext->ThrowNativeError("Failed to set value to null (value is object or array)");
 	}
 
-	size_t idx = static_cast<size_t>(params[2]);
-	return g_pJsonManager->ArrayRotate(handle, idx);
+	return 1;
 }
 
-static cell_t json_obj_sort(IPluginContext* pContext, const cell_t* params)
+/**
+ * Helper function: Create a SourceMod handle for JsonStreamParser and return it directly
+ */
+static cell_t CreateAndReturnStreamParserHandle(IPluginContext* pContext, JsonStreamParser* parser, const char* error_context)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!parser) {
+		return pContext->ThrowNativeError("Failed to create %s", error_context);
+	}
 
-	if (!handle) return 0;
+	HandleError err;
+	HandleSecurity sec(pContext->GetIdentity(), myself->GetIdentity());
+	parser->m_handle = handlesys->CreateHandleEx(g_StreamParserType, parser, &sec, nullptr, &err);
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot sort an immutable JSON object");
+	if (!parser->m_handle) {
+		g_pJsonManager->ReleaseStreamParser(parser);
+		return pContext->ThrowNativeError("Failed to create handle for %s (error code: %d)", error_context, err);
 	}
 
-	JSON_SORT_ORDER sort_mode = static_cast<JSON_SORT_ORDER>(params[2]);
-	if (sort_mode < JSON_SORT_ASC || sort_mode > JSON_SORT_RANDOM) {
-		return pContext->ThrowNativeError("Invalid sort mode: %d (expected 0=ascending, 1=descending, 2=random)", sort_mode);
+	return parser->m_handle;
+}
+
+static cell_t json_stream_parser_create(IPluginContext* pContext, const cell_t* params)
+{
+	uint32_t read_flg = static_cast<uint32_t>(params[1]);
+	cell_t expected_size = params[2];
+
+	if (expected_size < 0) {
+		return pContext->ThrowNativeError("Invalid expected size: %d", expected_size);
 	}
 
-	return g_pJsonManager->ObjectSort(handle, sort_mode);
+	JsonStreamParser* parser = g_pJsonManager->StreamParserCreate(read_flg, static_cast<size_t>(expected_size));
+	return CreateAndReturnStreamParserHandle(pContext, parser, "stream parser");
 }
 
-static cell_t json_obj_rotate(IPluginContext* pContext, const cell_t* params)
+static cell_t json_stream_parser_feed(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonStreamParser* parser = g_pJsonManager->GetStreamParserFromHandle(pContext, params[1]);
+	if (!parser) return 0;
 
-	if (!handle) return 0;
+	char* buffer;
+	pContext->LocalToString(params[2], &buffer);
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot rotate an immutable JSON object");
+	cell_t length = params[3];
+	size_t len = length < 0 ? strlen(buffer) : static_cast<size_t>(length);
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	if (!g_pJsonManager->StreamParserFeed(parser, buffer, len, error, sizeof(error))) {
+		return pContext->ThrowNativeError("%s", error);
 	}
 
-	size_t idx = static_cast<size_t>(params[2]);
-	return g_pJsonManager->ObjectRotate(handle, idx);
+	return 1;
 }
 
-static cell_t json_doc_to_mutable(IPluginContext* pContext, const cell_t* params)
+static cell_t json_stream_parser_finish(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-
-	if (!handle) return 0;
+	JsonStreamParser* parser = g_pJsonManager->GetStreamParserFromHandle(pContext, params[1]);
+	if (!parser) return 0;
 
-	if (handle->IsMutable()) {
-		return pContext->ThrowNativeError("Document is already mutable");
-	}
+	bool is_mutable_doc = params[2];
 
-	JsonValue* pJSONValue = g_pJsonManager->ToMutable(handle);
+	char error[JSON_ERROR_BUFFER_SIZE];
+	JsonValue* pJSONValue = g_pJsonManager->StreamParserFinish(parser, is_mutable_doc, error, sizeof(error));
 
 	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Failed to convert to mutable document");
+		return pContext->ThrowNativeError("%s", error);
 	}
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "mutable JSON document");
+	return CreateAndReturnHandle(pContext, pJSONValue, "streamed JSON document");
 }
 
-static cell_t json_doc_to_immutable(IPluginContext* pContext, const cell_t* params)
+static cell_t json_stream_parser_is_complete(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonStreamParser* parser = g_pJsonManager->GetStreamParserFromHandle(pContext, params[1]);
+	if (!parser) return 0;
 
-	if (!handle) return 0;
+	return g_pJsonManager->StreamParserIsComplete(parser);
+}
 
-	if (!handle->IsMutable()) {
-		return pContext->ThrowNativeError("Document is already immutable");
+/**
+ * Helper function: Create a SourceMod handle for JsonLinesReader and return it directly
+ */
+static cell_t CreateAndReturnLinesReaderHandle(IPluginContext* pContext, JsonLinesReader* reader, const char* error_context)
+{
+	if (!reader) {
+		return pContext->ThrowNativeError("Failed to create %s", error_context);
 	}
 
-	JsonValue* pJSONValue = g_pJsonManager->ToImmutable(handle);
+	HandleError err;
+	HandleSecurity sec(pContext->GetIdentity(), myself->GetIdentity());
+	reader->m_handle = handlesys->CreateHandleEx(g_LinesReaderType, reader, &sec, nullptr, &err);
 
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("Failed to convert to immutable document");
+	if (!reader->m_handle) {
+		g_pJsonManager->ReleaseLinesReader(reader);
+		return pContext->ThrowNativeError("Failed to create handle for %s (error code: %d)", error_context, err);
 	}
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "immutable JSON document");
+	return reader->m_handle;
 }
 
-static cell_t json_apply_json_patch(IPluginContext* pContext, const cell_t* params)
+static cell_t json_lines_reader_open(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* target = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	JsonValue* patch = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
+	char* path;
+	pContext->LocalToString(params[1], &path);
 
-	if (!target || !patch) return 0;
+	uint32_t read_flg = static_cast<uint32_t>(params[2]);
+	cell_t buffer_size = params[3];
+	bool pooled = params[4];
 
-	bool resultMutable = params[3] != 0;
-	char error[JSON_ERROR_BUFFER_SIZE] = {0};
+	if (buffer_size <= 0) {
+		return pContext->ThrowNativeError("Invalid buffer size: %d", buffer_size);
+	}
 
-	JsonValue* result = g_pJsonManager->ApplyJsonPatch(target, patch, resultMutable, error, sizeof(error));
-	if (!result) {
-		if (error[0] != '\0') {
-			return pContext->ThrowNativeError("%s", error);
-		}
-		return pContext->ThrowNativeError("Failed to apply JSON Patch");
+	char error[JSON_ERROR_BUFFER_SIZE];
+	JsonLinesReader* reader = g_pJsonManager->LinesReaderOpen(path, read_flg, static_cast<size_t>(buffer_size), pooled, error, sizeof(error));
+	if (!reader) {
+		return pContext->ThrowNativeError("%s", error);
 	}
 
-	return CreateAndReturnHandle(pContext, result, "JSON patch result");
+	return CreateAndReturnLinesReaderHandle(pContext, reader, "JSON Lines reader");
 }
 
-static cell_t json_json_patch_in_place(IPluginContext* pContext, const cell_t* params)
+static cell_t json_lines_reader_next(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* target = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	JsonValue* patch = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
+	JsonLinesReader* reader = g_pJsonManager->GetLinesReaderFromHandle(pContext, params[1]);
+	if (!reader) return 0;
 
-	if (!target || !patch) return 0;
+	bool is_mutable_doc = params[2];
 
-	char error[JSON_ERROR_BUFFER_SIZE] = {0};
-	if (!g_pJsonManager->JsonPatchInPlace(target, patch, error, sizeof(error))) {
-		if (error[0] != '\0') {
+	char error[JSON_ERROR_BUFFER_SIZE];
+	JsonValue* pJSONValue = g_pJsonManager->LinesReaderNext(reader, is_mutable_doc, error, sizeof(error));
+
+	if (!pJSONValue) {
+		if (g_pJsonManager->LinesReaderIsEOF(reader)) {
+			return 0;
+		}
+		if (params[4] <= 0) {
 			return pContext->ThrowNativeError("%s", error);
 		}
-		return pContext->ThrowNativeError("Failed to apply JSON Patch in place");
+		pContext->StringToLocalUTF8(params[3], params[4], error, nullptr);
+		return 0;
 	}
 
-	return 1;
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON Lines document");
 }
 
-static cell_t json_apply_merge_patch(IPluginContext* pContext, const cell_t* params)
+static cell_t json_lines_reader_skip(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* target = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	JsonValue* patch = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
+	JsonLinesReader* reader = g_pJsonManager->GetLinesReaderFromHandle(pContext, params[1]);
+	if (!reader) return 0;
 
-	if (!target || !patch) return 0;
+	if (params[2] < 0) {
+		return pContext->ThrowNativeError("Invalid line count: %d", params[2]);
+	}
 
-	bool resultMutable = params[3] != 0;
-	char error[JSON_ERROR_BUFFER_SIZE] = {0};
+	return static_cast<cell_t>(g_pJsonManager->LinesReaderSkip(reader, static_cast<size_t>(params[2])));
+}
 
-	JsonValue* result = g_pJsonManager->ApplyMergePatch(target, patch, resultMutable, error, sizeof(error));
-	if (!result) {
-		if (error[0] != '\0') {
-			return pContext->ThrowNativeError("%s", error);
-		}
-		return pContext->ThrowNativeError("Failed to apply JSON Merge Patch");
+static cell_t json_lines_reader_seek(IPluginContext* pContext, const cell_t* params)
+{
+	JsonLinesReader* reader = g_pJsonManager->GetLinesReaderFromHandle(pContext, params[1]);
+	if (!reader) return 0;
+
+	if (params[2] < 0) {
+		return pContext->ThrowNativeError("Invalid line number: %d", params[2]);
 	}
 
-	return CreateAndReturnHandle(pContext, result, "JSON merge patch result");
+	return g_pJsonManager->LinesReaderSeekLine(reader, static_cast<size_t>(params[2]));
 }
 
-static cell_t json_merge_patch_in_place(IPluginContext* pContext, const cell_t* params)
+static cell_t json_lines_reader_seek_offset(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* target = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	JsonValue* patch = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
-
-	if (!target || !patch) return 0;
+	JsonLinesReader* reader = g_pJsonManager->GetLinesReaderFromHandle(pContext, params[1]);
+	if (!reader) return 0;
 
-	char error[JSON_ERROR_BUFFER_SIZE] = {0};
-	if (!g_pJsonManager->MergePatchInPlace(target, patch, error, sizeof(error))) {
-		if (error[0] != '\0') {
-			return pContext->ThrowNativeError("%s", error);
-		}
-		return pContext->ThrowNativeError("Failed to apply JSON Merge Patch in place");
+	if (params[2] < 0 || params[3] < 0) {
+		return pContext->ThrowNativeError("Invalid offset %d or line number %d", params[2], params[3]);
 	}
 
-	return 1;
+	return g_pJsonManager->LinesReaderSeekOffset(reader, static_cast<uint64_t>(params[2]), static_cast<size_t>(params[3]));
 }
 
-static cell_t json_arr_iter_init(IPluginContext* pContext, const cell_t* params)
+static cell_t json_lines_reader_get_line(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
+	JsonLinesReader* reader = g_pJsonManager->GetLinesReaderFromHandle(pContext, params[1]);
+	if (!reader) return 0;
 
-	JsonArrIter* iter = g_pJsonManager->ArrIterWith(handle);
-	return CreateAndReturnArrIterHandle(pContext, iter, "array iterator");
+	return static_cast<cell_t>(g_pJsonManager->LinesReaderGetLine(reader));
 }
 
-static cell_t json_arr_iter_next(IPluginContext* pContext, const cell_t* params)
+static cell_t json_lines_reader_get_offset(IPluginContext* pContext, const cell_t* params)
 {
-	JsonArrIter* iter = g_pJsonManager->GetArrIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
+	JsonLinesReader* reader = g_pJsonManager->GetLinesReaderFromHandle(pContext, params[1]);
+	if (!reader) return 0;
 
-	JsonValue* val = g_pJsonManager->ArrIterNext(iter);
-	if (!val) return 0;
+	uint64_t offset = g_pJsonManager->LinesReaderGetOffset(reader);
+	if (offset > INT32_MAX) {
+		return -1;
+	}
 
-	return CreateAndReturnHandle(pContext, val, "array iterator value");
+	return static_cast<cell_t>(offset);
 }
 
-static cell_t json_arr_iter_has_next(IPluginContext* pContext, const cell_t* params)
+static cell_t json_lines_reader_is_eof(IPluginContext* pContext, const cell_t* params)
 {
-	JsonArrIter* iter = g_pJsonManager->GetArrIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
+	JsonLinesReader* reader = g_pJsonManager->GetLinesReaderFromHandle(pContext, params[1]);
+	if (!reader) return 0;
 
-	return g_pJsonManager->ArrIterHasNext(iter);
+	return g_pJsonManager->LinesReaderIsEOF(reader);
 }
 
-static cell_t json_arr_iter_get_index(IPluginContext* pContext, const cell_t* params)
+static cell_t json_lines_writer_open(IPluginContext* pContext, const cell_t* params)
 {
-	JsonArrIter* iter = g_pJsonManager->GetArrIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
+	char* path;
+	pContext->LocalToString(params[1], &path);
 
-	size_t index = g_pJsonManager->ArrIterGetIndex(iter);
-	if (index == SIZE_MAX) {
-		return -1;
+	uint32_t write_flg = static_cast<uint32_t>(params[2]);
+	cell_t rotate_size = params[3];
+	cell_t rotate_interval = params[4];
+	cell_t flush_interval_ms = params[5];
+	cell_t buffer_limit = params[6];
+
+	if (rotate_size < 0 || rotate_interval < 0) {
+		return pContext->ThrowNativeError("Invalid rotation size %d or interval %d", rotate_size, rotate_interval);
+	}
+
+	if (flush_interval_ms <= 0 || buffer_limit <= 0) {
+		return pContext->ThrowNativeError("Invalid flush interval %d or buffer limit %d", flush_interval_ms, buffer_limit);
+	}
+
+	char error[JSON_ERROR_BUFFER_SIZE];
+	JsonLinesWriter* writer = g_pJsonManager->LinesWriterOpen(path, write_flg, static_cast<size_t>(rotate_size),
+		static_cast<uint32_t>(rotate_interval), static_cast<uint32_t>(flush_interval_ms), static_cast<size_t>(buffer_limit),
+		error, sizeof(error));
+	if (!writer) {
+		return pContext->ThrowNativeError("%s", error);
 	}
 
-	return static_cast<cell_t>(index);
-}
-
-static cell_t json_arr_iter_remove(IPluginContext* pContext, const cell_t* params)
-{
-	JsonArrIter* iter = g_pJsonManager->GetArrIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
+	HandleError err;
+	HandleSecurity sec(pContext->GetIdentity(), myself->GetIdentity());
+	Handle_t handle = handlesys->CreateHandleEx(g_LinesWriterType, writer, &sec, nullptr, &err);
 
-	if (!iter->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot remove from immutable array iterator");
+	if (!handle) {
+		g_pJsonManager->ReleaseLinesWriter(writer);
+		return pContext->ThrowNativeError("Failed to create handle for JSON Lines writer (error code: %d)", err);
 	}
 
-	void* removed = g_pJsonManager->ArrIterRemove(iter);
-	return removed != nullptr;
+	return handle;
 }
 
-static cell_t json_arr_iter_reset(IPluginContext* pContext, const cell_t* params)
+static cell_t json_lines_writer_append(IPluginContext* pContext, const cell_t* params)
 {
-	JsonArrIter* iter = g_pJsonManager->GetArrIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
-
-	return g_pJsonManager->ArrIterReset(iter);
-}
+	JsonLinesWriter* writer = g_pJsonManager->GetLinesWriterFromHandle(pContext, params[1]);
+	if (!writer) return 0;
 
-static cell_t json_obj_iter_init(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[2]);
 	if (!handle) return 0;
 
-	JsonObjIter* iter = g_pJsonManager->ObjIterWith(handle);
-	return CreateAndReturnObjIterHandle(pContext, iter, "object iterator");
+	return g_pJsonManager->LinesWriterAppend(writer, handle);
 }
 
-static cell_t json_obj_iter_next(IPluginContext* pContext, const cell_t* params)
+static cell_t json_lines_writer_flush(IPluginContext* pContext, const cell_t* params)
 {
-	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
+	JsonLinesWriter* writer = g_pJsonManager->GetLinesWriterFromHandle(pContext, params[1]);
+	if (!writer) return 0;
 
-	void* key = g_pJsonManager->ObjIterNext(iter);
-	if (!key) return 0;
+	g_pJsonManager->LinesWriterFlush(writer, params[2] != 0);
+	return 1;
+}
 
-	const char* key_str = nullptr;
-	if (!g_pJsonManager->ObjIterGetKeyString(iter, key, &key_str)) {
-		return 0;
-	}
+static cell_t json_lines_writer_get_dropped(IPluginContext* pContext, const cell_t* params)
+{
+	JsonLinesWriter* writer = g_pJsonManager->GetLinesWriterFromHandle(pContext, params[1]);
+	if (!writer) return 0;
 
-	pContext->StringToLocalUTF8(params[2], params[3], key_str ? key_str : "", nullptr);
-	return 1;
+	uint64_t dropped = g_pJsonManager->LinesWriterGetDropped(writer);
+	return static_cast<cell_t>(dropped > INT32_MAX ? INT32_MAX : dropped);
 }
 
-static cell_t json_obj_iter_has_next(IPluginContext* pContext, const cell_t* params)
+static cell_t json_lines_writer_get_written(IPluginContext* pContext, const cell_t* params)
 {
-	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
+	JsonLinesWriter* writer = g_pJsonManager->GetLinesWriterFromHandle(pContext, params[1]);
+	if (!writer) return 0;
 
-	return g_pJsonManager->ObjIterHasNext(iter);
+	uint64_t written = g_pJsonManager->LinesWriterGetWritten(writer);
+	return static_cast<cell_t>(written > INT32_MAX ? INT32_MAX : written);
 }
 
-static cell_t json_obj_iter_get_val(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_create(IPluginContext* pContext, const cell_t* params)
 {
-	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
+	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
+	if (!handle) return 0;
 
-	void* key = iter->m_currentKey;
-	if (!key) {
-		return pContext->ThrowNativeError("Iterator not positioned at a valid key (call Next() first)");
+	JsonCursor* cursor = g_pJsonManager->CursorCreate(handle);
+	if (!cursor) {
+		return pContext->ThrowNativeError("Failed to create JSON cursor");
 	}
 
-	JsonValue* val = g_pJsonManager->ObjIterGetVal(iter, key);
-	if (!val) {
-		return pContext->ThrowNativeError("Failed to get value from iterator");
+	HandleError err;
+	HandleSecurity sec(pContext->GetIdentity(), myself->GetIdentity());
+	Handle_t hndl = handlesys->CreateHandleEx(g_CursorType, cursor, &sec, nullptr, &err);
+
+	if (!hndl) {
+		g_pJsonManager->ReleaseCursor(cursor);
+		return pContext->ThrowNativeError("Failed to create handle for JSON cursor (error code: %d)", err);
 	}
 
-	return CreateAndReturnHandle(pContext, val, "object iterator value");
+	return hndl;
 }
 
-static cell_t json_obj_iter_get(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_enter(IPluginContext* pContext, const cell_t* params)
 {
-	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
 	char* key;
 	pContext->LocalToString(params[2], &key);
 
-	JsonValue* val = g_pJsonManager->ObjIterGet(iter, key);
-	if (!val) {
-		return pContext->ThrowNativeError("Failed to get value from iterator");
-	}
-
-	return CreateAndReturnHandle(pContext, val, "object iterator value");
+	return g_pJsonManager->CursorEnter(cursor, key);
 }
 
-static cell_t json_obj_iter_get_index(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_enter_index(IPluginContext* pContext, const cell_t* params)
 {
-	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	size_t index = g_pJsonManager->ObjIterGetIndex(iter);
-	if (index == SIZE_MAX) {
-		return -1;
+	if (params[2] < 0) {
+		return 0;
 	}
 
-	return static_cast<cell_t>(index);
+	return g_pJsonManager->CursorEnterIndex(cursor, static_cast<size_t>(params[2]));
 }
 
-static cell_t json_obj_iter_remove(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_pointer(IPluginContext* pContext, const cell_t* params)
 {
-	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	if (!iter->IsMutable()) {
-		return pContext->ThrowNativeError("Cannot remove from immutable object iterator");
-	}
+	char* path;
+	pContext->LocalToString(params[2], &path);
 
-	void* removed = g_pJsonManager->ObjIterRemove(iter);
-	return removed != nullptr;
+	return g_pJsonManager->CursorPointer(cursor, path);
 }
 
-static cell_t json_obj_iter_reset(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_parent(IPluginContext* pContext, const cell_t* params)
 {
-	JsonObjIter* iter = g_pJsonManager->GetObjIterFromHandle(pContext, params[1]);
-	if (!iter) return 0;
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	return g_pJsonManager->ObjIterReset(iter);
+	return g_pJsonManager->CursorParent(cursor);
 }
 
-static cell_t json_read_number(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_reset(IPluginContext* pContext, const cell_t* params)
 {
-	char* dat;
-	pContext->LocalToString(params[1], &dat);
-	uint32_t read_flg = static_cast<uint32_t>(params[2]);
-
-	char error[JSON_ERROR_BUFFER_SIZE];
-	size_t consumed;
-	JsonValue* pJSONValue = g_pJsonManager->ReadNumber(dat, read_flg, error, sizeof(error), &consumed);
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	if (!pJSONValue) {
-		return pContext->ThrowNativeError("%s", error);
-	}
+	g_pJsonManager->CursorReset(cursor);
+	return 1;
+}
 
-	cell_t* consumedPtr = nullptr;
-	if (params[4] != 0) {
-		pContext->LocalToPhysAddr(params[4], &consumedPtr);
-		if (consumedPtr) {
-			*consumedPtr = static_cast<cell_t>(consumed);
-		}
-	}
+static cell_t json_cursor_get_depth(IPluginContext* pContext, const cell_t* params)
+{
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	return CreateAndReturnHandle(pContext, pJSONValue, "read number");
+	return static_cast<cell_t>(g_pJsonManager->CursorGetDepth(cursor));
 }
 
-static cell_t json_write_number(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_get_type(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	cell_t buffer_size_param = params[3];
-	if (buffer_size_param <= 0) {
-		return pContext->ThrowNativeError("Buffer size must be > 0 (got %d)", buffer_size_param);
-	}
+	return g_pJsonManager->GetType(g_pJsonManager->CursorGetCurrent(cursor));
+}
 
-	size_t buffer_size = static_cast<size_t>(buffer_size_param);
-	char* temp_buffer = (char*)malloc(buffer_size);
-	if (!temp_buffer) {
-		return pContext->ThrowNativeError("Failed to allocate buffer");
-	}
+static cell_t json_cursor_get_size(IPluginContext* pContext, const cell_t* params)
+{
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	size_t written = 0;
-	if (!g_pJsonManager->WriteNumber(handle, temp_buffer, buffer_size, &written)) {
-		free(temp_buffer);
-		return pContext->ThrowNativeError("Failed to write number or buffer too small");
+	JsonValue* current = g_pJsonManager->CursorGetCurrent(cursor);
+	if (g_pJsonManager->IsObject(current)) {
+		return static_cast<cell_t>(g_pJsonManager->ObjectGetSize(current));
 	}
+	if (g_pJsonManager->IsArray(current)) {
+		return static_cast<cell_t>(g_pJsonManager->ArrayGetSize(current));
+	}
+	return 0;
+}
 
-	pContext->StringToLocalUTF8(params[2], buffer_size, temp_buffer, nullptr);
-	free(temp_buffer);
+static cell_t json_cursor_has_key(IPluginContext* pContext, const cell_t* params)
+{
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	cell_t* writtenPtr = nullptr;
-	if (params[4] != 0) {
-		pContext->LocalToPhysAddr(params[4], &writtenPtr);
-		if (writtenPtr) {
-			*writtenPtr = static_cast<cell_t>(written);
-		}
-	}
+	char* key;
+	pContext->LocalToString(params[2], &key);
 
-	return 1;
+	return g_pJsonManager->ObjectHasKey(g_pJsonManager->CursorGetCurrent(cursor), key, false);
 }
 
-static cell_t json_set_fp_to_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_get_value(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	bool flt = params[2] != 0;
-	if (!g_pJsonManager->SetFpToFloat(handle, flt)) {
-		return pContext->ThrowNativeError("Failed to set floating-point format to float (value is not a floating-point number)");
+	JsonValue* pJSONValue = g_pJsonManager->CursorGetValue(cursor);
+	if (!pJSONValue) {
+		return pContext->ThrowNativeError("Failed to get cursor value");
 	}
 
-	return 1;
+	return CreateAndReturnHandle(pContext, pJSONValue, "JSON cursor value");
 }
 
-static cell_t json_set_fp_to_fixed(IPluginContext* pContext, const cell_t* params)
+// The typed getters read the value under the cursor, or a member of it when a key is passed
+static cell_t json_cursor_get_bool(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	int prec = params[2];
-	if (prec < 1 || prec > 7) {
-		return pContext->ThrowNativeError("Precision out of range (1-7)");
-	}
+	JsonValue* current = g_pJsonManager->CursorGetCurrent(cursor);
+	char* key;
+	pContext->LocalToStringNULL(params[2], &key);
 
-	if (!g_pJsonManager->SetFpToFixed(handle, prec)) {
-		return pContext->ThrowNativeError("Failed to set floating-point format to fixed (value is not a floating-point number or precision out of range 1-7)");
+	bool value;
+	if (key) {
+		if (!g_pJsonManager->ObjectGetBool(current, key, &value)) {
+			return pContext->ThrowNativeError("Failed to get boolean for key '%s'", key);
+		}
+	} else if (!g_pJsonManager->GetBool(current, &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected boolean value");
 	}
 
-	return 1;
+	return value;
 }
 
-static cell_t json_set_bool(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_get_float(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	bool value = params[2] != 0;
-	if (!g_pJsonManager->SetBool(handle, value)) {
-		return pContext->ThrowNativeError("Failed to set value to boolean (value is object or array)");
+	JsonValue* current = g_pJsonManager->CursorGetCurrent(cursor);
+	char* key;
+	pContext->LocalToStringNULL(params[2], &key);
+
+	double value;
+	if (key) {
+		if (!g_pJsonManager->ObjectGetDouble(current, key, &value)) {
+			return pContext->ThrowNativeError("Failed to get float for key '%s'", key);
+		}
+	} else if (!g_pJsonManager->GetDouble(current, &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected float value");
 	}
 
-	return 1;
+	return sp_ftoc(static_cast<float>(value));
 }
 
-static cell_t json_set_int(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_get_int(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	int value = params[2];
-	if (!g_pJsonManager->SetInt(handle, value)) {
-		return pContext->ThrowNativeError("Failed to set value to integer (value is object or array)");
+	JsonValue* current = g_pJsonManager->CursorGetCurrent(cursor);
+	char* key;
+	pContext->LocalToStringNULL(params[2], &key);
+
+	int value;
+	if (key) {
+		if (!g_pJsonManager->ObjectGetInt(current, key, &value)) {
+			return pContext->ThrowNativeError("Failed to get integer for key '%s'", key);
+		}
+	} else if (!g_pJsonManager->GetInt(current, &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected integer value");
 	}
 
-	return 1;
+	return value;
 }
 
-static cell_t json_set_int64(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_get_integer64(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
-
-	char* str;
-	pContext->LocalToString(params[2], &str);
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	std::variant<int64_t, uint64_t> variant_value;
-	char error[JSON_ERROR_BUFFER_SIZE];
+	JsonValue* current = g_pJsonManager->CursorGetCurrent(cursor);
+	char* key;
+	pContext->LocalToStringNULL(params[4], &key);
 
-	if (!g_pJsonManager->ParseInt64Variant(str, &variant_value, error, sizeof(error))) {
-		return pContext->ThrowNativeError("%s", error);
+	std::variant<int64_t, uint64_t> value;
+	if (key) {
+		if (!g_pJsonManager->ObjectGetInt64(current, key, &value)) {
+			return pContext->ThrowNativeError("Failed to get integer64 for key '%s'", key);
+		}
+	} else if (!g_pJsonManager->GetInt64(current, &value)) {
+		return pContext->ThrowNativeError("Type mismatch: expected integer64 value");
 	}
 
-	if (!g_pJsonManager->SetInt64(handle, variant_value)) {
-		return pContext->ThrowNativeError("Failed to set value to int64 (value is object or array)");
+	char result[JSON_INT64_BUFFER_SIZE];
+	if (!Int64VariantToString(value, result, sizeof(result))) {
+		return pContext->ThrowNativeError("Failed to convert integer64 to string");
 	}
+	pContext->StringToLocalUTF8(params[2], params[3], result, nullptr);
 
 	return 1;
 }
 
-static cell_t json_set_float(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_get_str(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	if (!g_pJsonManager->SetDouble(handle, sp_ctof(params[2]))) {
-		return pContext->ThrowNativeError("Failed to set value to float (value is object or array)");
+	JsonValue* current = g_pJsonManager->CursorGetCurrent(cursor);
+	char* key;
+	pContext->LocalToStringNULL(params[4], &key);
+
+	const char* str;
+	size_t len;
+	if (key) {
+		if (!g_pJsonManager->ObjectGetString(current, key, &str, &len)) {
+			return pContext->ThrowNativeError("Failed to get string for key '%s'", key);
+		}
+	} else if (!g_pJsonManager->GetString(current, &str, &len)) {
+		return pContext->ThrowNativeError("Type mismatch: expected string value");
+	}
+
+	size_t maxlen = static_cast<size_t>(params[3]);
+	if (len + 1 > maxlen) {
+		return pContext->ThrowNativeError("Buffer is too small (need %d, have %d)", len + 1, maxlen);
 	}
 
+	pContext->StringToLocalUTF8(params[2], maxlen, str, nullptr);
+
 	return 1;
 }
 
-static cell_t json_set_string(IPluginContext* pContext, const cell_t* params)
+static cell_t json_cursor_is_null(IPluginContext* pContext, const cell_t* params)
 {
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
+	JsonCursor* cursor = g_pJsonManager->GetCursorFromHandle(pContext, params[1]);
+	if (!cursor) return 0;
 
-	char* value;
-	pContext->LocalToString(params[2], &value);
+	JsonValue* current = g_pJsonManager->CursorGetCurrent(cursor);
+	char* key;
+	pContext->LocalToStringNULL(params[2], &key);
 
-	if (!g_pJsonManager->SetString(handle, value)) {
-		return pContext->ThrowNativeError("Failed to set value to string (value is object or array)");
+	if (!key) {
+		return g_pJsonManager->IsNull(current);
 	}
 
-	return 1;
-}
-
-static cell_t json_set_null(IPluginContext* pContext, const cell_t* params)
-{
-	JsonValue* handle = g_pJsonManager->GetValueFromHandle(pContext, params[1]);
-	if (!handle) return 0;
-
-	if (!g_pJsonManager->SetNull(handle)) {
-		return pContext->ThrowNativeError("Failed to set value to null (value is object or array)");
+	bool is_null;
+	if (!g_pJsonManager->ObjectIsNull(current, key, &is_null)) {
+		return pContext->ThrowNativeError("Key not found: %s", key);
 	}
 
-	return 1;
+	return is_null;
 }
 
 const sp_nativeinfo_t g_JsonNatives[] =
@@ -3432,7 +5189,39 @@ const sp_nativeinfo_t g_JsonNatives[] =
 	// JSON UTILITY
 	{"JSON.ToString", json_doc_write_to_str},
 	{"JSON.ToFile", json_doc_write_to_file},
+	{"JSON.ToFileAsync", json_doc_write_to_file_async},
+	{"JSON.ToFileChunked", json_doc_write_to_file_chunked},
+	{"JSON.WriteChunks", json_doc_write_chunks},
+	{"JSON.ToMsgPack", json_doc_to_msgpack},
+	{"JSON.ToMsgPackFile", json_doc_to_msgpack_file},
+	{"JSON.FromMsgPack", json_doc_from_msgpack},
+	{"JSON.FromMsgPackFile", json_doc_from_msgpack_file},
+	{"JSON.ToCBOR", json_doc_to_cbor},
+	{"JSON.ToCBORFile", json_doc_to_cbor_file},
+	{"JSON.FromCBOR", json_doc_from_cbor},
+	{"JSON.FromCBORFile", json_doc_from_cbor_file},
+	{"JSON.SaveSnapshot", json_doc_save_snapshot},
+	{"JSON.LoadSnapshot", json_doc_load_snapshot},
 	{"JSON.Parse", json_doc_parse},
+	{"JSON.Validate", json_doc_validate},
+	{"JSON.ParseLimited", json_doc_parse_limited},
+	{"JSON.SetParseLimits", json_set_parse_limits},
+	{"JSON.PeekPointer", json_doc_peek_pointer},
+	{"JSON.PeekPointerBool", json_doc_peek_pointer_bool},
+	{"JSON.PeekPointerFloat", json_doc_peek_pointer_float},
+	{"JSON.PeekPointerInt", json_doc_peek_pointer_int},
+	{"JSON.PeekPointerInt64", json_doc_peek_pointer_integer64},
+	{"JSON.PeekPointerString", json_doc_peek_pointer_str},
+	{"JSON.ParseFileAsync", json_doc_parse_file_async},
+	{"JSON.LoadManyAsync", json_doc_load_many_async},
+	{"JSON.LoadDirectoryAsync", json_doc_load_directory_async},
+	{"JSON.GetFileCacheStats", json_doc_get_file_cache_stats},
+	{"JSON.ClearFileCache", json_doc_clear_file_cache},
+	{"JSON.SetWriteCacheLimit", json_doc_set_write_cache_limit},
+	{"JSON.GetWriteCacheStats", json_doc_get_write_cache_stats},
+	{"JSON.ClearWriteCache", json_doc_clear_write_cache},
+	{"JSON.SetKeyIndexThreshold", json_doc_set_key_index_threshold},
+	{"JSON.GetKeyIndexStats", json_doc_get_key_index_stats},
 	{"JSON.Equals", json_doc_equals},
 	{"JSON.EqualsStr", json_equals_str},
 	{"JSON.DeepCopy", json_doc_copy_deep},
@@ -3523,6 +5312,18 @@ const sp_nativeinfo_t g_JsonNatives[] =
 	{"JSON.PtrTryGetInt", json_ptr_try_get_int},
 	{"JSON.PtrTryGetInt64", json_ptr_try_get_integer64},
 	{"JSON.PtrTryGetString", json_ptr_try_get_str},
+	{"JSON.Child", json_node_child},
+	{"JSON.At", json_node_at},
+	{"JSON.Find", json_node_find},
+	{"JSON.GetTypeAt", json_node_get_type},
+	{"JSON.GetSizeAt", json_node_get_size},
+	{"JSON.GetBoolAt", json_node_get_bool},
+	{"JSON.GetFloatAt", json_node_get_float},
+	{"JSON.GetIntAt", json_node_get_int},
+	{"JSON.GetInt64At", json_node_get_integer64},
+	{"JSON.GetStringAt", json_node_get_str},
+	{"JSON.IsNullAt", json_node_is_null},
+	{"JSON.GetNodeValue", json_node_get_value},
 
 	// JSONArrIter
 	{"JSONArrIter.JSONArrIter", json_arr_iter_init},
@@ -3542,5 +5343,47 @@ const sp_nativeinfo_t g_JsonNatives[] =
 	{"JSONObjIter.Remove", json_obj_iter_remove},
 	{"JSONObjIter.Reset", json_obj_iter_reset},
 
+	// JSONStreamParser
+	{"JSONStreamParser.JSONStreamParser", json_stream_parser_create},
+	{"JSONStreamParser.Feed", json_stream_parser_feed},
+	{"JSONStreamParser.Finish", json_stream_parser_finish},
+	{"JSONStreamParser.Complete.get", json_stream_parser_is_complete},
+
+	// JSONLinesReader
+	{"JSONLinesReader.JSONLinesReader", json_lines_reader_open},
+	{"JSONLinesReader.Next", json_lines_reader_next},
+	{"JSONLinesReader.Skip", json_lines_reader_skip},
+	{"JSONLinesReader.Seek", json_lines_reader_seek},
+	{"JSONLinesReader.SeekOffset", json_lines_reader_seek_offset},
+	{"JSONLinesReader.Line.get", json_lines_reader_get_line},
+	{"JSONLinesReader.Offset.get", json_lines_reader_get_offset},
+	{"JSONLinesReader.EndOfFile.get", json_lines_reader_is_eof},
+
+	// JSONLinesWriter
+	{"JSONLinesWriter.JSONLinesWriter", json_lines_writer_open},
+	{"JSONLinesWriter.Append", json_lines_writer_append},
+	{"JSONLinesWriter.Flush", json_lines_writer_flush},
+	{"JSONLinesWriter.Dropped.get", json_lines_writer_get_dropped},
+	{"JSONLinesWriter.Written.get", json_lines_writer_get_written},
+
+	// JSONCursor
+	{"JSONCursor.JSONCursor", json_cursor_create},
+	{"JSONCursor.Enter", json_cursor_enter},
+	{"JSONCursor.EnterIndex", json_cursor_enter_index},
+	{"JSONCursor.Pointer", json_cursor_pointer},
+	{"JSONCursor.Parent", json_cursor_parent},
+	{"JSONCursor.Reset", json_cursor_reset},
+	{"JSONCursor.Depth.get", json_cursor_get_depth},
+	{"JSONCursor.Type.get", json_cursor_get_type},
+	{"JSONCursor.Size.get", json_cursor_get_size},
+	{"JSONCursor.HasKey", json_cursor_has_key},
+	{"JSONCursor.GetValue", json_cursor_get_value},
+	{"JSONCursor.GetBool", json_cursor_get_bool},
+	{"JSONCursor.GetFloat", json_cursor_get_float},
+	{"JSONCursor.GetInt", json_cursor_get_int},
+	{"JSONCursor.GetInt64", json_cursor_get_integer64},
+	{"JSONCursor.GetString", json_cursor_get_str},
+	{"JSONCursor.IsNull", json_cursor_is_null},
+
 	{nullptr, nullptr}
 };
\ No newline at end of file
@@ -0,0 +1,475 @@
+#include "JsonPeek.h"
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+static bool IsSpace(char c)
+{
+	return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static int HexValue(char c)
+{
+	if (c >= '0' && c <= '9') return c - '0';
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+	return -1;
+}
+
+static bool ReadHex4(const char* str, const char* end, uint32_t* out)
+{
+	if (end - str < 4) {
+		return false;
+	}
+
+	uint32_t value = 0;
+	for (int i = 0; i < 4; i++) {
+		int digit = HexValue(str[i]);
+		if (digit < 0) {
+			return false;
+		}
+		value = (value << 4) | static_cast<uint32_t>(digit);
+	}
+
+	*out = value;
+	return true;
+}
+
+static void AppendUtf8(std::string* out, uint32_t cp)
+{
+	if (cp < 0x80) {
+		out->push_back(static_cast<char>(cp));
+	} else if (cp < 0x800) {
+		out->push_back(static_cast<char>(0xC0 | (cp >> 6)));
+		out->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+	} else if (cp < 0x10000) {
+		out->push_back(static_cast<char>(0xE0 | (cp >> 12)));
+		out->push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+		out->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+	} else {
+		out->push_back(static_cast<char>(0xF0 | (cp >> 18)));
+		out->push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3F)));
+		out->push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3F)));
+		out->push_back(static_cast<char>(0x80 | (cp & 0x3F)));
+	}
+}
+
+/**
+ * Decode the escapes of a string body
+ * @return false on an invalid escape, the key cannot match then
+ */
+static bool UnescapeString(const char* str, size_t len, std::string* out)
+{
+	const char* end = str + len;
+	out->clear();
+
+	while (str < end) {
+		char c = *str++;
+		if (c != '\\') {
+			out->push_back(c);
+			continue;
+		}
+		if (str == end) {
+			return false;
+		}
+
+		switch (*str++) {
+		case '"': out->push_back('"'); break;
+		case '\'': out->push_back('\''); break;
+		case '\\': out->push_back('\\'); break;
+		case '/': out->push_back('/'); break;
+		case 'b': out->push_back('\b'); break;
+		case 'f': out->push_back('\f'); break;
+		case 'n': out->push_back('\n'); break;
+		case 'r': out->push_back('\r'); break;
+		case 't': out->push_back('\t'); break;
+		case 'u': {
+			uint32_t cp;
+			if (!ReadHex4(str, end, &cp)) {
+				return false;
+			}
+			str += 4;
+
+			// A high surrogate must be followed by the escaped low surrogate
+			if (cp >= 0xD800 && cp <= 0xDBFF) {
+				uint32_t low;
+				if (end - str < 6 || str[0] != '\\' || str[1] != 'u' || !ReadHex4(str + 2, end, &low) ||
+					low < 0xDC00 || low > 0xDFFF) {
+					return false;
+				}
+				str += 6;
+				cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+			} else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+				return false;
+			}
+
+			AppendUtf8(out, cp);
+			break;
+		}
+		default:
+			return false;
+		}
+	}
+
+	return true;
+}
+
+JsonPointerScanner::JsonPointerScanner(const char* data, size_t size, yyjson_read_flag read_flg)
+	: m_data(data), m_size(size),
+	  m_allowComments((read_flg & YYJSON_READ_ALLOW_COMMENTS) != 0),
+	  m_allowSingleQuoted((read_flg & YYJSON_READ_ALLOW_SINGLE_QUOTED_STR) != 0),
+	  m_allowUnquotedKey((read_flg & YYJSON_READ_ALLOW_UNQUOTED_KEY) != 0),
+	  m_allowBom((read_flg & YYJSON_READ_ALLOW_BOM) != 0)
+{
+	memset(m_isStructural, 0, sizeof(m_isStructural));
+	for (char c : { '"', '{', '}', '[', ']' }) {
+		m_isStructural[static_cast<uint8_t>(c)] = true;
+	}
+	m_isStructural[static_cast<uint8_t>('\'')] = m_allowSingleQuoted;
+	m_isStructural[static_cast<uint8_t>('/')] = m_allowComments;
+}
+
+bool JsonPointerScanner::Find(const char* pointer, size_t pointer_len, size_t* out_offset, size_t* out_len)
+{
+	m_pos = 0;
+	m_error = "";
+	m_errorPos = 0;
+	m_pointerError = false;
+
+	if (m_allowBom && m_size >= 3 && memcmp(m_data, "\xEF\xBB\xBF", 3) == 0) {
+		m_pos = 3;
+	}
+
+	if (pointer_len > 0 && pointer[0] != '/') {
+		return FailPointer("syntax error", 0);
+	}
+
+	if (!SkipSpace()) {
+		return false;
+	}
+
+	std::string token;
+	size_t ptr_pos = 0;
+
+	while (ptr_pos < pointer_len) {
+		size_t token_pos = ptr_pos++;
+
+		token.clear();
+		while (ptr_pos < pointer_len && pointer[ptr_pos] != '/') {
+			char c = pointer[ptr_pos];
+			if (c != '~') {
+				token.push_back(c);
+				ptr_pos++;
+				continue;
+			}
+			char next = ptr_pos + 1 < pointer_len ? pointer[ptr_pos + 1] : '\0';
+			if (next != '0' && next != '1') {
+				return FailPointer("syntax error", ptr_pos);
+			}
+			token.push_back(next == '0' ? '~' : '/');
+			ptr_pos += 2;
+		}
+
+		if (m_pos >= m_size) {
+			return Fail("unexpected end of data");
+		}
+
+		bool found = false;
+		char c = m_data[m_pos];
+		if (c == '{') {
+			if (!EnterMember(token, &found)) {
+				return false;
+			}
+		} else if (c == '[') {
+			if (!EnterElement(token, &found)) {
+				return false;
+			}
+		}
+
+		if (!found) {
+			return FailPointer("cannot resolve", token_pos);
+		}
+	}
+
+	size_t start = m_pos;
+	if (!SkipValue()) {
+		return false;
+	}
+
+	*out_offset = start;
+	*out_len = m_pos - start;
+	return true;
+}
+
+bool JsonPointerScanner::EnterMember(const std::string& key, bool* out_found)
+{
+	m_pos++;
+
+	for (;;) {
+		if (!SkipSpace()) {
+			return false;
+		}
+		if (m_pos >= m_size) {
+			return Fail("unexpected end of data");
+		}
+
+		// Also reached after a trailing comma, the scan does not judge those
+		char c = m_data[m_pos];
+		if (c == '}') {
+			return true;
+		}
+
+		bool match;
+		if (IsQuote(c)) {
+			size_t key_start = m_pos + 1;
+			if (!SkipString()) {
+				return false;
+			}
+			match = KeyEquals(m_data + key_start, m_pos - 1 - key_start, key);
+		} else if (m_allowUnquotedKey) {
+			size_t key_start = m_pos;
+			while (m_pos < m_size && m_data[m_pos] != ':' && !IsSpace(m_data[m_pos]) && m_data[m_pos] != '/') {
+				m_pos++;
+			}
+			match = m_pos - key_start == key.size() && memcmp(m_data + key_start, key.data(), key.size()) == 0;
+		} else {
+			return Fail("unexpected character, expected a string key");
+		}
+
+		if (!SkipSpace()) {
+			return false;
+		}
+		if (m_pos >= m_size || m_data[m_pos] != ':') {
+			return Fail("unexpected character, expected ':' after key");
+		}
+		m_pos++;
+		if (!SkipSpace()) {
+			return false;
+		}
+
+		// The first matching key wins, as with the pointer lookup of a parsed document
+		if (match) {
+			*out_found = true;
+			return true;
+		}
+
+		if (!SkipValue() || !SkipSpace()) {
+			return false;
+		}
+		if (m_pos >= m_size) {
+			return Fail("unexpected end of data");
+		}
+		if (m_data[m_pos] == ',') {
+			m_pos++;
+		} else if (m_data[m_pos] == '}') {
+			return true;
+		} else {
+			return Fail("unexpected character, expected ',' or '}'");
+		}
+	}
+}
+
+bool JsonPointerScanner::EnterElement(const std::string& index, bool* out_found)
+{
+	// Only plain decimal indices refer to an element, "-" refers to the one past the end
+	if (index.empty() || (index.size() > 1 && index[0] == '0')) {
+		return true;
+	}
+
+	size_t target = 0;
+	for (char c : index) {
+		if (c < '0' || c > '9') {
+			return true;
+		}
+		size_t digit = static_cast<size_t>(c - '0');
+		if (target > (std::numeric_limits<size_t>::max() - digit) / 10) {
+			return true;
+		}
+		target = target * 10 + digit;
+	}
+
+	m_pos++;
+
+	for (size_t i = 0;; i++) {
+		if (!SkipSpace()) {
+			return false;
+		}
+		if (m_pos >= m_size) {
+			return Fail("unexpected end of data");
+		}
+		if (m_data[m_pos] == ']') {
+			return true;
+		}
+		if (i == target) {
+			*out_found = true;
+			return true;
+		}
+
+		if (!SkipValue() || !SkipSpace()) {
+			return false;
+		}
+		if (m_pos >= m_size) {
+			return Fail("unexpected end of data");
+		}
+		if (m_data[m_pos] == ',') {
+			m_pos++;
+		} else if (m_data[m_pos] == ']') {
+			return true;
+		} else {
+			return Fail("unexpected character, expected ',' or ']'");
+		}
+	}
+}
+
+bool JsonPointerScanner::KeyEquals(const char* str, size_t len, const std::string& key)
+{
+	if (!memchr(str, '\\', len)) {
+		return len == key.size() && memcmp(str, key.data(), len) == 0;
+	}
+
+	return UnescapeString(str, len, &m_key) && m_key == key;
+}
+
+bool JsonPointerScanner::SkipSpace()
+{
+	while (m_pos < m_size) {
+		char c = m_data[m_pos];
+		if (IsSpace(c)) {
+			m_pos++;
+		} else if (c == '/' && m_allowComments) {
+			if (!SkipComment()) {
+				return false;
+			}
+		} else {
+			break;
+		}
+	}
+
+	return true;
+}
+
+bool JsonPointerScanner::SkipComment()
+{
+	if (m_pos + 1 < m_size && m_data[m_pos + 1] == '/') {
+		const char* eol = static_cast<const char*>(memchr(m_data + m_pos, '\n', m_size - m_pos));
+		m_pos = eol ? static_cast<size_t>(eol - m_data) + 1 : m_size;
+		return true;
+	}
+
+	if (m_pos + 1 < m_size && m_data[m_pos + 1] == '*') {
+		for (size_t i = m_pos + 2; i + 1 < m_size; i++) {
+			if (m_data[i] == '*' && m_data[i + 1] == '/') {
+				m_pos = i + 2;
+				return true;
+			}
+		}
+		return Fail("unclosed multiline comment");
+	}
+
+	return Fail("unexpected character");
+}
+
+bool JsonPointerScanner::SkipString()
+{
+	char quote = m_data[m_pos];
+	size_t body = m_pos + 1;
+	size_t pos = body;
+
+	// Jump from quote to quote, a quote preceded by an odd number of backslashes is escaped
+	for (;;) {
+		const char* found = static_cast<const char*>(memchr(m_data + pos, quote, m_size - pos));
+		if (!found) {
+			m_pos = m_size;
+			return Fail("unclosed string");
+		}
+
+		size_t end = static_cast<size_t>(found - m_data);
+		size_t backslashes = 0;
+		while (end - backslashes > body && m_data[end - backslashes - 1] == '\\') {
+			backslashes++;
+		}
+
+		pos = end + 1;
+		if (backslashes % 2 == 0) {
+			m_pos = pos;
+			return true;
+		}
+	}
+}
+
+bool JsonPointerScanner::SkipValue()
+{
+	if (m_pos >= m_size) {
+		return Fail("unexpected end of data");
+	}
+
+	char c = m_data[m_pos];
+	if (IsQuote(c)) {
+		return SkipString();
+	}
+
+	if (c != '{' && c != '[') {
+		size_t start = m_pos;
+		while (m_pos < m_size) {
+			c = m_data[m_pos];
+			if (IsSpace(c) || c == ',' || c == ']' || c == '}' || c == ':' || c == '/') {
+				break;
+			}
+			m_pos++;
+		}
+		if (m_pos == start) {
+			return Fail("unexpected character, expected a value");
+		}
+		return true;
+	}
+
+	// Brackets of both kinds are counted together, mismatches are left to the reader
+	size_t depth = 0;
+	while (m_pos < m_size) {
+		if (!m_isStructural[static_cast<uint8_t>(m_data[m_pos])]) {
+			m_pos++;
+			continue;
+		}
+
+		c = m_data[m_pos];
+		if (IsQuote(c)) {
+			if (!SkipString()) {
+				return false;
+			}
+			continue;
+		}
+		if (c == '/' && m_allowComments) {
+			if (!SkipComment()) {
+				return false;
+			}
+			continue;
+		}
+
+		m_pos++;
+		if (c == '{' || c == '[') {
+			depth++;
+		} else if (c == '}' || c == ']') {
+			if (--depth == 0) {
+				return true;
+			}
+		}
+	}
+
+	return Fail("unexpected end of data");
+}
+
+bool JsonPointerScanner::Fail(const char* error)
+{
+	m_error = error;
+	m_errorPos = m_pos;
+	m_pointerError = false;
+	return false;
+}
+
+bool JsonPointerScanner::FailPointer(const char* error, size_t pos)
+{
+	m_error = error;
+	m_errorPos = pos;
+	m_pointerError = true;
+	return false;
+}
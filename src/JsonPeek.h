@@ -0,0 +1,76 @@
+#ifndef _INCLUDE_JSONPEEK_H_
+#define _INCLUDE_JSONPEEK_H_
+
+#include <yyjson.h>
+#include <cstddef>
+#include <string>
+
+/**
+ * @brief Locates the value a JSON Pointer refers to in JSON text, without parsing the rest of it
+ *
+ * Only the containers on the path are walked member by member. Every other value is skipped by
+ * matching quotes and brackets, so the cost depends on how far into the text the value is, and
+ * skipped values are not validated. The text of the value found is left to the regular reader.
+ */
+class JsonPointerScanner
+{
+public:
+	/**
+	 * @param data JSON text
+	 * @param size Text size in bytes
+	 * @param read_flg Read flags, comments, single quoted strings, unquoted keys and BOM are honored
+	 */
+	JsonPointerScanner(const char* data, size_t size, yyjson_read_flag read_flg);
+
+	JsonPointerScanner(const JsonPointerScanner&) = delete;
+	JsonPointerScanner& operator=(const JsonPointerScanner&) = delete;
+
+	/**
+	 * Find the value a JSON Pointer refers to
+	 * @param pointer JSON Pointer, an empty pointer refers to the root value
+	 * @param pointer_len Pointer length in bytes
+	 * @param out_offset Receives the offset of the value text
+	 * @param out_len Receives the length of the value text
+	 * @return false if the pointer is invalid or does not resolve, or the text on the way is malformed
+	 */
+	bool Find(const char* pointer, size_t pointer_len, size_t* out_offset, size_t* out_len);
+
+	const char* GetError() const { return m_error; }
+
+	// Position in the pointer for pointer errors, in the text otherwise
+	size_t GetErrorPos() const { return m_errorPos; }
+	bool IsPointerError() const { return m_pointerError; }
+
+private:
+	bool EnterMember(const std::string& key, bool* out_found);
+	bool EnterElement(const std::string& index, bool* out_found);
+	bool KeyEquals(const char* str, size_t len, const std::string& key);
+	bool SkipSpace();
+	bool SkipComment();
+	bool SkipString();
+	bool SkipValue();
+	bool IsQuote(char c) const { return c == '"' || (c == '\'' && m_allowSingleQuoted); }
+	bool Fail(const char* error);
+	bool FailPointer(const char* error, size_t pos);
+
+	const char* m_data;
+	size_t m_size;
+	size_t m_pos{ 0 };
+
+	bool m_allowComments;
+	bool m_allowSingleQuoted;
+	bool m_allowUnquotedKey;
+	bool m_allowBom;
+
+	// Characters that matter while skipping a container, everything else is stepped over
+	bool m_isStructural[256];
+
+	// Unescaped key, only used for keys containing escapes
+	std::string m_key;
+
+	const char* m_error{ "" };
+	size_t m_errorPos{ 0 };
+	bool m_pointerError{ false };
+};
+
+#endif // _INCLUDE_JSONPEEK_H_
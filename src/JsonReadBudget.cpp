@@ -0,0 +1,137 @@
+#include "JsonReadBudget.h"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+JsonReadBudget::JsonReadBudget(const JsonParseLimits& limits)
+	: m_limits(limits), m_alc{ Malloc, Realloc, Free, this }
+{
+}
+
+void* JsonReadBudget::Malloc(void* ctx, size_t size)
+{
+	JsonReadBudget* budget = static_cast<JsonReadBudget*>(ctx);
+	if (!budget->Charge(size)) {
+		return nullptr;
+	}
+	return malloc(size);
+}
+
+void* JsonReadBudget::Realloc(void* ctx, void* ptr, size_t old_size, size_t size)
+{
+	JsonReadBudget* budget = static_cast<JsonReadBudget*>(ctx);
+	if (size > old_size && !budget->Charge(size - old_size)) {
+		return nullptr;
+	}
+	return realloc(ptr, size);
+}
+
+void JsonReadBudget::Free(void* ctx, void* ptr)
+{
+	free(ptr);
+}
+
+size_t JsonReadBudget::GetInputAllowance() const
+{
+	size_t allowance = m_limits.maxInputBytes;
+	if (m_limits.maxMemory) {
+		size_t left = m_limits.maxMemory - m_used;
+		if (!allowance || left < allowance) {
+			allowance = left;
+		}
+	}
+	return allowance;
+}
+
+bool JsonReadBudget::CheckInput(size_t size)
+{
+	if (m_limits.maxInputBytes && size > m_limits.maxInputBytes) {
+		return Exceed(JSON_LIMIT_INPUT_BYTES, m_limits.maxInputBytes, size);
+	}
+	return true;
+}
+
+bool JsonReadBudget::Charge(size_t size)
+{
+	if (!Fits(size)) {
+		return Exceed(JSON_LIMIT_MEMORY, m_limits.maxMemory, m_used + size);
+	}
+	m_used += size;
+	return true;
+}
+
+bool JsonReadBudget::CheckDocument(const yyjson_doc* doc)
+{
+	// Cached documents were read before, so their size is checked here as well
+	if (!CheckInput(yyjson_doc_get_read_size(const_cast<yyjson_doc*>(doc)))) {
+		return false;
+	}
+
+	size_t count = yyjson_doc_get_val_count(const_cast<yyjson_doc*>(doc));
+	if (m_limits.maxValues && count > m_limits.maxValues) {
+		return Exceed(JSON_LIMIT_VALUES, m_limits.maxValues, count);
+	}
+
+	if (!m_limits.maxDepth || !doc->root) {
+		return true;
+	}
+
+	// Values are stored in document order, every container followed by its children, so the depth
+	// is found in one pass keeping the end of each open container
+	std::vector<yyjson_val*> ends;
+	yyjson_val* end = doc->root + count;
+	for (yyjson_val* val = doc->root; val < end; val++) {
+		while (!ends.empty() && val >= ends.back()) {
+			ends.pop_back();
+		}
+		if (unsafe_yyjson_is_ctn(val)) {
+			if (ends.size() == m_limits.maxDepth) {
+				return Exceed(JSON_LIMIT_DEPTH, m_limits.maxDepth, ends.size() + 1);
+			}
+			ends.push_back(unsafe_yyjson_get_next(val));
+		}
+	}
+
+	return true;
+}
+
+void JsonReadBudget::Detach(yyjson_doc* doc) const
+{
+	// Blocks are plain malloc() blocks, only the context pointer has to go
+	if (doc && doc->alc.ctx == this) {
+		doc->alc.ctx = nullptr;
+	}
+}
+
+bool JsonReadBudget::Exceed(JSON_PARSE_LIMIT limit, size_t limit_value, size_t reached)
+{
+	m_exceeded = limit;
+	m_limitValue = limit_value;
+	m_reached = reached;
+	return false;
+}
+
+void JsonReadBudget::FormatError(char* error, size_t error_size) const
+{
+	if (!error || !error_size) {
+		return;
+	}
+
+	switch (m_exceeded) {
+		case JSON_LIMIT_INPUT_BYTES:
+			snprintf(error, error_size, "Parse limit exceeded: JSON text is %zu bytes (limit: %zu)", m_reached, m_limitValue);
+			break;
+		case JSON_LIMIT_DEPTH:
+			snprintf(error, error_size, "Parse limit exceeded: JSON is nested deeper than %zu levels", m_limitValue);
+			break;
+		case JSON_LIMIT_VALUES:
+			snprintf(error, error_size, "Parse limit exceeded: JSON has %zu values (limit: %zu)", m_reached, m_limitValue);
+			break;
+		case JSON_LIMIT_MEMORY:
+			snprintf(error, error_size, "Parse limit exceeded: reading JSON needs more than %zu bytes of memory", m_limitValue);
+			break;
+		default:
+			snprintf(error, error_size, "No parse limit exceeded");
+			break;
+	}
+}
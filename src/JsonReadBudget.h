@@ -0,0 +1,88 @@
+#ifndef _INCLUDE_JSONREADBUDGET_H_
+#define _INCLUDE_JSONREADBUDGET_H_
+
+#include <IJsonManager.h>
+#include <yyjson.h>
+#include <cstddef>
+
+/**
+ * @brief Enforces JsonParseLimits while one document is read
+ *
+ * The allocator counts what the reader allocates and fails once the memory limit would be crossed,
+ * which makes yyjson abort the read at that point. Its blocks come from malloc(), so a document read
+ * with it is released like one read with the default allocator once Detach() has been called.
+ */
+class JsonReadBudget
+{
+public:
+	explicit JsonReadBudget(const JsonParseLimits& limits);
+
+	JsonReadBudget(const JsonReadBudget&) = delete;
+	JsonReadBudget& operator=(const JsonReadBudget&) = delete;
+
+	/**
+	 * @return Allocator for the reader, nullptr when memory is unlimited
+	 */
+	const yyjson_alc* GetAllocator() const { return m_limits.maxMemory ? &m_alc : nullptr; }
+
+	/**
+	 * @return Largest input that can still be accepted, 0 if unlimited
+	 */
+	size_t GetInputAllowance() const;
+
+	/**
+	 * Check the size of the JSON text before it is read
+	 * @return false if it is over the input limit
+	 */
+	bool CheckInput(size_t size);
+
+	/**
+	 * Account for memory allocated for the read outside of the allocator
+	 * @return false if it is over the memory limit
+	 */
+	bool Charge(size_t size);
+
+	/**
+	 * @return true if size more bytes fit the memory limit, nothing is charged
+	 */
+	bool Fits(size_t size) const { return !m_limits.maxMemory || size <= m_limits.maxMemory - m_used; }
+
+	/**
+	 * Check the depth and value count of a document that was read
+	 * @return false if a limit is exceeded
+	 */
+	bool CheckDocument(const yyjson_doc* doc);
+
+	/**
+	 * Make a document read with GetAllocator() independent of the budget, so it can outlive it
+	 */
+	void Detach(yyjson_doc* doc) const;
+
+	JSON_PARSE_LIMIT GetExceeded() const { return m_exceeded; }
+
+	/**
+	 * Describe the exceeded limit
+	 * @param error Error buffer
+	 * @param error_size Error buffer size
+	 */
+	void FormatError(char* error, size_t error_size) const;
+
+private:
+	static void* Malloc(void* ctx, size_t size);
+	static void* Realloc(void* ctx, void* ptr, size_t old_size, size_t size);
+	static void Free(void* ctx, void* ptr);
+
+	bool Exceed(JSON_PARSE_LIMIT limit, size_t limit_value, size_t reached);
+
+	JsonParseLimits m_limits;
+	yyjson_alc m_alc;
+
+	// Bytes allocated so far, blocks are not credited back when freed
+	size_t m_used{ 0 };
+
+	JSON_PARSE_LIMIT m_exceeded{ JSON_LIMIT_NONE };
+	size_t m_limitValue{ 0 };
+	size_t m_reached{ 0 };
+};
+
+#endif // _INCLUDE_JSONREADBUDGET_H_
@@ -0,0 +1,254 @@
+#include "JsonSnapshot.h"
+#include "JsonFile.h"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static_assert(sizeof(JsonSnapshotHeader) % sizeof(yyjson_val) == 0, "values must stay aligned after the header");
+
+static const char SNAPSHOT_MAGIC[8] = { 'S', 'M', 'J', 'S', 'N', 'A', 'P', '\0' };
+
+bool WriteJsonSnapshot(const yyjson_val* root, FILE* fp, const char** error)
+{
+	void* raw = const_cast<yyjson_val*>(root);
+	size_t count = unsafe_yyjson_is_ctn(raw) ? unsafe_yyjson_get_next(const_cast<yyjson_val*>(root)) - root : 1;
+
+	std::vector<char> payload(count * sizeof(yyjson_val));
+	std::string pool;
+
+	for (size_t i = 0; i < count; i++) {
+		const yyjson_val& src = root[i];
+		yyjson_val dst;
+		dst.tag = src.tag;
+		dst.uni.u64 = 0;
+
+		switch (unsafe_yyjson_get_type(const_cast<yyjson_val*>(&src))) {
+		case YYJSON_TYPE_STR:
+		case YYJSON_TYPE_RAW:
+			// Strings may live anywhere, in the pool of the document or in an in-situ buffer
+			dst.uni.u64 = pool.size();
+			pool.append(src.uni.str, unsafe_yyjson_get_len(const_cast<yyjson_val*>(&src)));
+			pool.push_back('\0');
+			break;
+		case YYJSON_TYPE_ARR:
+		case YYJSON_TYPE_OBJ:
+			dst.uni.ofs = src.uni.ofs;
+			break;
+		case YYJSON_TYPE_NUM:
+			dst.uni.u64 = src.uni.u64;
+			break;
+		default:
+			break;
+		}
+
+		memcpy(&payload[i * sizeof(yyjson_val)], &dst, sizeof(dst));
+	}
+	payload.insert(payload.end(), pool.begin(), pool.end());
+
+	JsonSnapshotHeader header{};
+	memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+	header.version = JsonSnapshotHeader::VERSION;
+	header.yyjsonVersion = YYJSON_VERSION_HEX;
+	header.valSize = sizeof(yyjson_val);
+	header.byteOrder = JsonSnapshotHeader::ORDER_MARK;
+	header.valCount = count;
+	header.poolSize = pool.size();
+
+	if (fwrite(&header, sizeof(header), 1, fp) != 1 || fwrite(payload.data(), payload.size(), 1, fp) != 1) {
+		*error = "write failed";
+		return false;
+	}
+
+	return true;
+}
+
+yyjson_doc* LoadJsonSnapshot(char* data, size_t size, const char** error)
+{
+	JsonSnapshotHeader header;
+	if (size < sizeof(header)) {
+		*error = "file is too small";
+		return nullptr;
+	}
+	memcpy(&header, data, sizeof(header));
+
+	if (memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic)) != 0) {
+		*error = "not a snapshot file";
+		return nullptr;
+	}
+	if (header.version != JsonSnapshotHeader::VERSION) {
+		*error = "unsupported snapshot version";
+		return nullptr;
+	}
+	if (header.yyjsonVersion != YYJSON_VERSION_HEX || header.valSize != sizeof(yyjson_val) ||
+		header.byteOrder != JsonSnapshotHeader::ORDER_MARK) {
+		*error = "snapshot was saved by an incompatible build";
+		return nullptr;
+	}
+
+	size_t payload_size = size - sizeof(header);
+	if (header.valCount == 0 || header.valCount > payload_size / sizeof(yyjson_val) ||
+		header.poolSize != payload_size - header.valCount * sizeof(yyjson_val)) {
+		*error = "snapshot size does not match its header";
+		return nullptr;
+	}
+
+	size_t count = static_cast<size_t>(header.valCount);
+	size_t pool_size = static_cast<size_t>(header.poolSize);
+	yyjson_val* vals = reinterpret_cast<yyjson_val*>(data + sizeof(header));
+	char* pool = data + sizeof(header) + count * sizeof(yyjson_val);
+
+	struct Frame {
+		size_t end;        // Index after the last value of the container
+		uint64_t entries;  // Direct children, keys and values counted separately
+		uint64_t seen;
+		bool is_obj;
+	};
+
+	// Nothing may read the values before they are known to be a well-formed tree, so the payload
+	// is validated completely. This also rejects damaged files, without hashing the whole payload.
+	std::vector<Frame> stack;
+
+	for (size_t i = 0; i < count; i++) {
+		yyjson_val* val = &vals[i];
+		uint8_t type = unsafe_yyjson_get_type(val);
+		uint64_t len = unsafe_yyjson_get_len(val);
+
+		if (!stack.empty() && i >= stack.back().end) {
+			*error = "container is out of bounds";
+			return nullptr;
+		}
+		if (!stack.empty() && stack.back().is_obj && !(stack.back().seen & 1) && type != YYJSON_TYPE_STR) {
+			*error = "object key is not a string";
+			return nullptr;
+		}
+
+		switch (type) {
+		case YYJSON_TYPE_STR:
+		case YYJSON_TYPE_RAW: {
+			uint64_t ofs = val->uni.u64;
+			if (ofs >= pool_size || len >= pool_size - ofs || pool[ofs + len] != '\0') {
+				*error = "string is out of bounds";
+				return nullptr;
+			}
+			val->uni.str = pool + ofs;
+			break;
+		}
+		case YYJSON_TYPE_ARR:
+		case YYJSON_TYPE_OBJ: {
+			size_t span = val->uni.ofs / sizeof(yyjson_val);
+			size_t end = stack.empty() ? count : stack.back().end;
+			uint64_t entries = type == YYJSON_TYPE_OBJ ? len * 2 : len;
+			if (val->uni.ofs % sizeof(yyjson_val) != 0 || span == 0 || span > end - i || entries > span - 1) {
+				*error = "container is out of bounds";
+				return nullptr;
+			}
+			if (entries > 0) {
+				stack.push_back({ i + span, entries, 0, type == YYJSON_TYPE_OBJ });
+				continue;
+			}
+			if (span != 1) {
+				*error = "container is out of bounds";
+				return nullptr;
+			}
+			break;
+		}
+		case YYJSON_TYPE_NULL:
+		case YYJSON_TYPE_BOOL:
+		case YYJSON_TYPE_NUM:
+			break;
+		default:
+			*error = "invalid value type";
+			return nullptr;
+		}
+
+		// The value is complete, which may complete the containers around it as well
+		for (;;) {
+			if (stack.empty()) {
+				if (i + 1 != count) {
+					*error = "unexpected data after the root value";
+					return nullptr;
+				}
+				break;
+			}
+
+			Frame& frame = stack.back();
+			if (++frame.seen < frame.entries) {
+				break;
+			}
+			if (i + 1 != frame.end) {
+				*error = "container is out of bounds";
+				return nullptr;
+			}
+			stack.pop_back();
+		}
+	}
+
+	if (!stack.empty()) {
+		*error = "unexpected end of data";
+		return nullptr;
+	}
+
+	yyjson_doc* doc = static_cast<yyjson_doc*>(malloc(sizeof(yyjson_doc)));
+	if (!doc) {
+		*error = "memory allocation failed";
+		return nullptr;
+	}
+
+	// Only the header is freed with the document, the values belong to the file data
+	memset(doc, 0, sizeof(yyjson_doc));
+	doc->root = vals;
+	doc->alc = g_LibcAllocator;
+	doc->dat_read = size;
+	doc->val_read = count;
+	return doc;
+}
+
+yyjson_doc* CopyJsonValues(const yyjson_val* root, size_t dat_read)
+{
+	yyjson_val* src = const_cast<yyjson_val*>(root);
+	size_t count = unsafe_yyjson_is_ctn(src) ? unsafe_yyjson_get_next(src) - src : 1;
+
+	size_t pool_size = 0;
+	for (size_t i = 0; i < count; i++) {
+		uint8_t type = unsafe_yyjson_get_type(&src[i]);
+		if (type == YYJSON_TYPE_STR || type == YYJSON_TYPE_RAW) {
+			pool_size += unsafe_yyjson_get_len(&src[i]) + 1;
+		}
+	}
+
+	// Values follow the document header in one block, as yyjson lays out parsed documents
+	size_t header_size = (sizeof(yyjson_doc) + sizeof(yyjson_val) - 1) / sizeof(yyjson_val) * sizeof(yyjson_val);
+	char* block = static_cast<char*>(malloc(header_size + count * sizeof(yyjson_val)));
+	char* pool = pool_size ? static_cast<char*>(malloc(pool_size)) : nullptr;
+	if (!block || (pool_size && !pool)) {
+		free(block);
+		free(pool);
+		return nullptr;
+	}
+
+	// Containers store the distance to their next sibling, only strings point outside the values
+	yyjson_val* vals = reinterpret_cast<yyjson_val*>(block + header_size);
+	memcpy(vals, src, count * sizeof(yyjson_val));
+
+	char* cur = pool;
+	for (size_t i = 0; i < count; i++) {
+		uint8_t type = unsafe_yyjson_get_type(&vals[i]);
+		if (type == YYJSON_TYPE_STR || type == YYJSON_TYPE_RAW) {
+			size_t len = unsafe_yyjson_get_len(&vals[i]);
+			memcpy(cur, vals[i].uni.str, len);
+			cur[len] = '\0';
+			vals[i].uni.str = cur;
+			cur += len + 1;
+		}
+	}
+
+	yyjson_doc* doc = reinterpret_cast<yyjson_doc*>(block);
+	memset(doc, 0, sizeof(yyjson_doc));
+	doc->root = vals;
+	doc->alc = g_LibcAllocator;
+	doc->dat_read = dat_read;
+	doc->val_read = count;
+	doc->str_pool = pool;
+	return doc;
+}
@@ -0,0 +1,67 @@
+#ifndef _INCLUDE_JSONSNAPSHOT_H_
+#define _INCLUDE_JSONSNAPSHOT_H_
+
+#include <yyjson.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @brief Header of a snapshot file, followed by the values and then the string pool
+ *
+ * Values are stored as yyjson_val exactly as an immutable document holds them, except that
+ * strings hold their offset into the pool instead of a pointer. Containers already store the
+ * distance to their next sibling, so nothing else depends on where the file is loaded.
+ */
+struct JsonSnapshotHeader
+{
+	static constexpr uint32_t VERSION = 1;
+	static constexpr uint32_t ORDER_MARK = 0x01020304;
+
+	char magic[8];
+	uint32_t version;         // VERSION
+	uint32_t yyjsonVersion;   // YYJSON_VERSION_HEX, the value layout is only valid for the same yyjson
+	uint32_t valSize;         // sizeof(yyjson_val)
+	uint32_t byteOrder;       // ORDER_MARK as written by the saving host
+	uint64_t valCount;
+	uint64_t poolSize;
+	uint64_t reserved;        // Zero, keeps the values after the header aligned
+};
+
+/**
+ * @brief Write a value and its children as a snapshot
+ * @param root Value of an immutable document, the values of its subtree are contiguous
+ * @param fp File open for binary writing
+ * @param error Receives the error message on failure
+ * @return true on success
+ */
+bool WriteJsonSnapshot(const yyjson_val* root, FILE* fp, const char** error);
+
+/**
+ * @brief Turn snapshot file data into an immutable document, in place
+ *
+ * Checks the header, then validates the value tree while rebasing string offsets onto the
+ * pool in a single pass. Nothing is parsed or copied, the document header is the only
+ * allocation. Corrupt data is rejected before any value is handed out.
+ *
+ * @param data Writable file data, must stay alive and unchanged as long as the document
+ * @param size Data size in bytes
+ * @param error Receives the error message on failure
+ * @return Document whose values point into data, or nullptr on error
+ */
+yyjson_doc* LoadJsonSnapshot(char* data, size_t size, const char** error);
+
+/**
+ * @brief Copy a value and its children into a new immutable document
+ *
+ * The values of the subtree are contiguous, so they are copied as one block, and the strings are
+ * gathered into a new pool with their pointers rebased onto it. This is the in-memory counterpart
+ * of WriteJsonSnapshot and takes two allocations whatever the size of the document.
+ *
+ * @param root Value of an immutable document
+ * @param dat_read Read size to record in the new document
+ * @return New document owning its values and strings, nullptr if allocation failed
+ */
+yyjson_doc* CopyJsonValues(const yyjson_val* root, size_t dat_read);
+
+#endif // _INCLUDE_JSONSNAPSHOT_H_
@@ -0,0 +1,34 @@
+#ifndef _INCLUDE_JSONTREEWALK_H_
+#define _INCLUDE_JSONTREEWALK_H_
+
+#include <yyjson.h>
+
+/**
+ * @brief Child access shared by the serializers that walk a value tree themselves
+ *
+ * Children are walked the same way for both document kinds: a key is followed by its value,
+ * and the next sibling of a value skips its whole subtree.
+ */
+inline const yyjson_val* JsonFirstChild(const yyjson_val* ctn)
+{
+	return unsafe_yyjson_get_first(const_cast<yyjson_val*>(ctn));
+}
+
+inline const yyjson_val* JsonNextSibling(const yyjson_val* val)
+{
+	return unsafe_yyjson_get_next(const_cast<yyjson_val*>(val));
+}
+
+inline const yyjson_mut_val* JsonFirstChild(const yyjson_mut_val* ctn)
+{
+	// Containers point at their last child (the last key for objects), whose successor wraps around
+	const yyjson_mut_val* last = static_cast<yyjson_mut_val*>(ctn->uni.ptr);
+	return unsafe_yyjson_is_obj(const_cast<yyjson_mut_val*>(ctn)) ? last->next->next : last->next;
+}
+
+inline const yyjson_mut_val* JsonNextSibling(const yyjson_mut_val* val)
+{
+	return val->next;
+}
+
+#endif // _INCLUDE_JSONTREEWALK_H_
@@ -0,0 +1,567 @@
+#include "JsonWriteSize.h"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+struct MeasureOptions
+{
+	bool pretty;
+	size_t spaces;
+	bool escape_unicode;
+	bool allow_invalid;
+	bool noesc_allowed;         // yyjson copies strings marked as no-escape verbatim with the plain table
+	const uint8_t* ascii_extra; // Escape overhead per ASCII byte
+};
+
+// Marks bytes >= 0x80 in the ASCII tables, they need UTF-8 validation
+constexpr uint8_t NON_ASCII = 0xFF;
+
+/**
+ * Bytes added on top of the byte itself when yyjson writes an ASCII character:
+ * \b \t \n \f \r " \ (and / when escaped) take 2 bytes, the other control characters 6 (\u00XX)
+ */
+constexpr std::array<uint8_t, 256> MakeAsciiExtra(bool escape_slashes)
+{
+	std::array<uint8_t, 256> table{};
+	for (int c = 0; c < 256; c++) {
+		if (c >= 0x80) {
+			table[c] = NON_ASCII;
+		} else if (c == '\b' || c == '\t' || c == '\n' || c == '\f' || c == '\r' || c == '"' || c == '\\') {
+			table[c] = 1;
+		} else if (c < 0x20) {
+			table[c] = 5;
+		} else if (c == '/' && escape_slashes) {
+			table[c] = 1;
+		}
+	}
+	return table;
+}
+
+constexpr std::array<uint8_t, 256> ASCII_EXTRA = MakeAsciiExtra(false);
+constexpr std::array<uint8_t, 256> ASCII_EXTRA_SLASH = MakeAsciiExtra(true);
+
+MeasureOptions GetMeasureOptions(yyjson_write_flag write_flg)
+{
+	bool escape_slashes = (write_flg & YYJSON_WRITE_ESCAPE_SLASHES) != 0;
+
+	MeasureOptions opts;
+	opts.pretty = (write_flg & (YYJSON_WRITE_PRETTY | YYJSON_WRITE_PRETTY_TWO_SPACES)) != 0;
+	opts.spaces = (write_flg & YYJSON_WRITE_PRETTY_TWO_SPACES) ? 2 : 4;
+	opts.escape_unicode = (write_flg & YYJSON_WRITE_ESCAPE_UNICODE) != 0;
+	opts.allow_invalid = (write_flg & YYJSON_WRITE_ALLOW_INVALID_UNICODE) != 0;
+	opts.noesc_allowed = !opts.escape_unicode && !escape_slashes;
+	opts.ascii_extra = escape_slashes ? ASCII_EXTRA_SLASH.data() : ASCII_EXTRA.data();
+	return opts;
+}
+
+constexpr uint64_t POW10[20] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+	1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+	1000000000000000000ULL, 10000000000000000000ULL
+};
+
+size_t BitLength(uint64_t value)
+{
+#if defined(_MSC_VER)
+	// 32-bit builds have no 64-bit scan
+	unsigned long index;
+	if (_BitScanReverse(&index, static_cast<unsigned long>(value >> 32))) {
+		return index + 33;
+	}
+	_BitScanReverse(&index, static_cast<unsigned long>(value));
+	return index + 1;
+#else
+	return 64 - __builtin_clzll(value);
+#endif
+}
+
+size_t CountDigits(uint64_t value)
+{
+	// Estimate from the bit length (log10(2) ~ 1233/4096), then correct by one
+	size_t bits = BitLength(value | 1);
+	size_t digits = (bits * 1233) >> 12;
+	return digits + ((value | 1) >= POW10[digits]);
+}
+
+bool IsContinuation(uint8_t c)
+{
+	return (c & 0xC0) == 0x80;
+}
+
+// Same checks as yyjson's is_utf8_seq2/3/4: no overlong forms, no surrogates, nothing above U+10FFFF
+bool IsValidSeq2(const uint8_t* s)
+{
+	return (s[0] & 0xE0) == 0xC0 && IsContinuation(s[1]) && (s[0] & 0x1E) != 0;
+}
+
+bool IsValidSeq3(const uint8_t* s)
+{
+	if ((s[0] & 0xF0) != 0xE0 || !IsContinuation(s[1]) || !IsContinuation(s[2])) {
+		return false;
+	}
+	uint8_t hi = s[0] & 0x0F;
+	uint8_t lo = s[1] & 0x20;
+	return (hi || lo) && !(hi == 0x0D && lo);
+}
+
+bool IsValidSeq4(const uint8_t* s)
+{
+	if ((s[0] & 0xF8) != 0xF0 || !IsContinuation(s[1]) || !IsContinuation(s[2]) || !IsContinuation(s[3])) {
+		return false;
+	}
+	uint8_t hi = s[0] & 0x07;
+	uint8_t lo = s[1] & 0x30;
+	return (hi || lo) && ((hi & 0x04) == 0 || ((hi & 0x03) == 0 && lo == 0));
+}
+
+// Per-byte tests on 8 bytes at once: any byte >= 0x80, < 0x20, '"' or '\'
+constexpr uint64_t ONES = 0x0101010101010101ULL;
+constexpr uint64_t HIGHS = 0x8080808080808080ULL;
+
+bool HasZeroByte(uint64_t x)
+{
+	return ((x - ONES) & ~x & HIGHS) != 0;
+}
+
+bool NeedsCheck(uint64_t x)
+{
+	return (x & HIGHS) || ((x - ONES * 0x20) & ~x & HIGHS) ||
+		HasZeroByte(x ^ (ONES * '"')) || HasZeroByte(x ^ (ONES * '\\'));
+}
+
+// Returned by the measure helpers when yyjson would fail to write the value
+constexpr size_t MEASURE_FAILED = SIZE_MAX;
+
+/**
+ * Length of a UTF-8 sequence starting at a byte >= 0x80 as written by yyjson's write_str()
+ * @return Bytes written, or 0 on invalid UTF-8 when it is not allowed
+ */
+size_t MeasureUtf8(const uint8_t*& str, const uint8_t* end, const MeasureOptions& opts)
+{
+	uint8_t c = *str;
+	size_t seq_len = 0;
+	if (c >= 0xC0 && c < 0xE0) {
+		seq_len = 2;
+	} else if (c >= 0xE0 && c < 0xF0) {
+		seq_len = 3;
+	} else if (c >= 0xF0 && c < 0xF8) {
+		seq_len = 4;
+	}
+
+	bool valid = seq_len != 0 && static_cast<size_t>(end - str) >= seq_len;
+	if (valid) {
+		switch (seq_len) {
+			case 2: valid = IsValidSeq2(str); break;
+			case 3: valid = IsValidSeq3(str); break;
+			default: valid = IsValidSeq4(str); break;
+		}
+	}
+
+	if (!valid) {
+		// Invalid bytes are copied one by one, or replaced with \uFFFD when escaping
+		if (!opts.allow_invalid) {
+			return 0;
+		}
+		str++;
+		return opts.escape_unicode ? 6 : 1;
+	}
+
+	str += seq_len;
+	if (opts.escape_unicode) {
+		// Characters outside the BMP are written as a surrogate pair
+		return seq_len == 4 ? 12 : 6;
+	}
+	return seq_len;
+}
+
+/**
+ * Length of a quoted string as written by yyjson's write_str()
+ */
+size_t MeasureString(const uint8_t* str, size_t len, const MeasureOptions& opts)
+{
+	const uint8_t* end = str + len;
+	size_t total = 2;
+
+	while (str < end) {
+		// Runs of plain ASCII are copied as-is, the chunk test does not look for '/'
+		// so it is skipped when slashes are escaped
+		if (end - str >= 8 && opts.ascii_extra == ASCII_EXTRA.data()) {
+			uint64_t chunk;
+			memcpy(&chunk, str, sizeof(chunk));
+			if (!NeedsCheck(chunk)) {
+				total += 8;
+				str += 8;
+				continue;
+			}
+		}
+
+		uint8_t extra = opts.ascii_extra[*str];
+		if (extra != NON_ASCII) {
+			total += 1 + extra;
+			str++;
+			continue;
+		}
+
+		size_t seq = MeasureUtf8(str, end, opts);
+		if (!seq) {
+			return MEASURE_FAILED;
+		}
+		total += seq;
+	}
+
+	return total;
+}
+
+/**
+ * Length of a real number, formatted by yyjson with the same flags
+ */
+template <typename Val>
+size_t MeasureReal(const Val* val, yyjson_write_flag write_flg)
+{
+	char buf[64];
+
+	// Shortest double output only consults the flags for NaN/Inf
+	uint64_t fmt = (val->tag >> 32) | write_flg;
+	bool shortest = !(fmt >> (32 - YYJSON_WRITE_FP_FLAG_BITS));
+	if (shortest && std::isfinite(unsafe_yyjson_get_real(const_cast<Val*>(val)))) {
+		char* end = yyjson_write_number(reinterpret_cast<const yyjson_val*>(val), buf);
+		return static_cast<size_t>(end - buf);
+	}
+
+	yyjson_write_flag num_flg = write_flg & ~YYJSON_WRITE_NEWLINE_AT_END;
+	size_t len;
+	if constexpr (std::is_same_v<Val, yyjson_mut_val>) {
+		len = yyjson_mut_val_write_buf(buf, sizeof(buf), val, num_flg, nullptr);
+	} else {
+		len = yyjson_val_write_buf(buf, sizeof(buf), val, num_flg, nullptr);
+	}
+	return len ? len : MEASURE_FAILED;
+}
+
+/**
+ * Length of a scalar value
+ * @return Bytes written, or MEASURE_FAILED
+ */
+template <typename Val>
+size_t MeasureScalar(const Val* val, yyjson_write_flag write_flg, const MeasureOptions& opts)
+{
+	void* raw = const_cast<Val*>(val);
+
+	// Type and subtype together, the common cases need nothing but the tag
+	switch (unsafe_yyjson_get_tag(raw)) {
+		case YYJSON_TYPE_NULL | YYJSON_SUBTYPE_NONE:
+			return 4;
+		case YYJSON_TYPE_BOOL | YYJSON_SUBTYPE_TRUE:
+			return 4;
+		case YYJSON_TYPE_BOOL | YYJSON_SUBTYPE_FALSE:
+			return 5;
+		case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_UINT:
+			return CountDigits(unsafe_yyjson_get_uint(raw));
+		case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_SINT: {
+			int64_t value = unsafe_yyjson_get_sint(raw);
+			return value < 0 ? 1 + CountDigits(0 - static_cast<uint64_t>(value)) : CountDigits(static_cast<uint64_t>(value));
+		}
+		case YYJSON_TYPE_NUM | YYJSON_SUBTYPE_REAL:
+			return MeasureReal(val, write_flg);
+		case YYJSON_TYPE_STR | YYJSON_SUBTYPE_NOESC:
+			if (opts.noesc_allowed) {
+				return unsafe_yyjson_get_len(raw) + 2;
+			}
+			[[fallthrough]];
+		case YYJSON_TYPE_STR | YYJSON_SUBTYPE_NONE:
+			return MeasureString(reinterpret_cast<const uint8_t*>(unsafe_yyjson_get_str(raw)), unsafe_yyjson_get_len(raw), opts);
+		case YYJSON_TYPE_RAW | YYJSON_SUBTYPE_NONE:
+			return unsafe_yyjson_get_len(raw);
+		default:
+			return MEASURE_FAILED;
+	}
+}
+
+/**
+ * Brackets, separators and indentation of a container, everything but its children
+ * @param level Nesting depth of the container, 0 for the root
+ */
+size_t ContainerOverhead(size_t count, bool is_obj, size_t level, const MeasureOptions& opts)
+{
+	if (count == 0) {
+		return 2;
+	}
+
+	size_t total;
+	if (opts.pretty) {
+		// "[\n", one indented line per item joined by ",\n", "\n" and the indented closing bracket
+		total = 2 + count * (level + 1) * opts.spaces + (2 * count - 1) + level * opts.spaces + 1;
+		if (is_obj) {
+			total += count * 2;  // ": "
+		}
+	} else {
+		total = 2 + (count - 1);
+		if (is_obj) {
+			total += count;  // ':'
+		}
+	}
+	return total;
+}
+
+bool IsContainer(void* val)
+{
+	uint8_t type = unsafe_yyjson_get_type(val);
+	return type == YYJSON_TYPE_ARR || type == YYJSON_TYPE_OBJ;
+}
+
+/**
+ * Immutable values are stored in document order, so every value is visited with a linear scan.
+ * Depth is only tracked for pretty output, from the end of each open container.
+ */
+size_t MeasureValues(const yyjson_val* root, yyjson_write_flag write_flg, const MeasureOptions& opts)
+{
+	size_t total = 0;
+	yyjson_val* cur = const_cast<yyjson_val*>(root);
+	yyjson_val* end = unsafe_yyjson_get_next(cur);
+	std::vector<yyjson_val*> open_ends;
+
+	for (; cur < end; cur++) {
+		if (!IsContainer(cur)) {
+			size_t len = MeasureScalar(cur, write_flg, opts);
+			if (len == MEASURE_FAILED) {
+				return MEASURE_FAILED;
+			}
+			total += len;
+			continue;
+		}
+
+		size_t count = unsafe_yyjson_get_len(cur);
+		bool is_obj = unsafe_yyjson_get_type(cur) == YYJSON_TYPE_OBJ;
+
+		size_t level = 0;
+		if (opts.pretty) {
+			while (!open_ends.empty() && cur >= open_ends.back()) {
+				open_ends.pop_back();
+			}
+			level = open_ends.size();
+			if (count) {
+				open_ends.push_back(unsafe_yyjson_get_next(cur));
+			}
+		}
+
+		total += ContainerOverhead(count, is_obj, level, opts);
+	}
+
+	return total;
+}
+
+/**
+ * Mutable containers are circular lists pointing at their last child, walked with one frame per open container
+ */
+size_t MeasureValues(const yyjson_mut_val* root, yyjson_write_flag write_flg, const MeasureOptions& opts)
+{
+	size_t total = 0;
+	struct Frame {
+		const yyjson_mut_val* next;
+		size_t remaining;
+	};
+
+	std::vector<Frame> stack;
+	auto open_container = [&](const yyjson_mut_val* ctn) {
+		void* raw = const_cast<yyjson_mut_val*>(ctn);
+		size_t count = unsafe_yyjson_get_len(raw);
+		bool is_obj = unsafe_yyjson_get_type(raw) == YYJSON_TYPE_OBJ;
+
+		total += ContainerOverhead(count, is_obj, stack.size(), opts);
+		if (count) {
+			const yyjson_mut_val* last = static_cast<const yyjson_mut_val*>(ctn->uni.ptr);
+			stack.push_back({ last->next, is_obj ? count * 2 : count });
+		}
+	};
+
+	open_container(root);
+
+	while (!stack.empty()) {
+		Frame& frame = stack.back();
+		if (frame.remaining == 0) {
+			stack.pop_back();
+			continue;
+		}
+
+		const yyjson_mut_val* val = frame.next;
+		frame.next = val->next;
+		frame.remaining--;
+
+		if (IsContainer(const_cast<yyjson_mut_val*>(val))) {
+			open_container(val);
+			continue;
+		}
+
+		size_t len = MeasureScalar(val, write_flg, opts);
+		if (len == MEASURE_FAILED) {
+			return MEASURE_FAILED;
+		}
+		total += len;
+	}
+
+	return total;
+}
+
+template <typename Val>
+bool MeasureRoot(const Val* root, yyjson_write_flag write_flg, size_t* out_len)
+{
+	if (!root) {
+		return false;
+	}
+
+	MeasureOptions opts = GetMeasureOptions(write_flg);
+	size_t total;
+
+	if (IsContainer(const_cast<Val*>(root))) {
+		total = MeasureValues(root, write_flg, opts);
+	} else {
+		total = MeasureScalar(root, write_flg, opts);
+	}
+
+	if (total == MEASURE_FAILED) {
+		return false;
+	}
+
+	if (write_flg & YYJSON_WRITE_NEWLINE_AT_END) {
+		total += 1;
+	}
+
+	*out_len = total;
+	return true;
+}
+
+// Space the yyjson writer reserves before each value, see incr_len() in write_root_minify/pretty
+constexpr size_t WRITER_NUM_RESERVE = 40; // FP_BUF_LEN
+constexpr size_t WRITER_CTX_SIZE = 16;    // sizeof(yyjson_write_ctx), kept at the buffer end per open container
+
+/**
+ * Reservation for one value, which always covers what the writer then outputs for it
+ * @param level Nesting depth of the value, 0 for the root
+ */
+size_t WriterReserve(void* val, size_t level, bool pretty)
+{
+	size_t indent = pretty ? level * 4 : 0;
+	switch (unsafe_yyjson_get_type(val)) {
+		case YYJSON_TYPE_STR:
+			return unsafe_yyjson_get_len(val) * 6 + 16 + indent;
+		case YYJSON_TYPE_NUM:
+			return WRITER_NUM_RESERVE + indent;
+		case YYJSON_TYPE_RAW:
+			return unsafe_yyjson_get_len(val) + 3 + indent;
+		case YYJSON_TYPE_ARR:
+		case YYJSON_TYPE_OBJ: {
+			size_t total = 2 * WRITER_CTX_SIZE + indent;
+			if (pretty && unsafe_yyjson_get_len(val)) {
+				total += (level + 1) * 4;  // Closing bracket on its own indented line
+			}
+			return total;
+		}
+		default:
+			return 16 + indent;
+	}
+}
+
+// Reservations plus the context stack at its deepest, the newline and alignment of the buffer length
+size_t WriterTotal(size_t reserved, size_t max_depth)
+{
+	return reserved + max_depth * WRITER_CTX_SIZE + 2 * WRITER_CTX_SIZE + 2;
+}
+
+size_t EstimateValues(const yyjson_val* root, bool pretty)
+{
+	size_t reserved = 0;
+	size_t max_depth = 0;
+	yyjson_val* cur = const_cast<yyjson_val*>(root);
+	yyjson_val* end = unsafe_yyjson_get_next(cur);
+	std::vector<yyjson_val*> open_ends;
+
+	for (; cur < end; cur++) {
+		while (!open_ends.empty() && cur >= open_ends.back()) {
+			open_ends.pop_back();
+		}
+		reserved += WriterReserve(cur, open_ends.size(), pretty);
+		if (IsContainer(cur) && unsafe_yyjson_get_len(cur)) {
+			open_ends.push_back(unsafe_yyjson_get_next(cur));
+			if (open_ends.size() > max_depth) {
+				max_depth = open_ends.size();
+			}
+		}
+	}
+
+	return WriterTotal(reserved, max_depth);
+}
+
+size_t EstimateValues(const yyjson_mut_val* root, bool pretty)
+{
+	size_t reserved = 0;
+	size_t max_depth = 0;
+	struct Frame {
+		const yyjson_mut_val* next;
+		size_t remaining;
+	};
+
+	std::vector<Frame> stack;
+	auto visit = [&](const yyjson_mut_val* val) {
+		void* raw = const_cast<yyjson_mut_val*>(val);
+		reserved += WriterReserve(raw, stack.size(), pretty);
+		size_t count = IsContainer(raw) ? unsafe_yyjson_get_len(raw) : 0;
+		if (count) {
+			const yyjson_mut_val* last = static_cast<const yyjson_mut_val*>(val->uni.ptr);
+			bool is_obj = unsafe_yyjson_get_type(raw) == YYJSON_TYPE_OBJ;
+			stack.push_back({ last->next, is_obj ? count * 2 : count });
+			if (stack.size() > max_depth) {
+				max_depth = stack.size();
+			}
+		}
+	};
+
+	visit(root);
+
+	while (!stack.empty()) {
+		Frame& frame = stack.back();
+		if (frame.remaining == 0) {
+			stack.pop_back();
+			continue;
+		}
+
+		const yyjson_mut_val* val = frame.next;
+		frame.next = val->next;
+		frame.remaining--;
+		visit(val);
+	}
+
+	return WriterTotal(reserved, max_depth);
+}
+
+} // namespace
+
+bool MeasureWriteSize(const yyjson_val* val, yyjson_write_flag write_flg, size_t* out_len)
+{
+	return MeasureRoot(val, write_flg, out_len);
+}
+
+bool MeasureWriteSize(const yyjson_mut_val* val, yyjson_write_flag write_flg, size_t* out_len)
+{
+	return MeasureRoot(val, write_flg, out_len);
+}
+
+
+size_t EstimateWriteBuffer(const yyjson_val* val, yyjson_write_flag write_flg)
+{
+	return val ? EstimateValues(val, GetMeasureOptions(write_flg).pretty) : 0;
+}
+
+size_t EstimateWriteBuffer(const yyjson_mut_val* val, yyjson_write_flag write_flg)
+{
+	return val ? EstimateValues(val, GetMeasureOptions(write_flg).pretty) : 0;
+}
@@ -0,0 +1,34 @@
+#ifndef _INCLUDE_JSONWRITESIZE_H_
+#define _INCLUDE_JSONWRITESIZE_H_
+
+#include <cstddef>
+#include <yyjson.h>
+
+/**
+ * @brief Compute the exact length yyjson would write for a value, without building the output
+ *
+ * Structure, indentation and string escaping are counted with the same rules as the yyjson writer.
+ * Only floating-point numbers are formatted, into a small stack buffer.
+ *
+ * @param val Value to measure
+ * @param write_flg Write flags
+ * @param out_len Receives the length in bytes, not including the null terminator
+ * @return false if yyjson would fail to write the value (NaN/Inf or invalid UTF-8 without the allow flags)
+ */
+bool MeasureWriteSize(const yyjson_val* val, yyjson_write_flag write_flg, size_t* out_len);
+bool MeasureWriteSize(const yyjson_mut_val* val, yyjson_write_flag write_flg, size_t* out_len);
+
+/**
+ * @brief Upper bound of the buffer yyjson needs to write a value into caller memory
+ *
+ * The buffer writer reserves room ahead of every value (6 bytes per string byte, for escapes) and keeps
+ * its container stack at the end of the buffer. Only lengths are read, so this is cheaper than measuring.
+ *
+ * @param val Value to write
+ * @param write_flg Write flags
+ * @return Buffer size that never fails for lack of space, 0 for a null value
+ */
+size_t EstimateWriteBuffer(const yyjson_val* val, yyjson_write_flag write_flg);
+size_t EstimateWriteBuffer(const yyjson_mut_val* val, yyjson_write_flag write_flg);
+
+#endif // _INCLUDE_JSONWRITESIZE_H_
@@ -1,5 +1,6 @@
 #include "extension.h"
 #include "JsonManager.h"
+#include "JsonAsync.h"
 
 JsonExtension g_JsonExt;
 SMEXT_LINK(&g_JsonExt);
@@ -7,11 +8,26 @@ SMEXT_LINK(&g_JsonExt);
 HandleType_t g_JsonType;
 HandleType_t g_ArrIterType;
 HandleType_t g_ObjIterType;
+HandleType_t g_StreamParserType;
+HandleType_t g_LinesReaderType;
+HandleType_t g_LinesWriterType;
+HandleType_t g_CursorType;
+HandleType_t g_CellArrayType;
 JsonHandler g_JsonHandler;
 ArrIterHandler g_ArrIterHandler;
 ObjIterHandler g_ObjIterHandler;
+StreamParserHandler g_StreamParserHandler;
+LinesReaderHandler g_LinesReaderHandler;
+LinesWriterHandler g_LinesWriterHandler;
+CursorHandler g_CursorHandler;
+JsonParseLimitsRegistry g_JsonParseLimits;
 IJsonManager* g_pJsonManager;
 
+static void OnGameFrame(bool simulating)
+{
+	g_JsonAsync.RunFrame();
+}
+
 bool JsonExtension::SDK_OnLoad(char* error, size_t maxlen, bool late)
 {
 	sharesys->AddNatives(myself, g_JsonNatives);
@@ -46,6 +62,35 @@ bool JsonExtension::SDK_OnLoad(char* error, size_t maxlen, bool late)
 		return false;
 	}
 
+	g_StreamParserType = handlesys->CreateType("JSONStreamParser", &g_StreamParserHandler, 0, &taDefault, &haDefault, myself->GetIdentity(), &err);
+	if (!g_StreamParserType) {
+		snprintf(error, maxlen, "Failed to create JSONStreamParser handle type (err: %d)", err);
+		return false;
+	}
+
+	g_LinesReaderType = handlesys->CreateType("JSONLinesReader", &g_LinesReaderHandler, 0, &taDefault, &haDefault, myself->GetIdentity(), &err);
+	if (!g_LinesReaderType) {
+		snprintf(error, maxlen, "Failed to create JSONLinesReader handle type (err: %d)", err);
+		return false;
+	}
+
+	g_LinesWriterType = handlesys->CreateType("JSONLinesWriter", &g_LinesWriterHandler, 0, &taDefault, &haDefault, myself->GetIdentity(), &err);
+	if (!g_LinesWriterType) {
+		snprintf(error, maxlen, "Failed to create JSONLinesWriter handle type (err: %d)", err);
+		return false;
+	}
+
+	g_CursorType = handlesys->CreateType("JSONCursor", &g_CursorHandler, 0, &taDefault, &haDefault, myself->GetIdentity(), &err);
+	if (!g_CursorType) {
+		snprintf(error, maxlen, "Failed to create JSONCursor handle type (err: %d)", err);
+		return false;
+	}
+
+	// Core type used to read ArrayList arguments, natives taking one throw if it is missing
+	if (!handlesys->FindHandleType("CellArray", &g_CellArrayType)) {
+		g_CellArrayType = 0;
+	}
+
 	if (g_pJsonManager) {
 		delete g_pJsonManager;
 		g_pJsonManager = nullptr;
@@ -57,14 +102,27 @@ bool JsonExtension::SDK_OnLoad(char* error, size_t maxlen, bool late)
 		return false;
 	}
 
+	plugins->AddPluginsListener(&g_JsonAsync);
+	plugins->AddPluginsListener(&g_JsonParseLimits);
+	smutils->AddGameFrameHook(&OnGameFrame);
+
 	return sharesys->AddInterface(myself, g_pJsonManager);
 }
 
 void JsonExtension::SDK_OnUnload()
 {
+	smutils->RemoveGameFrameHook(&OnGameFrame);
+	plugins->RemovePluginsListener(&g_JsonAsync);
+	plugins->RemovePluginsListener(&g_JsonParseLimits);
+	g_JsonAsync.Shutdown();
+
 	handlesys->RemoveType(g_JsonType, myself->GetIdentity());
 	handlesys->RemoveType(g_ArrIterType, myself->GetIdentity());
 	handlesys->RemoveType(g_ObjIterType, myself->GetIdentity());
+	handlesys->RemoveType(g_StreamParserType, myself->GetIdentity());
+	handlesys->RemoveType(g_LinesReaderType, myself->GetIdentity());
+	handlesys->RemoveType(g_LinesWriterType, myself->GetIdentity());
+	handlesys->RemoveType(g_CursorType, myself->GetIdentity());
 
 	if (g_pJsonManager) {
 		delete g_pJsonManager;
@@ -85,4 +143,46 @@ void ArrIterHandler::OnHandleDestroy(HandleType_t type, void* object)
 void ObjIterHandler::OnHandleDestroy(HandleType_t type, void* object)
 {
 	delete (JsonObjIter*)object;
+}
+
+void StreamParserHandler::OnHandleDestroy(HandleType_t type, void* object)
+{
+	delete (JsonStreamParser*)object;
+}
+
+void LinesReaderHandler::OnHandleDestroy(HandleType_t type, void* object)
+{
+	delete (JsonLinesReader*)object;
+}
+
+void LinesWriterHandler::OnHandleDestroy(HandleType_t type, void* object)
+{
+	delete (JsonLinesWriter*)object;
+}
+
+void CursorHandler::OnHandleDestroy(HandleType_t type, void* object)
+{
+	delete (JsonCursor*)object;
+}
+
+const JsonParseLimits& JsonParseLimitsRegistry::Get(IPluginContext* pContext) const
+{
+	static const JsonParseLimits s_unlimited;
+
+	auto it = m_limits.find(pContext);
+	return it != m_limits.end() ? it->second : s_unlimited;
+}
+
+void JsonParseLimitsRegistry::Set(IPluginContext* pContext, const JsonParseLimits& limits)
+{
+	if (limits.IsUnlimited()) {
+		m_limits.erase(pContext);
+	} else {
+		m_limits[pContext] = limits;
+	}
+}
+
+void JsonParseLimitsRegistry::OnPluginUnloaded(IPlugin* plugin)
+{
+	m_limits.erase(plugin->GetBaseContext());
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include "smsdk_ext.h"
 #include "IJsonManager.h"
+#include <unordered_map>
 
 class JsonExtension : public SDKExtension
 {
@@ -29,13 +30,66 @@ public:
 	void OnHandleDestroy(HandleType_t type, void *object);
 };
 
+class StreamParserHandler : public IHandleTypeDispatch
+{
+public:
+	void OnHandleDestroy(HandleType_t type, void *object);
+};
+
+class LinesReaderHandler : public IHandleTypeDispatch
+{
+public:
+	void OnHandleDestroy(HandleType_t type, void *object);
+};
+
+class LinesWriterHandler : public IHandleTypeDispatch
+{
+public:
+	void OnHandleDestroy(HandleType_t type, void *object);
+};
+
+class CursorHandler : public IHandleTypeDispatch
+{
+public:
+	void OnHandleDestroy(HandleType_t type, void *object);
+};
+
+/**
+ * Parse limits set by each plugin with JSON.SetParseLimits, dropped when the plugin unloads
+ */
+class JsonParseLimitsRegistry : public IPluginsListener
+{
+public:
+	/**
+	 * @return Limits of a plugin, unlimited if it set none
+	 */
+	const JsonParseLimits& Get(IPluginContext* pContext) const;
+	void Set(IPluginContext* pContext, const JsonParseLimits& limits);
+
+	// IPluginsListener
+	void OnPluginUnloaded(IPlugin* plugin) override;
+
+private:
+	std::unordered_map<IPluginContext*, JsonParseLimits> m_limits;
+};
+
 extern JsonExtension g_JsonExt;
 extern HandleType_t g_JsonType;
 extern HandleType_t g_ArrIterType;
 extern HandleType_t g_ObjIterType;
+extern HandleType_t g_StreamParserType;
+extern HandleType_t g_LinesReaderType;
+extern HandleType_t g_LinesWriterType;
+extern HandleType_t g_CursorType;
+extern HandleType_t g_CellArrayType;
 extern JsonHandler g_JsonHandler;
 extern ArrIterHandler g_ArrIterHandler;
 extern ObjIterHandler g_ObjIterHandler;
+extern StreamParserHandler g_StreamParserHandler;
+extern LinesReaderHandler g_LinesReaderHandler;
+extern LinesWriterHandler g_LinesWriterHandler;
+extern CursorHandler g_CursorHandler;
+extern JsonParseLimitsRegistry g_JsonParseLimits;
 extern const sp_nativeinfo_t g_JsonNatives[];
 extern IJsonManager* g_pJsonManager;
 
@@ -13,5 +13,6 @@
 #define SMEXT_LINK(name) SDKExtension *g_pExtensionIface = name;
 
 #define SMEXT_ENABLE_HANDLESYS
+#define SMEXT_ENABLE_PLUGINSYS
 
 #endif // _INCLUDE_SOURCEMOD_EXTENSION_CONFIG_H_
\ No newline at end of file